@@ -0,0 +1,140 @@
+/**
+ * @file BVH.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Benchmark of Scene::BVH build, refit and query throughput for growing object counts.
+ *      Doesn't need a window or OpenGL context.
+ *      Usage: BVH_bench [max object count]
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include <chrono>
+#include <format>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Renderer/Frustum.hpp"
+#include "Scene/BVH.hpp"
+#include "Scene/AABB.hpp"
+
+namespace
+{
+
+constexpr uint Queries = 1000;
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Boxes of size up to 2 scattered in a cube growing with count, so density stays similar to the box field
+auto make_bounds(uint count, std::mt19937& random) -> std::vector<Scene::AABB>
+{
+    const float extent = 50.f * std::cbrt(count / 8000.f);
+
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> size(0.f, 1.f);
+
+    std::vector<Scene::AABB> bounds(count);
+    for (auto& box : bounds)
+    {
+        const glm::vec3 center{position(random), position(random), position(random)};
+        const float half = size(random);
+
+        box = {center - glm::vec3{half}, center + glm::vec3{half}};
+    }
+
+    return bounds;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint maxCount = argc > 1 ? std::stoul(argv[1]) : 10'000'000;
+
+    std::mt19937 random{42};
+
+    std::cout << std::format("{:>10} {:>11} {:>11} {:>9} {:>15} {:>13} {:>13} {:>13}\n",
+        "objects", "build [ms]", "refit [ms]", "nodes", "frustum [q/s]", "visible avg", "ray [q/s]", "sphere [q/s]");
+
+    for (uint count = 10'000; count <= maxCount; count *= 10)
+    {
+        std::vector<Scene::AABB> bounds = make_bounds(count, random);
+        const float extent = 50.f * std::cbrt(count / 8000.f);
+
+        Scene::BVH bvh;
+
+        auto start = std::chrono::steady_clock::now();
+        bvh.build(bounds);
+        const double buildTime = elapsed_ms(start);
+
+        for (auto& box : bounds)
+        {
+            box.min += glm::vec3{0.1f};
+            box.max += glm::vec3{0.1f};
+        }
+
+        start = std::chrono::steady_clock::now();
+        bvh.refit(bounds);
+        const double refitTime = elapsed_ms(start);
+
+        // Cameras at the center looking in random directions
+        std::uniform_real_distribution<float> direction(-1.f, 1.f);
+        const glm::mat4 projection = glm::perspective(glm::radians(75.f), 4.f / 3.f, 0.5f, 20000.f);
+
+        std::vector<Renderer::Frustum> frustums(Queries);
+        std::vector<Scene::Ray> rays(Queries);
+        for (uint i = 0; i < Queries; i++)
+        {
+            const glm::vec3 forward = glm::normalize(glm::vec3{direction(random), direction(random), direction(random)});
+            const glm::mat4 view = glm::lookAt(glm::vec3{0.f}, forward, glm::vec3{0.f, 1.f, 0.f});
+
+            frustums[i] = Renderer::Frustum::FromMatrix(projection * view);
+            rays[i] = {glm::vec3{direction(random), direction(random), direction(random)} * extent, forward};
+        }
+
+        std::vector<uint> result;
+        result.reserve(count);
+        uint64_t visible = 0;
+
+        start = std::chrono::steady_clock::now();
+        for (const auto& frustum : frustums)
+        {
+            result.clear();
+            bvh.queryFrustum(frustum, result);
+            visible += result.size();
+        }
+        const double frustumTime = elapsed_ms(start);
+
+        uint hits = 0;
+        start = std::chrono::steady_clock::now();
+        for (const auto& ray : rays)
+            hits += bvh.raycast(ray).has_value();
+        const double rayTime = elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        for (const auto& ray : rays)
+        {
+            result.clear();
+            bvh.querySphere(ray.origin, 5.f, result);
+        }
+        const double sphereTime = elapsed_ms(start);
+
+        std::cout << std::format("{:>10} {:>11.2f} {:>11.2f} {:>9} {:>15.0f} {:>13} {:>13.0f} {:>13.0f}\n",
+            count, buildTime, refitTime, bvh.getNodes().size(),
+            Queries / (frustumTime / 1000.0), visible / Queries,
+            Queries / (rayTime / 1000.0),
+            Queries / (sphereTime / 1000.0));
+    }
+
+    return 0;
+}
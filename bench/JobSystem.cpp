@@ -0,0 +1,103 @@
+/**
+ * @file JobSystem.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Scaling benchmark of JobSystem, builds model matrices and culls boxes with 1 to N threads.
+ *      Doesn't need a window or OpenGL context.
+ *      Usage: JobSystem_bench [box count] [max threads]
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include <chrono>
+#include <format>
+#include <limits>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "JobSystem.hpp"
+#include "Renderer/Culling.hpp"
+#include "Renderer/Frustum.hpp"
+#include "Scene/Box.hpp"
+
+namespace
+{
+
+constexpr uint Repetitions = 10;
+constexpr uint BoxesPerJob = 4096;
+
+// Returns best time of all repetitions in milliseconds
+template<typename Func>
+auto measure(Func&& func) -> double
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (uint i = 0; i < Repetitions; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    return best;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint boxCount = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const uint maxThreads = argc > 2 ? std::stoul(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+
+    const std::vector<Scene::Box> boxes = Scene::create_boxes(boxCount);
+    const Renderer::BoundingSpheres spheres = Renderer::make_bounding_spheres(boxes);
+
+    const glm::mat4 projection = glm::perspective(glm::radians(75.f), 4.f / 3.f, 0.5f, 20000.f);
+    const glm::mat4 view = glm::lookAt(glm::vec3{0.f}, glm::vec3{0.f, 0.f, -1.f}, glm::vec3{0.f, 1.f, 0.f});
+    const Renderer::Frustum frustum = Renderer::Frustum::FromMatrix(projection * view);
+
+    std::vector<glm::mat4> matrices(boxCount);
+    std::vector<uint> visible;
+
+    std::cout << std::format("boxes: {}, best of {} runs\n", boxCount, Repetitions);
+    std::cout << std::format("{:>8} {:>14} {:>9} {:>14} {:>9}\n", "threads", "matrices [ms]", "speedup", "culling [ms]", "speedup");
+
+    double matricesBase{}, cullingBase{};
+
+    for (uint threads = 1; threads <= maxThreads; threads++)
+    {
+        JobSystem jobs(threads - 1);
+
+        const double matricesTime = measure([&]() {
+            jobs.parallel_for(0, boxCount, BoxesPerJob, [&](uint begin, uint end) {
+                for (uint i = begin; i < end; i++)
+                    matrices[i] = Scene::model_matrix(boxes[i]);
+            });
+        });
+
+        const double cullingTime = measure([&]() {
+            Renderer::cull_spheres(jobs, frustum, spheres, visible);
+        });
+
+        if (threads == 1)
+        {
+            matricesBase = matricesTime;
+            cullingBase = cullingTime;
+        }
+
+        std::cout << std::format("{:>8} {:>14.3f} {:>8.2f}x {:>14.3f} {:>8.2f}x\n",
+            threads,
+            matricesTime, matricesBase / matricesTime,
+            cullingTime, cullingBase / cullingTime);
+    }
+
+    return 0;
+}
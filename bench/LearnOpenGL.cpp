@@ -0,0 +1,30 @@
+/**
+ * @file LearnOpenGL.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Headless benchmark of the whole box scene, same as running the program with --headless.
+ *      Has to be started from the repository root, so resources are found.
+ *      Usage: LearnOpenGL_bench [--boxes N] [--seed N] [--frames N] [--warmup N] [--width N] [--height N]
+ *          [--mode perbox|instanced|indirect] [--culling none|simd|bvh] [--animate] [--unsorted] [--verify] [--no-lod] [--stream-textures]
+ *          [--texturing slots|array|bindless]
+ *          [--out result.json] [--baseline baseline.json] [--tolerance 0.1] [--trace-out trace.json]
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include <vector>
+#include <string_view>
+
+#include "Benchmark.hpp"
+
+auto main(int argc, char** argv) -> int
+{
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+
+    const auto config = parse_benchmark_config(args);
+    if (!config)
+        return -1;
+
+    return run_benchmark(*config);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file MeshLoad.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Benchmark of mesh loading into a vertex buffer: parsing a text model, reading a
+ *      binary mesh file into memory and mapping it, for generated meshes of growing size.
+ *      Files are read right after being written, so from a warm page cache.
+ *      Usage: MeshLoad_bench [size in MB...] (default 1 16 256, 1024 for a 1 GB mesh)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <chrono>
+#include <format>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+#include <glad/gl.h>
+
+#include "Mesh/MeshFile.hpp"
+#include "Renderer/Model.hpp"
+#include "Renderer/GPU/VertexBuffer.hpp"
+#include "Renderer/GPU/HeadlessContext.hpp"
+
+namespace
+{
+
+constexpr uint Repetitions = 3;
+
+// Text models above this size take too long to write and parse to be worth measuring
+constexpr std::size_t MaxTextBytes = 16ull << 20;
+
+const std::vector<std::size_t> DefaultSizes{1, 16, 256};
+
+template<typename Func>
+auto measure(Func&& func) -> double
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (uint i = 0; i < Repetitions; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        glFinish();
+        const auto end = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    return best;
+}
+
+// Triangle soup with position and texture coordinates, the layout of the box model
+auto make_mesh(std::size_t bytes) -> Mesh::MeshData
+{
+    Mesh::MeshData mesh;
+    mesh.layout.Push<float>(3);
+    mesh.layout.Push<float>(2);
+
+    mesh.vertexCount = bytes / mesh.layout.GetStride() / 3 * 3;
+
+    std::vector<float> floats(static_cast<std::size_t>(mesh.vertexCount) * 5);
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> value(-1.f, 1.f);
+
+    for (float& f : floats)
+        f = value(random);
+
+    mesh.vertices.resize(floats.size() * sizeof(float));
+    std::memcpy(mesh.vertices.data(), floats.data(), mesh.vertices.size());
+
+    return mesh;
+}
+
+auto write_text_model(const std::filesystem::path& path, const Mesh::MeshData& mesh) -> void
+{
+    std::ofstream file(path);
+    file << "float 3\nfloat 2";
+
+    const auto* floats = reinterpret_cast<const float*>(mesh.vertices.data());  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    for (std::size_t i = 0; i < mesh.vertices.size() / sizeof(float); i++)
+        file << '\n' << std::format("{}", floats[i]);
+}
+
+auto write_blob(const std::filesystem::path& path, const Mesh::MeshData& mesh) -> void
+{
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(mesh.vertices.data()), static_cast<std::streamsize>(mesh.vertices.size()));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+// Binary file read at once into memory, what a loader without mapping would do
+auto read_whole(const std::filesystem::path& path) -> std::vector<char>
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    std::vector<char> data(static_cast<std::size_t>(file.tellg()));
+
+    file.seekg(0);
+    file.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+    return data;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; i++)
+        sizes.push_back(std::stoull(argv[i]));
+    if (sizes.empty())
+        sizes = DefaultSizes;
+
+    Renderer::GPU::HeadlessContext context(64, 64);
+    if (!context.IsValid())
+        return -1;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::filesystem::path meshPath = directory / "MeshLoad_bench.mesh";
+    const std::filesystem::path textPath = directory / "MeshLoad_bench.dat";
+    const std::filesystem::path blobPath = directory / "MeshLoad_bench.bin";
+
+    std::cout << std::format("best of {} runs, warm page cache\n", Repetitions);
+    std::cout << std::format("{:>10} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12}\n",
+        "size [MB]", "vertices", "text [ms]", "read [ms]", "map [ms]", "mapped [ms]", "mapped MB/s");
+
+    for (const std::size_t size : sizes)
+    {
+        const Mesh::MeshData mesh = make_mesh(size << 20);
+        const std::size_t bytes = mesh.vertices.size();
+
+        if (!Mesh::write_mesh(meshPath, mesh))
+            return -1;
+        write_blob(blobPath, mesh);
+
+        std::string textTime = "-";
+        if (bytes <= MaxTextBytes)
+        {
+            write_text_model(textPath, mesh);
+            textTime = std::format("{:.2f}", measure([&]() {
+                const Renderer::Model model = Renderer::read_model(textPath);
+                const Renderer::GPU::VertexBuffer buffer(model.vertices.data(), model.vertices.size() * sizeof(float));
+            }));
+        }
+
+        const double readTime = measure([&]() {
+            const std::vector<char> data = read_whole(blobPath);
+            const Renderer::GPU::VertexBuffer buffer(data.data(), data.size());
+        });
+
+        // Mapping alone, pages are only touched by the upload
+        const double mapTime = measure([&]() { const Mesh::MappedMesh mapped(meshPath); });
+
+        const double mappedTime = measure([&]() {
+            const Mesh::MappedMesh mapped(meshPath);
+            const Renderer::GPU::VertexBuffer buffer(mapped.getVertexData().data(), mapped.getVertexData().size());
+        });
+
+        std::cout << std::format("{:>10} {:>12} {:>12} {:>12.2f} {:>12.3f} {:>12.2f} {:>12.0f}\n",
+            size, mesh.vertexCount, textTime, readTime, mapTime, mappedTime,
+            static_cast<double>(bytes) / (1 << 20) / (mappedTime / 1000.0));
+    }
+
+    std::filesystem::remove(meshPath);
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(blobPath);
+
+    return 0;
+}
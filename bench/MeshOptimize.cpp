@@ -0,0 +1,184 @@
+/**
+ * @file MeshOptimize.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Vertex cache, vertex fetch and overdraw of generated meshes and the box model
+ *      before and after Mesh::optimize_mesh, with time taken by it.
+ *      Doesn't need a window or OpenGL context.
+ *      Usage: MeshOptimize_bench [grid size] (default 300)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <cmath>
+#include <chrono>
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "Mesh/Mesh.hpp"
+#include "Mesh/Optimize.hpp"
+#include "Renderer/Model.hpp"
+
+namespace
+{
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Flat grid of size x size quads, triangles in row order
+auto make_grid(uint size) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    const uint side = size + 1;
+
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            mesh.vertices.push_back({{x / float(size), 0.f, y / float(size)}, {x / float(size), y / float(size)}});
+
+    for (uint y = 0; y < size; y++)
+    {
+        for (uint x = 0; x < size; x++)
+        {
+            const uint a = y * side + x, b = a + 1, c = a + side + 1, d = a + side;
+            mesh.indices.insert(mesh.indices.end(), {a, d, c, a, c, b});
+        }
+    }
+
+    return mesh;
+}
+
+// UV sphere, counter-clockwise from outside, triangles in ring order
+auto make_sphere(uint rings, uint segments) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    constexpr float Pi = 3.14159265f;
+
+    for (uint ring = 0; ring <= rings; ring++)
+    {
+        for (uint segment = 0; segment <= segments; segment++)
+        {
+            const float theta = Pi * ring / rings, phi = 2.f * Pi * segment / segments;
+            mesh.vertices.push_back({
+                {std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)},
+                {segment / float(segments), ring / float(rings)}
+            });
+        }
+    }
+
+    for (uint ring = 0; ring < rings; ring++)
+    {
+        for (uint segment = 0; segment < segments; segment++)
+        {
+            const uint a = ring * (segments + 1) + segment, b = a + 1, c = a + segments + 2, d = a + segments + 1;
+            mesh.indices.insert(mesh.indices.end(), {a, b, c, a, c, d});
+        }
+    }
+
+    return mesh;
+}
+
+// Torus around the y axis, parts of it occlude others from most views
+auto make_torus(uint rings, uint segments) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    constexpr float Pi = 3.14159265f;
+    constexpr float Major = 1.f, Minor = 0.35f;
+
+    for (uint ring = 0; ring <= rings; ring++)
+    {
+        for (uint segment = 0; segment <= segments; segment++)
+        {
+            const float theta = 2.f * Pi * ring / rings, phi = 2.f * Pi * segment / segments;
+            const float distance = Major + Minor * std::cos(phi);
+            mesh.vertices.push_back({
+                {distance * std::cos(theta), Minor * std::sin(phi), distance * std::sin(theta)},
+                {ring / float(rings), segment / float(segments)}
+            });
+        }
+    }
+
+    for (uint ring = 0; ring < rings; ring++)
+    {
+        for (uint segment = 0; segment < segments; segment++)
+        {
+            const uint a = ring * (segments + 1) + segment, b = a + 1, c = a + segments + 2, d = a + segments + 1;
+            mesh.indices.insert(mesh.indices.end(), {a, b, c, a, c, d});
+        }
+    }
+
+    return mesh;
+}
+
+// Same triangles in random order, and vertices shuffled too so fetch order is random as well
+auto shuffled(Mesh::IndexedMesh mesh, std::mt19937& random) -> Mesh::IndexedMesh
+{
+    std::vector<uint> triangles(mesh.triangleCount());
+    std::ranges::generate(triangles, [n = 0u]() mutable { return n++; });
+    std::ranges::shuffle(triangles, random);
+
+    std::vector<uint> vertexOrder(mesh.vertices.size());
+    std::ranges::generate(vertexOrder, [n = 0u]() mutable { return n++; });
+    std::ranges::shuffle(vertexOrder, random);
+
+    Mesh::IndexedMesh result;
+    result.vertices.resize(mesh.vertices.size());
+    for (uint i = 0; i < vertexOrder.size(); i++)
+        result.vertices[vertexOrder[i]] = mesh.vertices[i];
+
+    for (const uint triangle : triangles)
+        for (uint corner = 0; corner < 3; corner++)
+            result.indices.push_back(vertexOrder[mesh.indices[triangle * 3 + corner]]);
+
+    return result;
+}
+
+auto report(std::string_view name, Mesh::IndexedMesh mesh) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+    const Mesh::OptimizeReport result = Mesh::optimize_mesh(mesh);
+    const double time = elapsed_ms(start);
+
+    const auto row = [&](std::string_view stage, const Mesh::OptimizeReport::Stats& stats) {
+        std::cout << std::format("{:<16} {:>10} {:<7} {:>7.3f} {:>7.3f} {:>10.3f} {:>9.3f}",
+            stage == "before" ? name : "", stage == "before" ? std::to_string(mesh.triangleCount()) : "",
+            stage, stats.cache.acmr, stats.cache.atvr, stats.overfetch, stats.overdraw);
+    };
+
+    row("before", result.before);
+    std::cout << '\n';
+    row("after", result.after);
+    std::cout << std::format(" {:>10.2f}\n", time);
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint size = argc > 1 ? std::stoul(argv[1]) : 300;
+
+    std::mt19937 random(42);
+
+    std::cout << std::format("FIFO cache of {} vertices, {} byte vertices\n", Mesh::DefaultCacheSize, sizeof(Mesh::Vertex));
+    std::cout << std::format("{:<16} {:>10} {:<7} {:>7} {:>7} {:>10} {:>9} {:>10}\n",
+        "mesh", "triangles", "", "ACMR", "ATVR", "overfetch", "overdraw", "time [ms]");
+
+    report("grid", make_grid(size));
+    report("shuffled grid", shuffled(make_grid(size), random));
+    report("sphere", make_sphere(size / 2, size));
+    report("shuffled sphere", shuffled(make_sphere(size / 2, size), random));
+    report("torus", make_torus(size, size / 2));
+    report("shuffled torus", shuffled(make_torus(size, size / 2), random));
+    report("box", Mesh::from_model(Renderer::read_model("res/models/box.dat")));
+
+    return 0;
+}
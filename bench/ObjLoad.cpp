@@ -0,0 +1,156 @@
+/**
+ * @file ObjLoad.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Throughput of the OBJ importer with 1 to N threads on a generated grid mesh with texture
+ *      coordinates, normals and a material per band of rows, plus upload of the result.
+ *      Usage: ObjLoad_bench [grid size] [max threads] (default 1000, a 2M triangle mesh)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <cmath>
+#include <chrono>
+#include <format>
+#include <limits>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+#include <glad/gl.h>
+
+#include "JobSystem.hpp"
+#include "Mesh/Obj.hpp"
+#include "Renderer/MeshBuffers.hpp"
+#include "Renderer/GPU/VertexArray.hpp"
+#include "Renderer/GPU/HeadlessContext.hpp"
+
+namespace
+{
+
+constexpr uint Repetitions = 3;
+constexpr uint RowsPerMaterial = 64;
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<typename Func>
+auto measure(Func&& func) -> double
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (uint i = 0; i < Repetitions; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        best = std::min(best, elapsed_ms(start));
+    }
+
+    return best;
+}
+
+// Wavy grid of size x size quads, every corner with its own position, texture coordinates and normal
+auto make_obj(uint size) -> std::string
+{
+    std::string text = "# generated by ObjLoad_bench\nmtllib ObjLoad_bench.mtl\n";
+
+    const uint side = size + 1;
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            text += std::format("v {:.6f} {:.6f} {:.6f}\n", x / float(size), std::sin(x * 0.1f) * std::cos(y * 0.1f) * 0.05f, y / float(size));
+
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            text += std::format("vt {:.6f} {:.6f}\n", x / float(size), y / float(size));
+
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            text += std::format("vn {:.4f} {:.4f} {:.4f}\n", 0.f, 1.f, 0.f);
+
+    for (uint y = 0; y < size; y++)
+    {
+        if (y % RowsPerMaterial == 0)
+            text += std::format("usemtl band{}\n", y / RowsPerMaterial % 2);
+
+        for (uint x = 0; x < size; x++)
+        {
+            const uint a = y * side + x + 1, b = a + 1, c = a + side + 1, d = a + side;
+            text += std::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2} {3}/{3}/{3}\n", a, b, c, d);
+        }
+    }
+
+    return text;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint size = argc > 1 ? std::stoul(argv[1]) : 1000;
+    const uint maxThreads = argc > 2 ? std::stoul(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+
+    Renderer::GPU::HeadlessContext context(64, 64);
+    if (!context.IsValid())
+        return -1;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::filesystem::path objPath = directory / "ObjLoad_bench.obj";
+    const std::filesystem::path mtlPath = directory / "ObjLoad_bench.mtl";
+
+    const std::string text = make_obj(size);
+    std::ofstream(objPath, std::ios::binary) << text;
+    std::ofstream(mtlPath) << "newmtl band0\nKd 0.8 0.2 0.2\n\nnewmtl band1\nKd 0.2 0.2 0.8\nd 0.5\n";
+
+    const double megabytes = text.size() / double(1 << 20);
+
+    std::cout << std::format("{}x{} grid, {:.1f} MB, best of {} runs\n", size, size, megabytes, Repetitions);
+    std::cout << std::format("{:>8} {:>12} {:>9} {:>10} {:>10} {:>10} {:>10} {:>12}\n",
+        "threads", "parse [ms]", "speedup", "MB/s", "Mtris/s", "triangles", "vertices", "upload [ms]");
+
+    double parseBase{};
+
+    for (uint threads = 1; threads <= maxThreads; threads++)
+    {
+        JobSystem jobs(threads - 1);
+        std::optional<Mesh::ObjMesh> mesh;
+
+        const double parseTime = measure([&]() { mesh = Mesh::read_obj(objPath, &jobs); });
+        if (!mesh)
+            return -1;
+
+        const double uploadTime = measure([&]() {
+            const Renderer::MeshBuffers buffers = Renderer::upload_mesh(*mesh);
+
+            Renderer::GPU::VertexArray va;
+            va.AddBuffer(*buffers.vertices, buffers.layout);
+            glFinish();
+        });
+
+        if (threads == 1)
+        {
+            parseBase = parseTime;
+
+            std::cout << std::format("submeshes: {}, materials:", mesh->submeshes.size());
+            for (const Mesh::ObjMaterial& material : mesh->materials)
+                std::cout << std::format(" {} (diffuse {:.1f} {:.1f} {:.1f}, opacity {:.1f})",
+                    material.name, material.diffuse.r, material.diffuse.g, material.diffuse.b, material.opacity);
+            std::cout << '\n';
+        }
+
+        std::cout << std::format("{:>8} {:>12.2f} {:>8.2f}x {:>10.0f} {:>10.2f} {:>10} {:>10} {:>12.2f}\n",
+            threads, parseTime, parseBase / parseTime,
+            megabytes / (parseTime / 1000.0), mesh->triangleCount() / (parseTime * 1000.0),
+            mesh->triangleCount(), mesh->vertices.size(), uploadTime);
+    }
+
+    std::filesystem::remove(objPath);
+    std::filesystem::remove(mtlPath);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file Quantize.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Bytes per vertex and per box instance before and after quantization, with the largest
+ *      error measured by decoding everything back. Doesn't need a window or OpenGL context.
+ *      Usage: Quantize_bench [box count] (default 100000)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <cmath>
+#include <chrono>
+#include <format>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include "Mesh/Obj.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Mesh/Quantize.hpp"
+#include "Renderer/Model.hpp"
+#include "Renderer/BoxInstance.hpp"
+#include "Scene/Box.hpp"
+
+namespace
+{
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Flat grid of size x size quads spanning extent units, shows half float error growing with distance from the origin
+auto make_grid(uint size, float extent) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    const uint side = size + 1;
+
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            mesh.vertices.push_back({{x * extent / size, 0.f, y * extent / size}, {x / float(size), y / float(size)}});
+
+    return mesh;
+}
+
+auto report_mesh(std::string_view name, Mesh::MeshData mesh) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+    const Mesh::QuantizeReport report = Mesh::quantize_mesh(mesh);
+    const double time = elapsed_ms(start);
+
+    std::string errors;
+    for (const float error : report.maxError)
+        errors += std::format(" {:.6f}", error);
+
+    std::cout << std::format("{:<20} {:>9} {:>7} {:>7} {:>7.2f} {:>10.2f}  {}\n",
+        name, mesh.vertexCount, report.strideBefore, report.strideAfter,
+        static_cast<float>(report.strideAfter) / static_cast<float>(report.strideBefore), time, errors);
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint boxCount = argc > 1 ? std::stoul(argv[1]) : 100000;
+
+    std::cout << std::format("{:<20} {:>9} {:>7} {:>7} {:>7} {:>10}  {}\n",
+        "mesh", "vertices", "bytes", "packed", "ratio", "time [ms]", "max error per attribute");
+
+    report_mesh("box.dat", Mesh::to_mesh_data(Renderer::read_model("res/models/box.dat")));
+
+    if (const auto cube = Mesh::read_obj("res/models/default_cube.obj"))
+        report_mesh("default_cube.obj", Mesh::to_mesh_data(*cube));
+
+    report_mesh("grid, 1 unit", Mesh::to_mesh_data(make_grid(499, 1.f)));
+    report_mesh("grid, 100 units", Mesh::to_mesh_data(make_grid(499, 100.f)));
+    report_mesh("grid, 1000 units", Mesh::to_mesh_data(make_grid(499, 1000.f)));
+
+    // Instances of the box field as the renderer packs them, error of the unit box corners after unpacking
+    const std::vector<Scene::Box> boxes = Scene::create_boxes(boxCount, 1);
+
+    std::vector<Renderer::BoxInstance> instances(boxes.size());
+    for (uint i = 0; i < boxes.size(); i++)
+        instances[i] = {Scene::model_matrix(boxes[i]), glm::vec4{boxes[i].color, 1.f}, glm::uvec4{boxes[i].textures[0], boxes[i].textures[1], 0, 0}};
+
+    std::vector<Renderer::PackedBoxInstance> packed(instances.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    std::ranges::transform(instances, packed.begin(), &Renderer::pack_instance);
+    const double time = elapsed_ms(start);
+
+    float maxCornerError = 0.f, maxRelativeError = 0.f, maxColorError = 0.f;
+
+    for (uint i = 0; i < instances.size(); i++)
+    {
+        const glm::mat4 model = Renderer::unpack_model(packed[i]);
+        const float scale = packed[i].positionScale.w;
+
+        for (uint corner = 0; corner < 8; corner++)
+        {
+            const glm::vec4 point{corner & 1 ? 0.5f : -0.5f, corner & 2 ? 0.5f : -0.5f, corner & 4 ? 0.5f : -0.5f, 1.f};
+            maxCornerError = std::max(maxCornerError, glm::length(glm::vec3{instances[i].model * point} - glm::vec3{model * point}));
+        }
+
+        // Translation is kept as floats, relative error comes from rotation only
+        for (uint column = 0; column < 3 && scale > 0.f; column++)
+            maxRelativeError = std::max(maxRelativeError, glm::length(glm::vec3{instances[i].model[column]} - glm::vec3{model[column]}) / scale);
+
+        const glm::vec4 color = glm::unpackUnorm4x8(packed[i].color);
+        for (uint channel = 0; channel < 4; channel++)
+            maxColorError = std::max(maxColorError, std::abs(color[channel] - instances[i].color[channel]));
+    }
+
+    std::cout << std::format("\n{} box instances, {} -> {} bytes each ({:.2f}), packed in {:.2f} ms\n",
+        instances.size(), sizeof(Renderer::BoxInstance), sizeof(Renderer::PackedBoxInstance),
+        static_cast<float>(sizeof(Renderer::PackedBoxInstance)) / sizeof(Renderer::BoxInstance), time);
+    std::cout << std::format("max corner error {:.6f} units, axis error {:.7f} of box scale, max color error {:.6f}\n",
+        maxCornerError, maxRelativeError, maxColorError);
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file RenderQueue.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Benchmark of Renderer::RenderQueue radix sort against std::stable_sort
+ *      for growing packet counts and 1 to N threads, results are checked for order and stability.
+ *      Doesn't need a window or OpenGL context.
+ *      Usage: RenderQueue_bench [max packet count] [max threads]
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include <chrono>
+#include <format>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include "JobSystem.hpp"
+#include "Renderer/RenderQueue.hpp"
+
+using Renderer::RenderQueue;
+
+namespace
+{
+
+constexpr uint Repetitions = 10;
+
+// Few programs, textures and vertex arrays, depths spread over the box field, every tenth packet transparent
+auto make_packets(uint count, std::mt19937& random) -> std::vector<RenderQueue::Packet>
+{
+    std::uniform_int_distribution<uint> state(0, 7);
+    std::uniform_real_distribution<float> depth(0.5f, 200.f);
+
+    std::vector<RenderQueue::Packet> packets(count);
+    for (uint i = 0; i < count; i++)
+    {
+        const auto pass = (i % 10 == 0) ? RenderQueue::Pass::Transparent : RenderQueue::Pass::Opaque;
+        packets[i] = {RenderQueue::make_key(pass, state(random), state(random), state(random), depth(random)), i};
+    }
+
+    return packets;
+}
+
+// Returns best time of all repetitions in milliseconds, setup isn't measured
+template<typename Setup, typename Func>
+auto measure(Setup&& setup, Func&& func) -> double
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (uint i = 0; i < Repetitions; i++)
+    {
+        setup();
+
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    return best;
+}
+
+auto is_stably_sorted(const std::vector<RenderQueue::Packet>& packets) -> bool
+{
+    return std::is_sorted(packets.begin(), packets.end(), [](const auto& a, const auto& b) {
+        return a.key < b.key || (a.key == b.key && a.payload < b.payload);
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const uint maxCount = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const uint maxThreads = argc > 2 ? std::stoul(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+
+    std::mt19937 random{42};
+
+    std::cout << std::format("best of {} runs\n", Repetitions);
+    std::cout << std::format("{:>10} {:>8} {:>12} {:>18} {:>9}\n", "packets", "threads", "radix [ms]", "stable_sort [ms]", "speedup");
+
+    for (uint count = 10'000; count <= maxCount; count *= 10)
+    {
+        const std::vector<RenderQueue::Packet> packets = make_packets(count, random);
+
+        std::vector<RenderQueue::Packet> reference;
+        const double stdTime = measure(
+            [&]() { reference = packets; },
+            [&]() {
+                std::stable_sort(reference.begin(), reference.end(), [](const auto& a, const auto& b) {
+                    return a.key < b.key;
+                });
+            });
+
+        for (uint threads = 1; threads <= maxThreads; threads++)
+        {
+            JobSystem jobs(threads - 1);
+            RenderQueue queue(jobs);
+
+            const double radixTime = measure(
+                [&]() {
+                    queue.clear();
+                    for (const auto& packet : packets)
+                        queue.push(packet.key, packet.payload);
+                },
+                [&]() { queue.sort(); });
+
+            if (!is_stably_sorted(queue.getPackets()))
+            {
+                std::cerr << "Radix sort result is not stably sorted" << std::endl;
+                return -1;
+            }
+
+            std::cout << std::format("{:>10} {:>8} {:>12.3f} {:>18.3f} {:>8.2f}x\n",
+                count, threads, radixTime, stdTime, stdTime / radixTime);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file ShaderCache.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Benchmark of program creation: cold start compiling every program of the renderer
+ *      with an empty program cache one after another and all submitted at once (compiled in parallel
+ *      with KHR_parallel_shader_compile), against warm start loading the binaries it saved.
+ *      Has to be started from the repository root. Usage: ShaderCache_bench
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <chrono>
+#include <format>
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <filesystem>
+
+#include <glad/gl.h>
+
+#include "Renderer/GPU/Shader.hpp"
+#include "Renderer/GPU/Extensions.hpp"
+#include "Renderer/GPU/HeadlessContext.hpp"
+
+namespace
+{
+
+struct Program
+{
+    std::filesystem::path vertex;
+    std::filesystem::path fragment;     // empty for compute shaders
+};
+
+// Every program BoxRenderer can create
+const std::vector<Program> Programs{
+    {"res/shaders/basic.vert", "res/shaders/basic_light.frag"},
+    {"res/shaders/instanced.vert", "res/shaders/instanced_light.frag"},
+    {"res/shaders/impostor.vert", "res/shaders/impostor.frag"},
+    {"res/shaders/indirect.vert", "res/shaders/instanced_light.frag"},
+    {"res/shaders/basic.vert", "res/shaders/instanced_light_array.frag"},
+    {"res/shaders/instanced.vert", "res/shaders/instanced_light_array.frag"},
+    {"res/shaders/indirect.vert", "res/shaders/instanced_light_array.frag"},
+    {"res/shaders/basic.vert", "res/shaders/instanced_light_bindless.frag"},
+    {"res/shaders/instanced.vert", "res/shaders/instanced_light_bindless.frag"},
+    {"res/shaders/indirect.vert", "res/shaders/instanced_light_bindless.frag"},
+    {"res/shaders/cull.comp", {}}
+};
+
+auto is_available(const Program& program) -> bool
+{
+    if (program.fragment.empty())
+        return GLAD_GL_VERSION_4_3 != 0;
+
+    return program.fragment.stem() != "instanced_light_bindless" || GLAD_GL_ARB_bindless_texture != 0;
+}
+
+auto name(const Program& program) -> std::string
+{
+    return program.fragment.empty() ? program.vertex.filename().string() :
+        std::format("{} + {}", program.vertex.filename().string(), program.fragment.filename().string());
+}
+
+auto submit(const Program& program) -> std::unique_ptr<Renderer::GPU::Shader>
+{
+    if (program.fragment.empty())
+        return std::make_unique<Renderer::GPU::Shader>(program.vertex);
+
+    return std::make_unique<Renderer::GPU::Shader>(program.vertex, program.fragment);
+}
+
+// Time until the program is created and linked, in milliseconds
+auto create(const Program& program) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+    submit(program)->Wait();
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Time until every program is linked when all are submitted before waiting for any
+auto create_all(const std::vector<Program>& programs) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<Renderer::GPU::Shader>> shaders;
+    for (const Program& program : programs)
+        shaders.push_back(submit(program));
+
+    for (const auto& shader : shaders)
+        shader->Wait();
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+auto main() -> int
+{
+    Renderer::GPU::HeadlessContext context(64, 64);
+    if (!context.IsValid())
+        return -1;
+
+    int formats{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    std::cout << std::format("{} program binary formats{}, parallel compile: {}\n", formats, formats == 0 ? ", every start compiles" : "",
+        Renderer::GPU::Extensions::Get().HasParallelShaderCompile() ? "yes" : "no");
+
+    std::error_code error;
+    std::filesystem::remove_all(Renderer::GPU::ProgramCacheDirectory, error);
+
+    std::vector<Program> programs;
+    for (const Program& program : Programs)
+        if (is_available(program))
+            programs.push_back(program);
+
+    // The driver may have its own cache, so all at once goes first while nothing was compiled yet
+    const double parallel = create_all(programs);
+    std::filesystem::remove_all(Renderer::GPU::ProgramCacheDirectory, error);
+
+    std::vector<double> cold, warm;
+
+    Renderer::GPU::Shader::ResetCacheStats();
+    for (const Program& program : programs)
+        cold.push_back(create(program));
+    const Renderer::GPU::Shader::CacheStats coldStats = Renderer::GPU::Shader::GetCacheStats();
+
+    Renderer::GPU::Shader::ResetCacheStats();
+    for (const Program& program : programs)
+        warm.push_back(create(program));
+    const Renderer::GPU::Shader::CacheStats warmStats = Renderer::GPU::Shader::GetCacheStats();
+
+    std::cout << std::format("{:<56} {:>10} {:>10}\n", "program", "cold [ms]", "warm [ms]");
+    for (std::size_t i = 0; i < programs.size(); i++)
+        std::cout << std::format("{:<56} {:>10.2f} {:>10.2f}\n", name(programs[i]), cold[i], warm[i]);
+
+    std::cout << std::format("{:<56} {:>10.2f} {:>10.2f}\n", "total", coldStats.loadMs + coldStats.compileMs, warmStats.loadMs + warmStats.compileMs);
+    std::cout << std::format("{:<56} {:>10.2f}\n", "total, submitted at once", parallel);
+    std::cout << std::format("cold: {} compiled, warm: {} loaded, {} compiled, {} rejected\n",
+        coldStats.compiled, warmStats.loaded, warmStats.compiled, warmStats.rejected);
+
+    return 0;
+}
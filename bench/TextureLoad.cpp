@@ -0,0 +1,132 @@
+/**
+ * @file TextureLoad.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Benchmark of texture loading: decoding the image and letting the driver build mipmaps
+ *      against loading its cooked cache file, with load times, VRAM of the mip chains and
+ *      PSNR of the compressed base level. Has to be started from the repository root.
+ *      Usage: TextureLoad_bench [image...]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <chrono>
+#include <format>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+#include <glad/gl.h>
+
+#include "JobSystem.hpp"
+#include "Image/Cook.hpp"
+#include "Renderer/GPU/Texture.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/HeadlessContext.hpp"
+
+namespace
+{
+
+constexpr uint Repetitions = 10;
+
+const std::vector<std::filesystem::path> DefaultImages{
+    "res/textures/container.png",
+    "res/textures/grandfather-face.png"
+};
+
+// Returns best time of all repetitions in milliseconds, GPU work included
+template<typename Func>
+auto measure(Func&& func) -> double
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (uint i = 0; i < Repetitions; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        glFinish();
+        const auto end = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    return best;
+}
+
+// What the texture loader did before cooking: decode, upload base level, glGenerateMipmap
+auto load_uncooked(const std::filesystem::path& path) -> void
+{
+    const std::optional<Image::Bitmap> image = Image::load_image(path);
+    if (!image)
+        return;
+
+    uint texture{};
+    glGenTextures(1, &texture);
+    Renderer::GPU::StateCache::Get().BindTexture(0, GL_TEXTURE_2D, texture);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image->width, image->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image->pixels.data());
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    Renderer::GPU::StateCache::Get().ForgetTexture(texture);
+    glDeleteTextures(1, &texture);
+}
+
+auto mip_chain_bytes(uint width, uint height) -> std::size_t
+{
+    std::size_t bytes = 0;
+    for (const Image::Bitmap& level : Image::build_mips({width, height, std::vector<uchar>(static_cast<std::size_t>(width) * height * Image::BytesPerPixel)}))
+        bytes += level.size();
+
+    return bytes;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    std::vector<std::filesystem::path> images(argv + 1, argv + argc);
+    if (images.empty())
+        images = DefaultImages;
+
+    Renderer::GPU::HeadlessContext context(64, 64);
+    if (!context.IsValid())
+        return -1;
+
+    JobSystem jobs;
+
+    std::cout << std::format("best of {} runs\n", Repetitions);
+    std::cout << std::format("{:<24} {:>6} {:>10} {:>12} {:>12} {:>12} {:>12} {:>10}\n",
+        "image", "format", "cook [ms]", "decode [ms]", "cooked [ms]", "VRAM [KB]", "cooked [KB]", "PSNR [dB]");
+
+    for (const std::filesystem::path& path : images)
+    {
+        const std::optional<Image::Bitmap> image = Image::load_image(path);
+        if (!image)
+        {
+            std::cerr << "Failed to load " << path << std::endl;
+            return -1;
+        }
+
+        const auto cookStart = std::chrono::steady_clock::now();
+        const Image::CookedTexture cooked = Image::cook(*image, Image::choose_format(*image), &jobs);
+        const double cookTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cookStart).count();
+
+        // Fills the cache, timed loads below only read it
+        if (!Image::cook_cached(path, std::nullopt, &jobs))
+            return -1;
+
+        const double decodeTime = measure([&]() { load_uncooked(path); });
+        const double cookedTime = measure([&]() { const Renderer::GPU::Texture texture(path); });
+
+        const Image::Bitmap decoded = Image::decompress(cooked.data.data(), cooked.format, cooked.width, cooked.height);
+
+        std::cout << std::format("{:<24} {:>6} {:>10.2f} {:>12.2f} {:>12.2f} {:>12.1f} {:>12.1f} {:>10.2f}\n",
+            path.filename().string(), Image::to_string(cooked.format), cookTime, decodeTime, cookedTime,
+            mip_chain_bytes(image->width, image->height) / 1024.0, cooked.data.size() / 1024.0, Image::psnr(*image, decoded));
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file Benchmark.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Headless, deterministic benchmark of the box scene: fixed seed and box count,
+ *      scripted camera path, frame statistics as JSON and comparison against a baseline
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <filesystem>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "Renderer/BoxRenderer.hpp"
+
+#include "jac/type_defs.hpp"
+
+struct BenchmarkConfig {
+    uint width = 1280;          // --width <pixels>
+    uint height = 720;          // --height <pixels>
+    uint boxCount = 8000;       // --boxes <count>
+    uint seed = 1;              // --seed <number>
+    uint frames = 600;          // --frames <count>, measured frames, one full camera loop
+    uint warmup = 60;           // --warmup <count>, frames rendered before measuring
+
+    Renderer::BoxRenderer::Mode mode = Renderer::BoxRenderer::Mode::Instanced;     // --mode <perbox|instanced|indirect>
+    Renderer::BoxRenderer::Culling culling = Renderer::BoxRenderer::Culling::Simd; // --culling <none|simd|bvh>
+    bool animate = false;       // --animate, spins first box group
+    bool sorting = true;        // --unsorted, submits boxes without the render queue
+    bool verify = false;        // --verify, checks every indirect frame's GPU culling against the CPU
+    bool lod = true;            // --no-lod, always draws the full mesh
+    bool streamTextures = false;    // --stream-textures, textures go through TextureStreamer
+    Renderer::BoxRenderer::Texturing texturing = Renderer::BoxRenderer::Texturing::Slots;   // --texturing <slots|array|bindless>
+
+    std::optional<std::filesystem::path> output{};      // --out <path>, stdout if not given
+    std::optional<std::filesystem::path> baseline{};    // --baseline <path>, result of an earlier run
+    double tolerance = 0.10;    // --tolerance <fraction>, allowed slowdown against baseline
+    std::optional<std::filesystem::path> trace{};       // --trace-out <path>, needs -DProfiler=ON
+}; // struct BenchmarkConfig
+
+/**
+ * @brief Parses benchmark options, flags it doesn't know (like --headless) are skipped
+ * 
+ * @param args program arguments
+ * @retval std::optional<BenchmarkConfig> config, nothing if a value is missing or invalid
+ */
+auto parse_benchmark_config(const std::vector<std::string_view>& args) -> std::optional<BenchmarkConfig>;
+
+/**
+ * @brief Camera position on the scripted path, loops every full turn of t
+ * 
+ * @param t progress along the path, 1.0 is one loop
+ * @retval glm::vec3 camera position, camera always looks at the origin
+ */
+auto benchmark_camera_path(float t) -> glm::vec3;
+
+/**
+ * @brief Renders the scene offscreen and reports frame statistics as JSON
+ * 
+ * @retval int 0 - success, 1 - slower than baseline by more than tolerance,
+ *      2 - GPU culling didn't match the CPU (--verify), -1 - failed to run
+ */
+auto run_benchmark(const BenchmarkConfig& config) -> int;
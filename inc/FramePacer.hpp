@@ -0,0 +1,86 @@
+/**
+ * @file FramePacer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Limits frame rate either by vsync, or by sleeping until the next frame deadline
+ *      and spinning only for the last fraction of a millisecond. Measures pacing jitter.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+#include "jac/type_defs.hpp"
+
+class FramePacer
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Duration = std::chrono::duration<double>;
+
+        enum class Mode {
+            VSync,      // swap waits for vertical blank (glfwSwapInterval(1))
+            Uncapped,   // no limit
+            Target      // sleep + spin until the target frame rate deadline
+        };
+
+        /**
+         * @brief Frame interval statistics since last reset. Error is (measured interval - target period)
+         *      and is only measured in Target mode, other modes have no period to compare with and leave it 0
+         */
+        struct Jitter {
+            uint frames{};
+            double meanInterval{};  // ms
+            double meanAbsError{};  // ms, from the target period, Target mode only (0 otherwise)
+            double stddev{};        // ms, of the interval
+            double maxAbsError{};   // ms, from the target period, Target mode only (0 otherwise)
+        }; // struct Jitter
+
+        explicit FramePacer(Mode mode = Mode::Target, double targetRate = 60.0);
+
+        /**
+         * @brief Changes mode, swap interval of the current GLFW context (if there is one) is updated
+         */
+        auto setMode(Mode mode) -> void;
+        auto setTargetRate(double rate) -> void;
+
+        /**
+         * @brief Call once per frame after swapping buffers, in Target mode blocks until the next deadline
+         */
+        auto wait() -> void;
+
+        /**
+         * @brief Jitter of frames since the last call to resetJitter()
+         */
+        [[nodiscard]] auto getJitter() const -> Jitter;
+        auto resetJitter() -> void;
+
+        [[nodiscard]] inline auto getMode() const -> Mode { return m_mode; }
+        [[nodiscard]] inline auto getTargetRate() const -> double { return m_targetRate; }
+
+        static auto to_string(Mode mode) -> std::string_view;
+    private:
+        Mode m_mode;
+        double m_targetRate;
+        Duration m_period;
+
+        Clock::time_point m_deadline{};
+        Clock::time_point m_lastFrame{};
+
+        // How much earlier than the deadline to stop sleeping, adapts to measured oversleep
+        Duration m_spinMargin{0.001};
+
+        // Running sums for Jitter, errors against target are only meaningful in Target mode
+        uint m_frames{};
+        double m_sumInterval{};
+        double m_sumIntervalSquared{};
+        double m_sumAbsError{};
+        double m_maxAbsError{};
+
+        auto sleepUntil(Clock::time_point deadline) -> void;
+        auto record(Duration interval) -> void;
+}; // class FramePacer
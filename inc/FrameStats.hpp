@@ -0,0 +1,148 @@
+/**
+ * @file FrameStats.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Per-frame CPU time statistics split into phases, percentiles from histograms,
+ *      hitch counting and periodic export to JSON lines or CSV
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <vector>
+#include <fstream>
+#include <optional>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "jac/type_defs.hpp"
+
+class FrameStats
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        enum Phase : uint {
+            Input,
+            Update,
+            Submit,
+            Swap,
+            Total,      // sum of all phases, not marked directly
+            PhaseCount
+        };
+
+        enum class Format {
+            JsonLines,
+            CSV
+        };
+
+        struct Percentiles {
+            double mean{};
+            double p50{};
+            double p95{};
+            double p99{};
+            double max{};
+        }; // struct Percentiles
+
+        struct Summary {
+            uint frames{};
+            uint hitches{};
+            double duration{};  // seconds covered by the summary
+            std::array<Percentiles, PhaseCount> phases{};   // in ms
+        }; // struct Summary
+
+        /**
+         * @param capacity number of recent frames kept in the ring buffer
+         */
+        explicit FrameStats(uint capacity = 1024);
+        ~FrameStats();
+
+        FrameStats(const FrameStats&) = delete;
+        FrameStats(FrameStats&&) = delete;
+        auto operator=(const FrameStats&) -> FrameStats& = delete;
+        auto operator=(FrameStats&&) -> FrameStats& = delete;
+
+        /**
+         * @brief Writes a summary line to the file every interval seconds (0 - only on exit),
+         *      statistics are reset after every written line
+         */
+        auto exportTo(const std::filesystem::path& path, Format format, double interval = 0.0) -> bool;
+
+        auto beginFrame() -> void;
+
+        /**
+         * @brief Ends phase, its time is measured from the previous mark (or beginFrame)
+         */
+        auto mark(Phase phase) -> void;
+
+        /**
+         * @brief Closes the frame, time between last mark and this call is not counted
+         */
+        auto endFrame() -> void;
+
+        /**
+         * @brief Frames slower than factor * moving average frame time count as hitches
+         */
+        inline auto setHitchFactor(double factor) -> void { m_hitchFactor = factor; }
+
+        /**
+         * @brief Statistics of frames since last export or reset
+         */
+        [[nodiscard]] auto summary() const -> Summary;
+        auto reset() -> void;
+
+        /**
+         * @brief Writes current summary to the export file (if any, and unless no frame ended since the last flush)
+         *      and resets statistics
+         */
+        auto flush() -> void;
+
+        /**
+         * @brief Times of the last frames, oldest first
+         */
+        [[nodiscard]] auto recent() const -> std::vector<std::array<float, PhaseCount>>;
+
+        [[nodiscard]] inline auto getFrameCount() const -> uint64_t { return m_totalFrames; }
+
+        static auto to_string(Phase phase) -> std::string_view;
+        static auto to_json(const Summary& summary) -> std::string;
+    private:
+        // Histogram of frame times, BinWidth ms per bin, times above the last bin go to the last one
+        static constexpr double BinWidth = 0.05;
+        static constexpr uint BinCount = 4000;     // up to 200 ms
+
+        struct Histogram {
+            std::array<uint, BinCount> bins{};
+            double sum{};
+            double max{};
+            uint count{};
+
+            auto add(double ms) -> void;
+            [[nodiscard]] auto percentile(double p) const -> double;
+        };
+
+        std::vector<std::array<float, PhaseCount>> m_ring;
+        uint m_ringHead{};
+        uint64_t m_totalFrames{};
+
+        std::array<Histogram, PhaseCount> m_histograms{};
+        uint m_hitches{};
+        double m_hitchFactor{2.0};
+        double m_averageFrame{};
+
+        std::array<float, PhaseCount> m_current{};
+        Clock::time_point m_lastMark{};
+        Clock::time_point m_windowStart{};
+
+        std::optional<std::ofstream> m_file{};
+        Format m_format{Format::JsonLines};
+        double m_interval{};
+        Clock::time_point m_lastExport{};
+
+        auto write(const Summary& summary) -> void;
+}; // class FrameStats
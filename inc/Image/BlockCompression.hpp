@@ -0,0 +1,66 @@
+/**
+ * @file BlockCompression.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief BC1/BC3/BC7 block compression of RGBA8 images, 4x4 pixel blocks with endpoints
+ *      fitted along the principal axis of their colors
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <string_view>
+
+#include "JobSystem.hpp"
+#include "Image/Image.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Image
+{
+
+enum class Format : uint {
+    RGBA8,  // uncompressed, 4 bytes per pixel
+    BC1,    // DXT1, opaque RGB, 0.5 byte per pixel
+    BC3,    // DXT5, BC1 color with separately coded alpha, 1 byte per pixel
+    BC7     // BPTC, mode 6 only (one subset, RGBA), 1 byte per pixel
+};
+
+constexpr uint BlockSize = 4;
+
+/**
+ * @retval uint bytes of one 4x4 block, 0 for uncompressed formats
+ */
+auto block_bytes(Format format) -> uint;
+
+/**
+ * @brief Size of image data of given size, partial blocks on the edges take a whole block
+ */
+auto data_bytes(Format format, uint width, uint height) -> std::size_t;
+
+/**
+ * @brief Compresses image, blocks in the same order as the rows (bottom one first).
+ *      Pixels of partial edge blocks are repeated
+ *
+ * @param jobs optional, block rows are compressed in parallel with it
+ */
+auto compress(const Bitmap& image, Format format, JobSystem* jobs = nullptr) -> std::vector<uchar>;
+
+/**
+ * @brief Decodes compressed data back to RGBA8, for measuring quality or drivers without the format
+ */
+auto decompress(const uchar* data, Format format, uint width, uint height) -> Bitmap;
+
+/**
+ * @retval double peak signal to noise ratio of RGBA channels in dB, infinity for equal images
+ */
+auto psnr(const Bitmap& a, const Bitmap& b) -> double;
+
+auto to_string(Format format) -> std::string_view;
+auto parse_format(std::string_view name) -> std::optional<Format>;
+
+} // namespace Image
@@ -0,0 +1,100 @@
+/**
+ * @file Cook.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Offline texture cooking: full mip chain, optionally block compressed, written to
+ *      a cache file keyed by the content hash of the source image so later loads skip
+ *      decoding, flipping and mip generation
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <filesystem>
+
+#include "JobSystem.hpp"
+#include "Image/Image.hpp"
+#include "Image/BlockCompression.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Image
+{
+
+inline const std::filesystem::path CacheDirectory{"res/cache/textures"};
+inline const std::filesystem::path CookedExtension{".tex"};
+
+struct CookedLevel {
+    uint width{};
+    uint height{};
+    std::size_t offset{};   // in CookedTexture::data
+    std::size_t size{};
+}; // struct CookedLevel
+
+struct CookedTexture {
+    Format format{Format::RGBA8};
+    uint width{};
+    uint height{};
+    uint64_t sourceHash{};
+
+    std::vector<CookedLevel> levels{};   // finest first
+    std::vector<uchar> data{};          // all levels back to back
+}; // struct CookedTexture
+
+/**
+ * @brief BC1 for opaque images, BC3 otherwise
+ */
+auto choose_format(const Bitmap& image) -> Format;
+
+/**
+ * @brief Builds mip chain of the image and compresses every level
+ *
+ * @param jobs optional, mip filtering and compression run in parallel with it
+ */
+auto cook(Bitmap image, Format format, JobSystem* jobs = nullptr) -> CookedTexture;
+
+/**
+ * @brief File layout: "TEXC", version, format, width, height, level count, source hash,
+ *      then width, height, offset and size of each level followed by the level data
+ */
+auto write_cooked(const std::filesystem::path& path, const CookedTexture& texture) -> bool;
+
+/**
+ * @brief Reads header and level table, then all level data with a single read
+ */
+auto read_cooked(const std::filesystem::path& path) -> std::optional<CookedTexture>;
+
+/**
+ * @brief 64-bit FNV-1a of the file contents, mixed with the requested format, size and file version
+ *
+ * @param format std::nullopt for automatic choice
+ * @param width, height requested size, 0 for the size of the image
+ */
+auto hash_file(const std::filesystem::path& path, std::optional<Format> format, uint width = 0, uint height = 0) -> std::optional<uint64_t>;
+
+/**
+ * @retval path of the cache file for a source with given hash, CacheDirectory/<stem>-<hash>.tex
+ */
+auto cache_path(const std::filesystem::path& source, uint64_t hash) -> std::filesystem::path;
+
+/**
+ * @brief Reads cooked texture from the cache, cooking and writing it on the first load.
+ *      A changed source gets a new hash and so a new cache file
+ *
+ * @param format std::nullopt to pick it with choose_format
+ * @param width, height image is resized to this size before cooking, 0 keeps its size
+ * @retval std::nullopt if the source can't be read or decoded
+ */
+auto cook_cached(
+    const std::filesystem::path& source,
+    std::optional<Format> format = std::nullopt,
+    JobSystem* jobs = nullptr,
+    uint width = 0,
+    uint height = 0
+) -> std::optional<CookedTexture>;
+
+} // namespace Image
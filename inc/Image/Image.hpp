@@ -0,0 +1,65 @@
+/**
+ * @file Image.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief RGBA8 images on the CPU, decoding and mip chain generation shared by texture
+ *      loading, streaming and offline cooking
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <filesystem>
+
+#include "JobSystem.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Image
+{
+
+constexpr uint BytesPerPixel = 4;
+
+struct Bitmap {
+    uint width{};
+    uint height{};
+    std::vector<uchar> pixels{};    // RGBA8, bottom row first as OpenGL expects
+
+    [[nodiscard]] inline auto size() const -> std::size_t { return static_cast<std::size_t>(width) * height * BytesPerPixel; }
+
+    /**
+     * @retval bool every alpha value is 255
+     */
+    [[nodiscard]] auto isOpaque() const -> bool;
+}; // struct Bitmap
+
+/**
+ * @brief Decodes image file into RGBA8, rows flipped so the first one is the bottom one.
+ *      Thread safe, unlike stb_image's global flip flag
+ */
+auto load_image(const std::filesystem::path& path) -> std::optional<Bitmap>;
+
+/**
+ * @brief Halves image with a 2x2 box filter (SSE2 where available), sizes are rounded down
+ *      and odd last rows or columns are dropped, 1 pixel wide sides are repeated instead
+ *
+ * @param jobs optional, rows are filtered in parallel with it
+ */
+auto downsample(const Bitmap& image, JobSystem* jobs = nullptr) -> Bitmap;
+
+/**
+ * @brief Scales image to given size with bilinear filtering, pixel centers are aligned.
+ *      Meant for fitting images to a common size, shrinking by more than half skips pixels
+ */
+auto resize(const Bitmap& image, uint width, uint height) -> Bitmap;
+
+/**
+ * @brief Full mip chain down to 1x1, image itself first
+ */
+auto build_mips(Bitmap image, JobSystem* jobs = nullptr) -> std::vector<Bitmap>;
+
+} // namespace Image
@@ -8,6 +8,7 @@
 
 #include <glm/vec3.hpp>
 
+#include "Profiler.hpp"
 #include "Renderer/Camera.hpp"
 
 #include "jac/type_defs.hpp"
@@ -38,6 +38,8 @@ Input<State>::~Input() noexcept
 template <typename State>
 auto Input<State>::update() noexcept -> void
 {
+    PROFILE_ZONE("Input::update");
+
     glfwPollEvents();
 
     handleKeyboard(getDelta());
@@ -0,0 +1,158 @@
+/**
+ * @file JobSystem.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Work-stealing job scheduler, every worker owns a deque it pops from the back
+ *      while idle workers steal from the front of the others
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <mutex>
+#include <algorithm>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <condition_variable>
+
+#include "jac/type_defs.hpp"
+
+class JobSystem
+{
+    public:
+        using Job = std::function<void()>;
+
+        /**
+         * @brief Counts unfinished jobs, jobs can be scheduled to run once counter reaches zero
+         */
+        class Counter
+        {
+            public:
+                Counter() = default;
+                ~Counter() = default;
+
+                Counter(const Counter&) = delete;
+                Counter(Counter&&) = delete;
+                auto operator=(const Counter&) -> Counter& = delete;
+                auto operator=(Counter&&) -> Counter& = delete;
+
+                [[nodiscard]] inline auto isDone() const -> bool { return m_pending.load(std::memory_order_acquire) == 0; }
+            private:
+                friend class JobSystem;
+
+                struct Continuation {
+                    Job job;
+                    Counter* counter;
+                };
+
+                std::atomic<uint> m_pending{0};
+                std::mutex m_mutex{};
+                std::vector<Continuation> m_continuations{};
+        }; // class Counter
+
+        /**
+         * @param workerCount number of worker threads, thread calling wait() helps executing jobs as well
+         */
+        explicit JobSystem(uint workerCount = default_worker_count());
+
+        /**
+         * @brief Runs every job still queued and the continuations they release before returning,
+         *      nothing may be scheduled from outside the jobs meanwhile
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        auto operator=(const JobSystem&) -> JobSystem& = delete;
+        auto operator=(JobSystem&&) -> JobSystem& = delete;
+
+        /**
+         * @brief Schedules job for execution
+         * 
+         * @param counter optional counter, incremented now and decremented after the job is done
+         */
+        auto schedule(Job job, Counter* counter = nullptr) -> void;
+
+        /**
+         * @brief Schedules job to run after all jobs tracked by dependency are done
+         */
+        auto scheduleAfter(Counter& dependency, Job job, Counter* counter = nullptr) -> void;
+
+        /**
+         * @brief Blocks until counter reaches zero, executing other jobs in the meantime
+         */
+        auto wait(Counter& counter) -> void;
+
+        /**
+         * @brief Splits [begin, end) into chunks of at most grain elements and runs
+         *      func(chunkBegin, chunkEnd) for each of them in parallel, returns when all are done
+         */
+        template<typename Func>
+        auto parallel_for(uint begin, uint end, uint grain, Func&& func) -> void;
+
+        /**
+         * @brief Number of threads executing jobs, including the thread that waits
+         */
+        [[nodiscard]] inline auto getThreadCount() const -> uint { return m_threads.size() + 1; }
+
+        static auto default_worker_count() -> uint;
+    private:
+        struct Task {
+            Job job;
+            Counter* counter;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        // Queue 0 belongs to threads that are not workers (main thread)
+        std::vector<std::unique_ptr<Queue>> m_queues{};
+        std::vector<std::thread> m_threads{};
+
+        std::atomic<bool> m_running{true};
+        std::atomic<uint> m_queued{0};
+        std::mutex m_sleepMutex{};
+        std::condition_variable m_wakeUp{};
+
+        auto push(Task task) -> void;
+        auto pop(Task& task) -> bool;
+        auto execute(Task& task) -> void;
+        auto finish(Counter* counter) -> void;
+
+        [[nodiscard]] auto workerIndex() const -> uint;
+
+        auto workerLoop(uint index) -> void;
+}; // class JobSystem
+
+template<typename Func>
+auto JobSystem::parallel_for(uint begin, uint end, uint grain, Func&& func) -> void
+{
+    if (begin >= end)
+        return;
+
+    grain = std::max(grain, 1u);
+
+    if (end - begin <= grain)
+    {
+        func(begin, end);
+        return;
+    }
+
+    Counter counter;
+
+    for (uint chunk = begin; chunk < end; chunk += grain)
+    {
+        const uint chunkEnd = std::min(end, chunk + grain);
+        schedule([&func, chunk, chunkEnd]() { func(chunk, chunkEnd); }, &counter);
+    }
+
+    wait(counter);
+}
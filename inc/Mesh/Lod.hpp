@@ -0,0 +1,67 @@
+/**
+ * @file Lod.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Level of detail chains, meshes simplified in steps and stored together so they
+ *      can be generated offline (MeshLod tool) and loaded into a single vertex/index buffer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <filesystem>
+
+#include "Mesh/Mesh.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+struct LodChain {
+    struct Level {
+        uint firstIndex;
+        uint indexCount;
+        uint baseVertex;
+        float error;    // geometric error against level 0, in mesh units
+    }; // struct Level
+
+    // Levels from the most detailed one, every level has its own vertex and index range
+    std::vector<Vertex> vertices{};
+    std::vector<uint> indices{};    // relative to the level's base vertex
+    std::vector<Level> levels{};
+    float radius{};                 // bounding sphere of level 0 around the origin
+
+    [[nodiscard]] inline auto triangleCount(uint level) const -> uint { return levels[level].indexCount / 3; }
+}; // struct LodChain
+
+struct LodSettings {
+    uint maxLevels = 6;             // level 0 included
+    float ratio = 0.5f;             // triangles kept from one level to the next
+    float maxRelativeError = 0.5f;  // levels with error above this fraction of the radius aren't kept
+    bool optimize = true;           // reorder every level for vertex cache, overdraw and vertex fetch
+}; // struct LodSettings
+
+/**
+ * @brief Simplifies mesh into a chain of levels, every level is simplified from the original mesh.
+ *      Chain stops early when simplification can't remove enough triangles or the error gets too big
+ */
+auto build_lod_chain(const IndexedMesh& mesh, const LodSettings& settings = {}) -> LodChain;
+
+auto write_lod_chain(const std::filesystem::path& path, const LodChain& chain) -> bool;
+
+/**
+ * @retval std::optional<LodChain> chain, nothing if the file is missing or isn't a LOD chain
+ */
+auto read_lod_chain(const std::filesystem::path& path) -> std::optional<LodChain>;
+
+/**
+ * @brief Reads chain generated offline, if there is none builds it from the model now
+ */
+auto load_lod_chain(const std::filesystem::path& chainPath, const std::filesystem::path& modelPath) -> LodChain;
+
+} // namespace Mesh
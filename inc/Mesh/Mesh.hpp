@@ -0,0 +1,49 @@
+/**
+ * @file Mesh.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Indexed triangle mesh used by offline mesh processing (simplification, LOD chains)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Renderer/Model.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+struct Vertex {
+    glm::vec3 position;
+    glm::vec2 texCoord;
+}; // struct Vertex
+
+struct IndexedMesh {
+    std::vector<Vertex> vertices{};
+    std::vector<uint> indices{};    // triangle list
+
+    [[nodiscard]] inline auto triangleCount() const -> uint { return indices.size() / 3; }
+
+    /**
+     * @brief Radius of sphere centered at the origin enclosing all vertices
+     */
+    [[nodiscard]] auto radius() const -> float;
+}; // struct IndexedMesh
+
+/**
+ * @brief Welds identical vertices of a non-indexed triangle list model
+ *
+ * @param model model with position (3 floats) and texture coordinates (2 floats) layout
+ * @retval IndexedMesh indexed mesh, empty if the layout doesn't match
+ */
+auto from_model(const Renderer::Model& model) -> IndexedMesh;
+
+} // namespace Mesh
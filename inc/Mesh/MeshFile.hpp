@@ -0,0 +1,103 @@
+/**
+ * @file MeshFile.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Binary mesh container: header, vertex layout, bounds and aligned vertex and index
+ *      blobs. Files are memory mapped and the blobs handed to GPU buffers without parsing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+#include <filesystem>
+
+#include "Mesh/Obj.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Scene/AABB.hpp"
+#include "Renderer/Model.hpp"
+#include "Renderer/GPU/VertexBufferLayout.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+inline const std::filesystem::path MeshExtension{".mesh"};
+
+// Vertex and index blobs start at multiples of this, so they can be used in place by any attribute type
+constexpr std::size_t MeshBlobAlignment = 64;
+
+/**
+ * @brief Mesh in memory, what gets written to a mesh file
+ */
+struct MeshData {
+    Renderer::GPU::VertexBufferLayout layout{};
+    std::vector<uchar> vertices{};  // vertexCount * layout stride bytes
+    std::vector<uint> indices{};    // triangle list, empty for non-indexed meshes
+    uint vertexCount{};
+    Scene::AABB bounds{};           // of the first attribute, if it is a float 3 position
+}; // struct MeshData
+
+/**
+ * @brief Non-indexed mesh with the model's layout kept as it is
+ */
+auto to_mesh_data(const Renderer::Model& model) -> MeshData;
+
+/**
+ * @brief Indexed mesh with position (3 floats) and texture coordinates (2 floats) layout
+ */
+auto to_mesh_data(const IndexedMesh& mesh) -> MeshData;
+
+/**
+ * @brief Indexed mesh with position (3 floats), texture coordinates (2 floats) and normal (3 floats) layout,
+ *      submeshes and materials aren't kept
+ */
+auto to_mesh_data(const ObjMesh& mesh) -> MeshData;
+
+/**
+ * @brief File layout: "MESH", version, attribute count, stride, vertex count, index count,
+ *      bounds, vertex and index blob offsets, then count, type and normalization of every
+ *      attribute, followed by both blobs padded to MeshBlobAlignment
+ */
+auto write_mesh(const std::filesystem::path& path, const MeshData& mesh) -> bool;
+
+/**
+ * @brief Read-only mapping of a mesh file. Only the header and the attribute table are
+ *      read, blob sizes are checked against the file size but index values aren't
+ */
+class MappedMesh
+{
+    public:
+        explicit MappedMesh(const std::filesystem::path& path);
+        ~MappedMesh();
+
+        MappedMesh(const MappedMesh&) = delete;
+        MappedMesh(MappedMesh&&) = delete;
+        auto operator=(const MappedMesh&) -> MappedMesh& = delete;
+        auto operator=(MappedMesh&&) -> MappedMesh& = delete;
+
+        [[nodiscard]] inline auto isValid() const -> bool { return m_mapping != nullptr; }
+
+        [[nodiscard]] inline auto getLayout() const -> const Renderer::GPU::VertexBufferLayout& { return m_layout; }
+        [[nodiscard]] inline auto getVertexData() const -> std::span<const uchar> { return m_vertices; }
+        [[nodiscard]] inline auto getIndices() const -> std::span<const uint> { return m_indices; }
+        [[nodiscard]] inline auto getVertexCount() const -> uint { return m_vertexCount; }
+        [[nodiscard]] inline auto getBounds() const -> const Scene::AABB& { return m_bounds; }
+    private:
+        auto unmap() -> void;
+
+        void* m_mapping{};
+        std::size_t m_size{};
+
+        Renderer::GPU::VertexBufferLayout m_layout{};
+        std::span<const uchar> m_vertices{};
+        std::span<const uint> m_indices{};
+        uint m_vertexCount{};
+        Scene::AABB m_bounds{};
+}; // class MappedMesh
+
+} // namespace Mesh
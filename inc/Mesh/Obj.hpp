@@ -0,0 +1,96 @@
+/**
+ * @file Obj.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Wavefront OBJ and MTL importer. Files are parsed in parallel chunks with std::from_chars
+ *      and corners are deduplicated into an indexed mesh split by material
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <filesystem>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "JobSystem.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Scene/AABB.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+struct ObjVertex {
+    glm::vec3 position;
+    glm::vec2 texCoord;
+    glm::vec3 normal;
+}; // struct ObjVertex
+
+struct ObjMaterial {
+    std::string name{};
+    glm::vec3 ambient{1.f};                 // Ka
+    glm::vec3 diffuse{0.8f};                // Kd
+    glm::vec3 specular{0.f};                // Ks
+    glm::vec3 emissive{0.f};                // Ke
+    float shininess{};                      // Ns
+    float opacity{1.f};                     // d, or 1 - Tr
+    float refraction{1.f};                  // Ni
+    uint illumination{};                    // illum
+    std::filesystem::path diffuseMap{};     // map_Kd, relative to the MTL file's directory
+}; // struct ObjMaterial
+
+// Consecutive faces using the same material
+struct ObjSubmesh {
+    static constexpr uint NoMaterial = ~0u;
+
+    uint firstIndex;
+    uint indexCount;
+    uint material;  // in ObjMesh::materials, NoMaterial for faces before any usemtl
+}; // struct ObjSubmesh
+
+struct ObjMesh {
+    std::vector<ObjVertex> vertices{};
+    std::vector<uint> indices{};                    // triangle list
+    std::vector<ObjSubmesh> submeshes{};
+    std::vector<ObjMaterial> materials{};           // every name used by usemtl, filled from MTL files by read_obj
+    std::vector<std::string> materialLibraries{};   // mtllib files, relative to the OBJ file
+    Scene::AABB bounds{};                           // of all positions, referenced or not
+    bool hasTexCoords{};
+    bool hasNormals{};
+
+    [[nodiscard]] inline auto triangleCount() const -> uint { return indices.size() / 3; }
+}; // struct ObjMesh
+
+/**
+ * @brief Parses OBJ text. Positions, texture coordinates, normals, faces (split into triangle fans,
+ *      negative indices allowed), usemtl and mtllib are read, everything else is skipped
+ *
+ * @param jobs optional, text is split into chunks parsed in parallel with it
+ * @retval std::optional<ObjMesh> mesh, nothing if a face refers to vertex data that doesn't exist
+ */
+auto parse_obj(std::string_view text, JobSystem* jobs = nullptr) -> std::optional<ObjMesh>;
+
+/**
+ * @brief Reads and parses OBJ file, then materials from its MTL files
+ */
+auto read_obj(const std::filesystem::path& path, JobSystem* jobs = nullptr) -> std::optional<ObjMesh>;
+
+/**
+ * @retval std::vector<ObjMaterial> materials in the file, empty if it can't be opened
+ */
+auto read_mtl(const std::filesystem::path& path) -> std::vector<ObjMaterial>;
+
+/**
+ * @brief Drops normals and materials, e.g. for simplification
+ */
+auto to_indexed_mesh(const ObjMesh& mesh) -> IndexedMesh;
+
+} // namespace Mesh
@@ -0,0 +1,109 @@
+/**
+ * @file Optimize.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Index and vertex reordering for the GPU: post-transform vertex cache (Tipsify),
+ *      overdraw (clusters sorted outside-in) and vertex fetch (vertices in order of first use),
+ *      with CPU analysis of all three so results can be checked without a GPU
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Mesh/Obj.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Mesh/MeshFile.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+// Vertices in a FIFO post-transform cache, typical for hardware since ~2010
+constexpr uint DefaultCacheSize = 16;
+
+struct VertexCacheStats {
+    float acmr{};   // average cache miss ratio, transformed vertices per triangle (0.5 - 3)
+    float atvr{};   // average transformed vertex ratio, transformed per used vertex (1 - 6)
+}; // struct VertexCacheStats
+
+struct OptimizeSettings {
+    uint cacheSize = DefaultCacheSize;
+    float overdrawThreshold = 1.05f;    // how much worse than Tipsify's ACMR clusters may make it, 0 skips overdraw ordering
+}; // struct OptimizeSettings
+
+struct OptimizeReport {
+    struct Stats {
+        VertexCacheStats cache;
+        float overfetch;    // bytes read from vertex buffer in 64 byte lines per vertex byte
+        float overdraw;     // fragments shaded per covered pixel, averaged over 6 axis views
+    }; // struct Stats
+
+    Stats before{};
+    Stats after{};
+}; // struct OptimizeReport
+
+/**
+ * @brief Simulates FIFO cache over a triangle list
+ */
+auto analyze_vertex_cache(std::span<const uint> indices, uint vertexCount, uint cacheSize = DefaultCacheSize) -> VertexCacheStats;
+
+/**
+ * @brief Simulates 64 byte cache lines read while fetching vertices of vertexSize bytes
+ *
+ * @retval float 1 when every vertex byte is read once
+ */
+auto analyze_vertex_fetch(std::span<const uint> indices, uint vertexCount, uint vertexSize) -> float;
+
+/**
+ * @brief Rasterizes triangles with depth test from both sides of each axis, counts fragments
+ *      that pass it at the time they're drawn against pixels covered at the end
+ *
+ * @retval float 1 without overdraw
+ */
+auto analyze_overdraw(std::span<const uint> indices, std::span<const glm::vec3> positions) -> float;
+
+/**
+ * @brief Tipsify (Sander, Nehab, Barczak 2007): fans around recently used vertices,
+ *      jumping to vertices still in cache with live triangles, linear in triangle count
+ */
+auto optimize_vertex_cache(std::span<const uint> indices, uint vertexCount, uint cacheSize = DefaultCacheSize) -> std::vector<uint>;
+
+/**
+ * @brief Splits cache optimized triangles into clusters where ACMR stays within threshold of
+ *      the whole list, then draws clusters facing away from the mesh center first, so they
+ *      occlude the rest from most views
+ */
+auto optimize_overdraw(std::span<const uint> indices, std::span<const glm::vec3> positions, uint cacheSize = DefaultCacheSize,
+    float threshold = OptimizeSettings{}.overdrawThreshold) -> std::vector<uint>;
+
+/**
+ * @retval std::vector<uint> new position of every vertex in order of first use, unused vertices get ~0u
+ */
+auto vertex_fetch_remap(std::span<const uint> indices, uint vertexCount) -> std::vector<uint>;
+
+/**
+ * @brief Runs all three stages, vertex cache and overdraw ordering within every index range,
+ *      then vertex fetch over the whole mesh. Unused vertices are removed
+ */
+auto optimize_mesh(IndexedMesh& mesh, const OptimizeSettings& settings = {}) -> OptimizeReport;
+
+/**
+ * @brief Submeshes are reordered separately and keep their ranges
+ */
+auto optimize_mesh(ObjMesh& mesh, const OptimizeSettings& settings = {}) -> OptimizeReport;
+
+/**
+ * @brief Overdraw ordering needs the first attribute to be a float 3 position, it is skipped otherwise.
+ *      Non-indexed meshes are left as they are
+ */
+auto optimize_mesh(MeshData& mesh, const OptimizeSettings& settings = {}) -> OptimizeReport;
+
+} // namespace Mesh
@@ -0,0 +1,39 @@
+/**
+ * @file Quantize.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Re-encoding of float vertex attributes into half floats, normalized 16 bit integers
+ *      and 10-10-10-2 normals, which shaders read the same way as the floats they replace
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include "Mesh/MeshFile.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+struct QuantizeReport {
+    std::vector<float> maxError{};  // per attribute of the original layout, largest difference of a decoded component, 0 if kept
+    uint strideBefore{};
+    uint strideAfter{};
+}; // struct QuantizeReport
+
+/**
+ * @brief Encodes float attributes, other types are kept as they are:
+ *      - first float 3 (position) as 4 half floats with w = 1,
+ *      - float 2 as normalized unsigned 16 bit if all values are in [0, 1] (texture coordinates), half floats otherwise,
+ *      - other float 3 with all components in [-1, 1] (normals) as GL_INT_2_10_10_10_REV,
+ *      - the rest as half floats, padded to an even count.
+ *      Half floats keep 11 significant bits, so positions should stay within a few thousand units of the origin
+ */
+auto quantize_mesh(MeshData& mesh) -> QuantizeReport;
+
+} // namespace Mesh
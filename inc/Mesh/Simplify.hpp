@@ -0,0 +1,37 @@
+/**
+ * @file Simplify.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Mesh simplification by quadric error metric edge collapses (Garland & Heckbert)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "Mesh/Mesh.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Mesh
+{
+
+struct SimplifyResult {
+    IndexedMesh mesh;
+    float error;    // square root of the largest collapse quadric error, in mesh units, overestimates the deviation
+}; // struct SimplifyResult
+
+/**
+ * @brief Collapses cheapest edges until the mesh has at most targetTriangles triangles
+ *      or no collapse keeps the surface from folding over. Topology is taken from positions
+ *      only, vertices split by texture seams move together and keep their texture coordinates
+ *
+ * @param mesh mesh to simplify
+ * @param targetTriangles wanted number of triangles
+ * @param maxError collapses with larger error aren't done, even if the target isn't reached
+ * @retval SimplifyResult simplified mesh and its error
+ */
+auto simplify(const IndexedMesh& mesh, uint targetTriangles, float maxError = 1e30f) -> SimplifyResult;
+
+} // namespace Mesh
@@ -0,0 +1,175 @@
+/**
+ * @file Profiler.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Zone based CPU and GPU profiler exporting Chrome/Perfetto trace JSON,
+ *      PROFILE_* macros compile to nothing unless PROFILER_ENABLED is defined (-DProfiler=ON)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+
+#include "jac/type_defs.hpp"
+
+#ifdef PROFILER_ENABLED
+    #define PROFILER_CONCAT_IMPL(a, b) a##b
+    #define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+
+    // Name has to be a string literal (or live as long as the profiler)
+    #define PROFILE_ZONE(name) const Profiler::CpuZone PROFILER_CONCAT(profilerZone, __LINE__){name}
+    // GPU zones can only be opened on the thread owning the OpenGL context
+    #define PROFILE_GPU_ZONE(name) const Profiler::GpuZone PROFILER_CONCAT(profilerGpuZone, __LINE__){name}
+    #define PROFILE_FRAME() Profiler::instance().endFrame()
+    #define PROFILE_THREAD(name) Profiler::instance().setThreadName(name)
+#else
+    #define PROFILE_ZONE(name) static_cast<void>(0)
+    #define PROFILE_GPU_ZONE(name) static_cast<void>(0)
+    #define PROFILE_FRAME() static_cast<void>(0)
+    #define PROFILE_THREAD(name) static_cast<void>(0)
+#endif
+
+class Profiler
+{
+    public:
+#ifdef PROFILER_ENABLED
+        static constexpr bool Enabled = true;
+#else
+        static constexpr bool Enabled = false;
+#endif
+
+        // GPU results are read this many frames after the zone, by then they are almost always ready
+        static constexpr uint GpuLatency = 3;
+        // Events kept per thread, later ones are dropped and counted
+        static constexpr uint MaxEventsPerThread = 4'000'000;
+
+        /**
+         * @brief Measures CPU time between construction and destruction
+         */
+        class CpuZone
+        {
+            public:
+                explicit CpuZone(const char* name);
+                ~CpuZone();
+
+                CpuZone(const CpuZone&) = delete;
+                CpuZone(CpuZone&&) = delete;
+                auto operator=(const CpuZone&) -> CpuZone& = delete;
+                auto operator=(CpuZone&&) -> CpuZone& = delete;
+            private:
+                const char* m_name;
+                int64_t m_start{-1};    // -1 - not capturing
+        }; // class CpuZone
+
+        /**
+         * @brief Measures GPU time of commands issued between construction and destruction
+         *      with a pair of GL_TIMESTAMP queries
+         */
+        class GpuZone
+        {
+            public:
+                explicit GpuZone(const char* name);
+                ~GpuZone();
+
+                GpuZone(const GpuZone&) = delete;
+                GpuZone(GpuZone&&) = delete;
+                auto operator=(const GpuZone&) -> GpuZone& = delete;
+                auto operator=(GpuZone&&) -> GpuZone& = delete;
+            private:
+                const char* m_name;
+                uint m_begin{};     // 0 - not capturing
+        }; // class GpuZone
+
+        static auto instance() -> Profiler&;
+
+        Profiler(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        auto operator=(const Profiler&) -> Profiler& = delete;
+        auto operator=(Profiler&&) -> Profiler& = delete;
+
+        /**
+         * @brief Zones are only recorded while capturing, off by default
+         */
+        auto setCapturing(bool capturing) -> void;
+        [[nodiscard]] inline auto isCapturing() const -> bool { return m_capturing.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Names calling thread in the trace
+         */
+        auto setThreadName(std::string name) -> void;
+
+        /**
+         * @brief Reads back finished GPU zones without waiting, call once per frame on the OpenGL thread
+         */
+        auto endFrame() -> void;
+
+        /**
+         * @brief Writes recorded zones as Chrome trace JSON (chrome://tracing, ui.perfetto.dev),
+         *      pending GPU zones are skipped
+         */
+        auto writeTrace(const std::filesystem::path& path) -> bool;
+
+        /**
+         * @brief Drops recorded zones, GPU zones still waiting for results are kept
+         */
+        auto clear() -> void;
+    private:
+        Profiler();
+        ~Profiler();
+
+        struct Event {
+            const char* name;
+            int64_t start;      // steady clock ns
+            int64_t duration;   // ns
+        }; // struct Event
+
+        // Every thread writes only to its own buffer, the mutex is contended only while exporting
+        struct ThreadBuffer {
+            std::mutex mutex;
+            std::vector<Event> events;
+            std::string name;
+            uint id{};
+            uint64_t dropped{};
+        }; // struct ThreadBuffer
+
+        struct PendingGpuZone {
+            const char* name;
+            uint begin;
+            uint end;
+            uint64_t frame;
+        }; // struct PendingGpuZone
+
+        std::atomic<bool> m_capturing{false};
+        const int64_t m_epoch;
+
+        std::mutex m_threadsMutex;
+        std::vector<unique_ptr<ThreadBuffer>> m_threads;
+
+        // GPU state is only touched from the OpenGL thread
+        std::deque<PendingGpuZone> m_pendingGpu;
+        std::vector<uint> m_freeQueries;
+        std::vector<Event> m_gpuEvents;
+        uint64_t m_frame{};
+        int64_t m_gpuOffset{};      // GPU timestamp - CPU time, in ns
+        uint64_t m_calibratedFrame{};
+        bool m_calibrated{false};
+
+        static auto now() -> int64_t;
+        auto threadBuffer() -> ThreadBuffer&;
+        auto record(const char* name, int64_t start, int64_t end) -> void;
+
+        auto acquireQuery() -> uint;
+        auto beginGpuZone() -> uint;
+        auto endGpuZone(const char* name, uint begin) -> void;
+        auto calibrate() -> void;
+}; // class Profiler
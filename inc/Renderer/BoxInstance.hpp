@@ -0,0 +1,54 @@
+/**
+ * @file BoxInstance.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Per-box data kept by BoxRenderer and its packed form uploaded for instanced and
+ *      indirect drawing, where the model matrix is rebuilt from position, scale and rotation
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+/**
+ * @brief Box as drawn by the per-box path and used for picking and sorting
+ */
+struct BoxInstance {
+    glm::mat4 model;
+    glm::vec4 color;
+    glm::uvec4 textures;    // xy - images mixed on the box, zw unused
+}; // struct BoxInstance
+
+/**
+ * @brief 32 bytes instead of 96, matches Instance in indirect.vert (std430) and the instance layout
+ *      of BoxRenderer. Model matrix has to be translation * rotation * uniform scale, with
+ *      non-uniform scale boxes are drawn with the largest one
+ */
+struct PackedBoxInstance {
+    glm::vec4 positionScale;            // translation, scale in w
+    std::array<int16_t, 4> rotation;    // quaternion xyzw, snorm16
+    uint32_t color;                     // RGBA, unorm8
+    std::array<uint16_t, 2> textures;
+}; // struct PackedBoxInstance
+
+static_assert(sizeof(PackedBoxInstance) == 32);
+
+auto pack_instance(const BoxInstance& instance) -> PackedBoxInstance;
+
+/**
+ * @brief Model matrix the same way shaders rebuild it, for measuring error of packing
+ */
+auto unpack_model(const PackedBoxInstance& instance) -> glm::mat4;
+
+} // namespace Renderer
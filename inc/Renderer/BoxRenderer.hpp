@@ -0,0 +1,350 @@
+/**
+ * @file BoxRenderer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Draws field of boxes, either one draw call per box, all at once with instancing,
+ *      or culled on the GPU and submitted with multi-draw indirect. Detail of the mesh
+ *      can follow its size on screen, with a billboard impostor for the smallest ones
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "JobSystem.hpp"
+#include "Mesh/Lod.hpp"
+#include "Renderer/Camera.hpp"
+#include "Renderer/BoxInstance.hpp"
+#include "Renderer/Culling.hpp"
+#include "Renderer/FrameUniforms.hpp"
+#include "Renderer/RenderQueue.hpp"
+#include "Renderer/GPU/Shader.hpp"
+#include "Renderer/GPU/IndexBuffer.hpp"
+#include "Renderer/GPU/StorageBuffer.hpp"
+#include "Renderer/GPU/StreamBuffer.hpp"
+#include "Renderer/GPU/TextureArray.hpp"
+#include "Renderer/GPU/UniformBuffer.hpp"
+#include "Renderer/GPU/BindlessTextures.hpp"
+#include "Renderer/GPU/VertexArray.hpp"
+#include "Renderer/GPU/VertexBuffer.hpp"
+#include "Renderer/GPU/VertexBufferLayout.hpp"
+#include "Scene/BVH.hpp"
+#include "Scene/Box.hpp"
+#include "Scene/AABB.hpp"
+#include "Scene/Transform.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+class BoxRenderer
+{
+    public:
+        enum class Mode {
+            PerBox,     // glDrawArrays and uniform uploads for every box
+            Instanced,  // single glDrawArraysInstanced for all boxes
+            Indirect    // boxes live in SSBOs, compute shader culls them and fills commands for glMultiDrawArraysIndirect(Count)
+        };
+
+        enum class Culling {
+            None,
+            Simd,   // bounding spheres tested in batches with SSE/AVX2
+            BVH     // hierarchy of bounding boxes, whole subtrees rejected or accepted at once
+        };
+
+        enum class Texturing {
+            Slots,      // textures bound to units 0 and 1 by the caller, the same on every box
+            Array,      // every box samples its own pair of layers of a texture array
+            Bindless    // every box samples its own pair of resident handles (ARB_bindless_texture)
+        };
+
+        // Boxes per draw command in Indirect mode, has to match GroupSize in cull.comp
+        static constexpr uint IndirectGroupSize = 4096;
+
+        /**
+         * @brief How LOD levels are picked, level error and box size are projected to pixels
+         *      with the camera's field of view and box distance
+         */
+        struct LodSelection {
+            float errorPixels = 1.f;        // coarsest level with projected error below this is drawn
+            float hysteresis = 0.2f;        // switching to a coarser level needs error this much below the threshold
+            float impostorPixels = 24.f;    // at the last level, boxes smaller than this on screen become impostors
+            uint viewportHeight = 720;      // pixels
+        }; // struct LodSelection
+
+        struct LodStats {
+            uint64_t triangles{};           // submitted this frame, impostors count as 2
+            std::vector<uint> boxes{};      // per level, impostors last
+            float meanErrorPixels{};        // projected geometric error of the drawn level, averaged over visible boxes
+            float maxErrorPixels{};
+        }; // struct LodStats
+
+        // Impostor atlas has this many views around the mesh's Y axis, each a square tile
+        static constexpr uint ImpostorViews = 8;
+        static constexpr uint ImpostorTileSize = 64;
+
+        /**
+         * @param mesh vertex buffer with box mesh
+         * @param layout layout of the mesh, per-instance attributes are placed after it
+         * @param vertexCount number of vertices in the mesh
+         * @param jobs job system used to spread per-box CPU work across cores
+         */
+        BoxRenderer(const GPU::VertexBuffer& mesh, const GPU::VertexBufferLayout& layout, uint vertexCount, JobSystem& jobs);
+        ~BoxRenderer();
+
+        BoxRenderer(const BoxRenderer&) = delete;
+        BoxRenderer(BoxRenderer&&) = delete;
+        auto operator=(const BoxRenderer&) -> BoxRenderer& = delete;
+        auto operator=(BoxRenderer&&) -> BoxRenderer& = delete;
+
+        /**
+         * @brief Sets boxes to draw, rebuilds per-instance buffer. Model matrices are taken from
+         *      the hierarchy, only nodes it recomputed are refreshed before drawing
+         * 
+         * @param boxes boxes to draw
+         * @param hierarchy hierarchy boxes are placed in, has to outlive the renderer or the next setBoxes call
+         * @param nodes node of every box in the hierarchy
+         */
+        auto setBoxes(
+            const std::vector<Scene::Box>& boxes,
+            const Scene::TransformHierarchy& hierarchy,
+            const std::vector<Scene::TransformHierarchy::Node>& nodes
+        ) -> void;
+
+        /**
+         * @brief Sets where boxes take their images from. Array and Bindless need their texture set,
+         *      without it (or bindless support) drawing falls back to Array and then Slots.
+         *      Impostors always show images 0 and 1
+         */
+        inline auto setTexturing(Texturing texturing) -> void { m_texturing = texturing; }
+
+        /**
+         * @brief Texture sets used by Array and Bindless texturing, have to outlive the renderer
+         *      or the next call. Images are indexed by Scene::Box::textures.
+         *      Programs drawing with the set are submitted here, so they compile before they are used
+         */
+        auto setTextureArray(const GPU::TextureArray* textures) -> void;
+        auto setBindlessTextures(const GPU::BindlessTextures* textures) -> void;
+
+        /**
+         * @brief Draws boxes set by setBoxes, with Slots texturing textures are expected to be bound to slots 0 and 1
+         * 
+         * @param mode draw path to use, Indirect falls back to Instanced without OpenGL 4.5
+         * @param camera camera providing view and projection matrices
+         * @param mix mix factor between the two textures
+         */
+        auto draw(Mode mode, const Camera& camera, float mix) -> void;
+
+        /**
+         * @brief Sets frustum culling method, with culling only boxes intersecting the camera frustum are submitted.
+         *      Indirect mode always culls on the GPU unless culling is None
+         */
+        inline auto setCulling(Culling culling) -> void { m_culling = culling; }
+
+        /**
+         * @brief With sorting visible boxes are submitted through a render queue, opaque ones
+         *      front to back, otherwise in the order they were given. Indirect mode doesn't sort
+         */
+        inline auto setSorting(bool sorting) -> void { m_sorting = sorting; }
+
+        /**
+         * @brief Replaces the mesh with a LOD chain (level 0 drawn instead of the mesh) and enables LOD.
+         *      Indirect mode keeps drawing level 0
+         */
+        auto setLods(const Mesh::LodChain& chain) -> void;
+        inline auto setLod(bool lod) -> void { m_lod = lod; }
+        inline auto setLodSelection(const LodSelection& selection) -> void { m_lodSelection = selection; }
+
+        /**
+         * @brief Finds box nearest to the ray origin that the ray hits, boxes containing the origin are skipped
+         */
+        [[nodiscard]] auto pick(const Scene::Ray& ray) const -> std::optional<uint>;
+
+        /**
+         * @brief Draws given box white, previously highlighted box gets its color back
+         */
+        auto highlight(std::optional<uint> box) -> void;
+
+        [[nodiscard]] inline auto getCulling() const -> Culling { return m_culling; }
+        [[nodiscard]] inline auto getSorting() const -> bool { return m_sorting; }
+        [[nodiscard]] inline auto getLod() const -> bool { return m_lod; }
+        [[nodiscard]] inline auto getTexturing() const -> Texturing { return m_texturing; }
+        /**
+         * @brief Texturing the last draw used, after falling back
+         */
+        [[nodiscard]] inline auto getActiveTexturing() const -> Texturing { return m_activeTexturing; }
+        [[nodiscard]] inline auto getLodStats() const -> const LodStats& { return m_lodStats; }
+        [[nodiscard]] inline auto getHighlighted() const -> std::optional<uint> { return m_highlighted; }
+        [[nodiscard]] inline auto getBoxCount() const -> uint { return m_instances.size(); }
+        /**
+         * @brief In Indirect mode the count is read back from the GPU a few frames late
+         */
+        [[nodiscard]] inline auto getVisibleCount() const -> uint { return m_lastMode == Mode::Indirect ? m_indirectVisibleCount : m_visible.size(); }
+        [[nodiscard]] inline auto getDrawCalls() const -> uint { return m_drawCalls; }
+        [[nodiscard]] inline auto getSpheres() const -> const BoundingSpheres& { return m_spheres; }
+        /**
+         * @brief Fence waits of the per-frame instance stream, all zero without OpenGL 4.4
+         */
+        [[nodiscard]] inline auto getStreamStats() const -> GPU::StreamBuffer::Stats
+        {
+            return m_instanceStream ? m_instanceStream->GetStats() : GPU::StreamBuffer::Stats{};
+        }
+        inline auto resetStreamStats() -> void
+        {
+            if (m_instanceStream)
+                m_instanceStream->ResetStats();
+        }
+
+        /**
+         * @brief Gathers boxes submitted by the draw commands of the last Indirect draw, in ascending order.
+         *      Waits for the GPU, meant for checking GPU culling against the CPU one
+         */
+        [[nodiscard]] auto readIndirectVisible() const -> std::vector<uint>;
+
+        static auto to_string(Mode mode) -> std::string_view;
+        static auto to_string(Culling culling) -> std::string_view;
+        static auto to_string(Texturing texturing) -> std::string_view;
+    private:
+        const GPU::VertexBuffer& m_mesh;    // NOLINT (cppcoreguidelines-avoid-const-or-ref-data-members)
+        const GPU::VertexBufferLayout& m_layout;    // NOLINT (cppcoreguidelines-avoid-const-or-ref-data-members)
+        uint m_vertexCount;
+        JobSystem& m_jobs;  // NOLINT (cppcoreguidelines-avoid-const-or-ref-data-members)
+
+        GPU::Shader m_shader;
+        GPU::Shader m_instancedShader;
+        FrameUniforms m_frameUniforms;
+
+        GPU::VertexArray m_va{};
+        std::unique_ptr<GPU::VertexArray> m_instancedVa{};
+        std::unique_ptr<GPU::StreamBuffer> m_instanceStream{};     // visible instances written every frame, OpenGL 4.4
+        std::unique_ptr<GPU::VertexBuffer> m_instanceBuffer{};      // without it
+        GPU::VertexBufferLayout m_instanceLayout{};
+
+        std::vector<BoxInstance> m_instances{};
+        std::vector<PackedBoxInstance> m_packedInstances{};     // what instance buffer and storage hold
+        BoundingSpheres m_spheres{};
+        std::vector<Scene::AABB> m_bounds{};
+        Scene::BVH m_bvh{};
+
+        std::optional<uint> m_highlighted{};
+        glm::vec4 m_highlightedColor{};
+
+        const Scene::TransformHierarchy* m_hierarchy{nullptr};
+        std::vector<uint> m_nodeToBox{};
+        uint m_hierarchySerial{};
+
+        Culling m_culling{Culling::Simd};
+        std::vector<uint> m_visible{};
+        std::vector<PackedBoxInstance> m_visibleInstances{};
+        bool m_instanceBufferGathered{false};  // instance buffer holds visible instances in submission order, not used with the stream
+
+        bool m_sorting{true};
+        RenderQueue m_queue;
+
+        Texturing m_texturing{Texturing::Slots};
+        Texturing m_activeTexturing{Texturing::Slots};
+        const GPU::TextureArray* m_textureArray{nullptr};
+        const GPU::BindlessTextures* m_bindlessTextures{nullptr};
+
+        // Programs of Array and Bindless texturing, indexed by Mode, created when their texture set is given
+        std::array<std::unique_ptr<GPU::Shader>, 3> m_arrayShaders{};
+        std::array<std::unique_ptr<GPU::Shader>, 3> m_bindlessShaders{};
+
+        // LOD chain, all levels share one vertex and one index buffer
+        bool m_lod{false};
+        LodSelection m_lodSelection{};
+        LodStats m_lodStats{};
+        std::vector<Mesh::LodChain::Level> m_lodLevels{};
+        float m_lodRadius{};
+        std::unique_ptr<GPU::VertexBuffer> m_lodVertices{};
+        GPU::VertexBufferLayout m_lodLayout{};      // quantized with Mesh::quantize_mesh
+        std::unique_ptr<GPU::IndexBuffer> m_lodIndices{};
+        std::unique_ptr<GPU::VertexArray> m_lodVa{};
+        std::unique_ptr<GPU::VertexArray> m_lodInstancedVa{};
+        std::vector<uchar> m_boxLevel{};            // level drawn last frame, kept for hysteresis
+        std::vector<uint> m_levelOffsets{};         // where each level starts in m_visible, one past the end last
+        std::vector<uchar> m_visibleLevel{};
+        std::vector<float> m_visibleError{};
+        std::vector<uint> m_lodScratch{};
+
+        // Impostors are baked from level 0 with images 0 and 1, one atlas row with each texture so
+        // they are blended by mix when drawn, baked again when LODs or texturing change
+        GPU::Shader m_impostorShader;
+        GPU::VertexBuffer m_impostorQuad;
+        std::unique_ptr<GPU::VertexArray> m_impostorVa{};
+        uint m_impostorAtlas{};
+        uint m_impostorFramebuffer{};
+        uint m_impostorDepth{};
+        GPU::UniformBuffer m_impostorBlocks;        // Camera block of every baked view, then Frame block of every row
+        bool m_impostorsDirty{true};
+
+        // Indirect mode, everything is created on first use
+        struct IndirectReadback {
+            std::unique_ptr<GPU::StorageBuffer> buffer{};
+            GLsync fence{};
+        }; // struct IndirectReadback
+
+        std::unique_ptr<GPU::Shader> m_cullShader{};
+        std::unique_ptr<GPU::Shader> m_indirectShader{};
+        std::unique_ptr<GPU::StorageBuffer> m_instanceStorage{};    // PackedBoxInstance per box
+        std::unique_ptr<GPU::StorageBuffer> m_sphereStorage{};      // vec4 (center, radius) per box
+        std::unique_ptr<GPU::StorageBuffer> m_visibleStorage{};     // visible box indices, IndirectGroupSize slots per command
+        std::unique_ptr<GPU::StorageBuffer> m_drawStorage{};        // counters followed by draw commands
+        std::unique_ptr<GPU::StorageBuffer> m_drawReset{};          // m_drawStorage content before culling
+        std::vector<glm::vec4> m_sphereData{};
+        bool m_indirectDirty{true};
+        std::array<IndirectReadback, 3> m_readbacks{};
+        uint m_readbackFrame{};
+        uint m_indirectVisibleCount{};
+
+        Mode m_lastMode{Mode::PerBox};
+        uint m_drawCalls{};
+
+        auto syncTransforms() -> void;
+        auto updateBox(uint box, const glm::mat4& world) -> void;
+        auto updateVisibility(const Camera& camera) -> void;
+        auto sortVisible(Mode mode, const Camera& camera) -> void;
+        auto selectLods(const Camera& camera) -> void;
+        auto updateLodStats(Mode mode) -> void;
+        auto createLodArrays() -> void;
+        auto bakeImpostors() -> void;
+        auto uploadInstances() -> void;
+        auto addInstanceBuffer(GPU::VertexArray& va) const -> void;
+        /**
+         * @brief Copies instances of m_visible[first, first + count) into this frame's region of the stream
+         * @retval std::optional<uint> instance index of the first one, for baseInstance of draws
+         */
+        [[nodiscard]] auto streamInstances(uint first, uint count) -> std::optional<uint>;
+
+        auto drawPerBox() -> void;
+        auto drawInstanced() -> void;
+        auto drawImpostors(uint baseInstance, uint count) -> void;
+        [[nodiscard]] auto lodActive(Mode mode) const -> bool;
+
+        auto prepareIndirect() -> void;
+        auto cullIndirect(const Camera& camera) -> void;
+        auto drawIndirect() -> void;
+        auto readbackIndirectCount() -> void;
+        [[nodiscard]] auto getIndirectGroupCount() const -> uint;
+
+        [[nodiscard]] auto resolveTexturing() const -> Texturing;
+        auto submitShaders(Texturing texturing) -> void;
+        auto getShader(Mode mode) -> GPU::Shader&;
+        auto bindTextures(GPU::Shader& shader) const -> void;
+        /**
+         * @brief Binds program of the mode and texturing with its textures, the rest comes from frame uniform blocks
+         */
+        auto bindShader(Mode mode) -> GPU::Shader&;
+}; // class BoxRenderer
+
+} // namespace Renderer
@@ -39,12 +39,26 @@ class Camera
         auto roll(const angle delta) noexcept -> void;
         auto resetRotation() noexcept -> void;
 
+        auto setPosition(const vector position) noexcept -> void;
+        /**
+         * @brief Turns camera towards target keeping world Y axis as up, used by scripted camera paths
+         */
+        auto lookAt(const vector target) noexcept -> void;
+        /**
+         * @brief Overrides aspect ratio taken from primary monitor, needed for offscreen rendering
+         */
+        auto setAspect(const float aspect) noexcept -> void;
+
         [[nodiscard]] inline auto getView() const noexcept -> const matrix& { return m_view; }
         [[nodiscard]] inline auto getProjection() const noexcept -> const matrix& { return m_projection; }
 
         [[nodiscard]] inline auto getPosition() const noexcept -> const vector& { return m_position; }
         [[nodiscard]] inline auto getForward() const noexcept -> const normal& { return m_forward; }
         [[nodiscard]] inline auto getUp() const noexcept -> const normal& { return m_up; }
+        /**
+         * @brief Vertical field of view in degrees
+         */
+        [[nodiscard]] inline auto getFov() const noexcept -> angle { return m_fov; }
         [[nodiscard]] inline auto getRight() const noexcept -> const normal& { return m_right; }
     private:
         vector m_position{};
@@ -57,8 +71,7 @@ class Camera
         matrix m_projection{};
 
         angle m_fov = 75.f;
-
-        const GLFWvidmode* video_mode;
+        float m_aspect;
 
         auto updateView() noexcept -> void;
         auto updateProjection() noexcept -> void;
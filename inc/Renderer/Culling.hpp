@@ -0,0 +1,90 @@
+/**
+ * @file Culling.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Frustum culling of bounding spheres stored as structure of arrays, with SSE/AVX2 paths.
+ *      Doesn't touch OpenGL, so it can be used and tested without a context.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <vector>
+
+#include "JobSystem.hpp"
+#include "Renderer/Frustum.hpp"
+#include "Scene/Box.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+/**
+ * @brief Bounding spheres in structure of arrays layout, i-th sphere is (x[i], y[i], z[i], radius[i])
+ */
+struct BoundingSpheres
+{
+    std::vector<float> x{};
+    std::vector<float> y{};
+    std::vector<float> z{};
+    std::vector<float> radius{};
+
+    auto push_back(const glm::vec3& center, float r) -> void;
+    auto clear() -> void;
+
+    [[nodiscard]] inline auto size() const -> uint { return x.size(); }
+}; // struct BoundingSpheres
+
+auto make_bounding_spheres(const std::vector<Scene::Box>& boxes) -> BoundingSpheres;
+
+enum class SimdLevel {
+    Scalar,
+    SSE,    // 4 spheres per iteration
+    AVX2    // 8 spheres per iteration
+};
+
+/**
+ * @brief Best SIMD level supported by the CPU (checked once)
+ */
+auto detect_simd_level() -> SimdLevel;
+
+/**
+ * @brief Tests spheres [begin, end) against the frustum and writes indices of visible ones
+ * 
+ * @param out output array, must have space for (end - begin) indices
+ * @retval uint number of visible spheres written to out
+ */
+auto cull_spheres(
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    uint begin,
+    uint end,
+    uint* out,
+    SimdLevel level = detect_simd_level()
+) -> uint;
+
+/**
+ * @brief Tests all spheres against the frustum, visible is overwritten with indices of visible spheres
+ */
+auto cull_spheres(
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    std::vector<uint>& visible,
+    SimdLevel level = detect_simd_level()
+) -> void;
+
+/**
+ * @brief Same as above, spheres are split into chunks that are culled in parallel
+ */
+auto cull_spheres(
+    JobSystem& jobs,
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    std::vector<uint>& visible,
+    SimdLevel level = detect_simd_level()
+) -> void;
+
+} // namespace Renderer
@@ -0,0 +1,58 @@
+/**
+ * @file FrameUniforms.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Camera, Frame and Lighting uniform blocks of a frame, packed into one buffer
+ *      uploaded once and bound to their fixed binding points for every program
+ * @version 0.1
+ * @date 2026-10-16
+ * @see GPU/UniformBlocks.hpp
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Renderer/Camera.hpp"
+#include "Renderer/GPU/UniformBlocks.hpp"
+#include "Renderer/GPU/UniformBuffer.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+class FrameUniforms
+{
+    public:
+        FrameUniforms();
+        ~FrameUniforms() = default;
+
+        FrameUniforms(const FrameUniforms&) = delete;
+        FrameUniforms(FrameUniforms&&) = delete;
+        auto operator=(const FrameUniforms&) -> FrameUniforms& = delete;
+        auto operator=(FrameUniforms&&) -> FrameUniforms& = delete;
+
+        /**
+         * @brief Uploads all blocks with a single call and binds them
+         */
+        auto update(const Camera& camera, const GPU::FrameBlock& frame, const GPU::LightingBlock& lighting) -> void;
+
+        /**
+         * @brief Binds blocks of the last update again, after something else was bound to their binding points
+         */
+        auto bind() const -> void;
+
+        [[nodiscard]] static auto to_block(const glm::mat4& view, const glm::mat4& projection) -> GPU::CameraBlock;
+    private:
+        // Where each block starts in the buffer, in the order of UniformBlockBindings
+        std::array<uint, GPU::UniformBlockBindings.size()> m_offsets{};
+        std::vector<uchar> m_staging{};
+        GPU::UniformBuffer m_buffer;
+}; // class FrameUniforms
+
+} // namespace Renderer
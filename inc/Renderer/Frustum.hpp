@@ -0,0 +1,40 @@
+/**
+ * @file Frustum.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief View frustum described by six planes, extracted from view-projection matrix
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <array>
+
+#include <glm/glm.hpp>
+
+namespace Renderer
+{
+
+class Camera;
+
+struct Frustum
+{
+    enum Plane {
+        LEFT, RIGHT, BOTTOM, TOP, NEAR, FAR, COUNT
+    };
+
+    // Planes as (normal.xyz, distance), normals are unit length and point inside the frustum
+    std::array<glm::vec4, COUNT> planes{};
+
+    /**
+     * @brief Extracts planes from a view-projection matrix (projection * view)
+     */
+    static auto FromMatrix(const glm::mat4& viewProjection) -> Frustum;
+    static auto FromCamera(const Camera& camera) -> Frustum;
+
+    [[nodiscard]] auto intersectsSphere(const glm::vec3& center, float radius) const -> bool;
+}; // struct Frustum
+
+} // namespace Renderer
@@ -0,0 +1,62 @@
+/**
+ * @file BindlessTextures.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Set of textures made resident with ARB_bindless_texture, their 64-bit handles
+ *      live in a shader storage buffer so shaders pick any texture by index without binding
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <filesystem>
+
+#include "JobSystem.hpp"
+#include "Renderer/GPU/Texture.hpp"
+#include "Renderer/GPU/StorageBuffer.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class BindlessTextures
+{
+    public:
+        /**
+         * @retval bool driver has ARB_bindless_texture and DSA used by StorageBuffer (4.5)
+         */
+        static auto IsSupported() -> bool;
+
+        /**
+         * @brief Loads images as Textures (any size or format) and makes them resident,
+         *      i-th handle in the buffer belongs to the i-th image
+         *
+         * @param jobs optional, used when an image has to be cooked
+         */
+        BindlessTextures(const std::vector<std::filesystem::path>& paths, JobSystem* jobs = nullptr);
+        ~BindlessTextures();
+
+        BindlessTextures(const BindlessTextures&) = delete;
+        BindlessTextures(BindlessTextures&&) = delete;
+        auto operator=(const BindlessTextures&) -> BindlessTextures& = delete;
+        auto operator=(BindlessTextures&&) -> BindlessTextures& = delete;
+
+        /**
+         * @brief Binds handle buffer to the indexed GL_SHADER_STORAGE_BUFFER binding
+         */
+        auto BindBase(uint index) const -> void;
+
+        [[nodiscard]] inline auto IsValid() const -> bool { return m_handleBuffer != nullptr; }
+        [[nodiscard]] inline auto GetCount() const -> uint { return m_handles.size(); }
+    private:
+        std::vector<std::unique_ptr<Texture>> m_textures{};
+        std::vector<uint64_t> m_handles{};
+        std::unique_ptr<StorageBuffer> m_handleBuffer{};
+}; // class BindlessTextures
+
+} // namespace Renderer::GPU
@@ -0,0 +1,67 @@
+/**
+ * @file Extensions.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief OpenGL extensions beyond the core profile GLAD is generated for, which ones
+ *      the driver has and entry points of those the renderer uses
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <glad/gl.h>
+
+#include <string_view>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class Extensions
+{
+    public:
+        using GetTextureHandleARB = uint64_t (GLAD_API_PTR*)(uint texture);
+        using MakeTextureHandleResidentARB = void (GLAD_API_PTR*)(uint64_t handle);
+        using MakeTextureHandleNonResidentARB = void (GLAD_API_PTR*)(uint64_t handle);
+        using MaxShaderCompilerThreadsKHR = void (GLAD_API_PTR*)(uint count);
+
+        // GL_COMPLETION_STATUS_KHR, program or shader parameter that doesn't wait for the compiler
+        static constexpr uint CompletionStatus = 0x91B1;
+
+        /**
+         * @brief Extensions of the context Load was last called with, GLAD's entry points are process-wide too
+         */
+        static auto Get() -> Extensions&;
+
+        /**
+         * @brief Queries extensions of the current context and loads their entry points,
+         *      call after GLAD is loaded with the same loader
+         */
+        auto Load(GLADloadfunc loader) -> void;
+
+        /**
+         * @retval bool current context has the extension, e.g. "GL_ARB_bindless_texture"
+         */
+        static auto Has(std::string_view name) -> bool;
+
+        [[nodiscard]] inline auto HasS3tc() const -> bool { return m_s3tc; }
+        [[nodiscard]] inline auto HasBindlessTexture() const -> bool { return m_bindlessTexture; }
+        [[nodiscard]] inline auto HasParallelShaderCompile() const -> bool { return m_parallelShaderCompile; }
+
+        // ARB_bindless_texture, nullptr without it
+        GetTextureHandleARB glGetTextureHandleARB{};
+        MakeTextureHandleResidentARB glMakeTextureHandleResidentARB{};
+        MakeTextureHandleNonResidentARB glMakeTextureHandleNonResidentARB{};
+
+        // KHR_parallel_shader_compile (or its ARB version), nullptr without it
+        MaxShaderCompilerThreadsKHR glMaxShaderCompilerThreadsKHR{};
+    private:
+        bool m_s3tc{};
+        bool m_bindlessTexture{};
+        bool m_parallelShaderCompile{};
+}; // class Extensions
+
+} // namespace Renderer::GPU
@@ -0,0 +1,64 @@
+/**
+ * @file HeadlessContext.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief OpenGL context without a window (EGL surfaceless or pbuffer) rendering into
+ *      an offscreen framebuffer, works on Mesa llvmpipe without a GPU
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <string>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class HeadlessContext
+{
+    public:
+        /**
+         * @brief Creates context, makes it current, loads OpenGL functions and binds framebuffer
+         *      of given size. Check IsValid, errors are reported to std::cerr
+         */
+        HeadlessContext(uint width, uint height);
+        ~HeadlessContext();
+
+        HeadlessContext(const HeadlessContext&) = delete;
+        HeadlessContext(HeadlessContext&&) = delete;
+        auto operator=(const HeadlessContext&) -> HeadlessContext& = delete;
+        auto operator=(HeadlessContext&&) -> HeadlessContext& = delete;
+
+        [[nodiscard]] inline auto IsValid() const -> bool { return m_framebuffer != 0; }
+
+        auto Bind() const -> void;
+
+        [[nodiscard]] inline auto GetWidth() const -> uint { return m_width; }
+        [[nodiscard]] inline auto GetHeight() const -> uint { return m_height; }
+
+        /**
+         * @brief GL_RENDERER and GL_VERSION strings, identifies the machine in benchmark results
+         */
+        [[nodiscard]] auto GetDescription() const -> std::string;
+    private:
+        uint m_width{};
+        uint m_height{};
+
+        // EGL handles kept opaque, so EGL (and X11 through it) headers don't leak to users
+        void* m_display{};
+        void* m_context{};
+        void* m_surface{};
+
+        uint m_framebuffer{};
+        uint m_colorBuffer{};
+        uint m_depthBuffer{};
+
+        auto createContext() -> bool;
+        auto createFramebuffer() -> bool;
+}; // class HeadlessContext
+
+} // namespace Renderer::GPU
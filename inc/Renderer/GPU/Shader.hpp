@@ -1,7 +1,7 @@
 /**
  * @file Shader.hpp
  * @author Moztanku (mostankpl@gmail.com)
- * @brief Abstraction of OpenGL Shader programs (vertex and fragment shaders)
+ * @brief Abstraction of OpenGL Shader programs (vertex and fragment shaders, or a compute shader)
  * @version 0.1
  * @date 2024-01-05
  * 
@@ -12,18 +12,41 @@
 
 #include <glm/matrix.hpp>
 
-#include <unordered_map>
+#include <chrono>
+#include <vector>
+#include <optional>
 #include <filesystem>
 #include <string>
 
+#include "JobSystem.hpp"
+#include "Renderer/GPU/Uniform.hpp"
+
 #include "jac/type_defs.hpp"
 
 namespace Renderer::GPU
 {
 
+// Linked programs are saved here and loaded instead of compiling while sources and driver stay the same
+inline const std::filesystem::path ProgramCacheDirectory{"res/cache/shaders"};
+
 class Shader
 {
     public:
+        // Programs created since the start (or ResetCacheStats), with time until they were ready
+        struct CacheStats {
+            uint loaded{};          // from a cached binary
+            uint compiled{};        // from sources, cache missing or rejected
+            uint rejected{};        // cached binaries the driver didn't accept
+            double loadMs{};
+            double compileMs{};     // from submitting until linking was seen finished
+        }; // struct CacheStats
+
+        /**
+         * @brief Programs missing from the cache are only submitted to the driver, with KHR_parallel_shader_compile
+         *      they are compiled on its threads until the first Bind or uniform lookup, which waits for them
+         * @param combined_shader_path file with both stages marked by `#shader vertex` / `#shader fragment`,
+         *      or a compute shader if the extension is .comp
+         */
         Shader(const std::filesystem::path& combined_shader_path);
         Shader(const std::filesystem::path& vertex_path, const std::filesystem::path& fragment_path);
         ~Shader();
@@ -33,20 +56,113 @@ class Shader
         auto operator=(const Shader&) -> Shader& = delete;
         auto operator=(Shader&&) -> Shader& = delete;
 
-        auto Bind() const -> void;
+        /**
+         * @brief Binds the program, a reloaded one replaces it here once the driver has finished linking it
+         */
+        auto Bind() -> void;
         auto Unbind() const -> void;
 
+        /**
+         * @brief Waits until the program submitted last is linked
+         */
+        auto Wait() -> void;
+
+        /**
+         * @brief Reads the source files again and submits a new program, the current one is used until it links.
+         *      Sources that fail to compile are reported and the current program is kept
+         */
+        auto Reload() -> void;
+
+        /**
+         * @brief Reloads every existing program built from one of the files
+         * @return number of programs reloaded
+         */
+        static auto ReloadChanged(const std::vector<std::filesystem::path>& files) -> uint;
+
+        [[nodiscard]] inline auto IsPending() const -> bool { return m_pending.has_value(); }
+
+        /**
+         * @brief Saves binaries of programs compiled since the last call to the program cache, call
+         *      once a frame after drawing. With jobs files are written on workers, the frame only copies the binaries.
+         *      Programs destroyed before that save theirs when destroyed
+         */
+        static auto SaveCache(JobSystem* jobs = nullptr) -> void;
+
+        [[nodiscard]] static auto GetCacheStats() -> const CacheStats&;
+        static auto ResetCacheStats() -> void;
+
+        /**
+         * @brief Sets uniform of the bound program, found by binary search over its hashed name.
+         *      Like every upload, skipped when the program already has the value
+         */
         template<typename... Args>
-        auto SetUniform(const std::string& name, Args... args) -> void;
+        auto SetUniform(UniformId id, Args... args) -> void;
 
         template<typename Matrix>
-        auto SetUniformM(const std::string& name, const Matrix& matrix) -> void;
+        auto SetUniformM(UniformId id, const Matrix& matrix) -> void;
+
+        /**
+         * @brief Resolves uniform once for Set, invalid if the program has no such uniform of type T
+         *      (int also matches samplers and bools)
+         */
+        template<typename T>
+        [[nodiscard]] auto GetUniform(UniformId id) -> Uniform<T>;
+
+        /**
+         * @brief Sets uniform of the bound program without any lookup, for values changing every draw
+         */
+        template<typename T>
+        inline auto Set(Uniform<T> uniform, const T& value) -> void
+        {
+            if (uniform.isValid())
+                setValue(uniform.index, &value, sizeof(T));
+        }
     private:
+        // Active uniform outside blocks, every array element is one
+        struct UniformInfo {
+            uint64_t hash;
+            int location;
+            uint type;      // GLSL type, e.g. GL_FLOAT_VEC4
+            uint size;      // bytes
+            uint offset;    // of the value in m_values
+            bool written;   // value in m_values is what the program has
+            bool warned;    // set with a value of another size
+            std::string name;
+        }; // struct UniformInfo
+
+        // Program the driver may still be compiling and linking
+        struct Pending {
+            uint program;
+            std::vector<uint> shaders;
+            uint64_t hash;
+            std::filesystem::path cachePath;    // empty when binaries can't be saved
+            std::chrono::steady_clock::time_point start;
+        }; // struct Pending
+
+        // Compiled program whose binary isn't in the cache yet
+        struct CacheEntry {
+            std::filesystem::path path;
+            uint64_t hash;
+        }; // struct CacheEntry
+
+        static constexpr uint NoUniform = Uniform<int>::Invalid;
+
         uint m_id{};
-        std::filesystem::path m_FilePath{};
-        std::unordered_map<std::string, uint> m_UniformLocationCache{};
+        std::optional<Pending> m_pending{};
+        std::optional<CacheEntry> m_unsaved{};
+        std::vector<std::filesystem::path> m_sources{};
+        std::string m_cacheName{};
+        std::vector<UniformInfo> m_uniforms{};  // reflected after linking, sorted by hash
+        std::vector<uchar> m_values{};          // last uploaded value of every uniform
+        std::vector<uint64_t> m_missing{};      // names already warned about
 
-        auto GetUniformLocation(const std::string& name) -> uint;
+        auto submit() -> void;
+        auto poll(bool wait) -> void;
+        auto discard() -> void;
+        auto replace(uint program) -> void;
+        auto reflectUniforms() -> void;
+        auto findUniform(UniformId id) -> uint;
+        auto setValue(uint index, const void* data, uint size) -> void;
 }; // class Shader
 
 } // namespace Renderer::GPU
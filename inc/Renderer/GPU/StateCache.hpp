@@ -0,0 +1,187 @@
+/**
+ * @file StateCache.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Shadow copy of OpenGL binding and fixed function state, skips calls
+ *      that wouldn't change anything and counts issued and skipped ones
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <glad/gl.h>
+
+#include <array>
+#include <limits>
+#include <cstdint>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+/**
+ * @brief All GPU wrappers bind through the cache of the calling thread, so code changing
+ *      tracked state with raw gl* calls has to call Reset afterwards (same after making
+ *      another context current). Objects must be Forget*-ed when deleted, GL reuses names
+ */
+class StateCache
+{
+    public:
+        enum class Call : uint {
+            Program,
+            VertexArray,
+            Buffer,
+            BufferBase,
+            Framebuffer,
+            ActiveTexture,
+            Texture,
+            Capability,
+            BlendFunc,
+            DepthFunc,
+            PolygonMode,
+            Uniform,        // counted by Shader, which keeps uniform values of its program
+            Count
+        };
+
+        struct Counters {
+            std::array<uint64_t, static_cast<uint>(Call::Count)> issued{};
+            std::array<uint64_t, static_cast<uint>(Call::Count)> skipped{};
+
+            [[nodiscard]] auto totalIssued() const -> uint64_t;
+            [[nodiscard]] auto totalSkipped() const -> uint64_t;
+        }; // struct Counters
+
+        static constexpr uint MaxTextureUnits = 32;
+        static constexpr uint MaxBufferBindings = 16;
+
+        /**
+         * @brief Cache of the context current on calling thread
+         */
+        static auto Get() -> StateCache&;
+
+        StateCache(const StateCache&) = delete;
+        StateCache(StateCache&&) = delete;
+        auto operator=(const StateCache&) -> StateCache& = delete;
+        auto operator=(StateCache&&) -> StateCache& = delete;
+
+        /**
+         * @brief Forgets everything, next call of every kind goes to GL
+         */
+        auto Reset() -> void;
+
+        auto UseProgram(uint program) -> void;
+        /**
+         * @brief Program of the last UseProgram, asked from GL (once) when it isn't known
+         */
+        [[nodiscard]] auto GetProgram() -> uint;
+        auto BindVertexArray(uint vertexArray) -> void;
+        auto BindBuffer(uint target, uint buffer) -> void;
+        /**
+         * @brief Binds buffer to indexed binding point of uniform or shader storage target,
+         *      like glBindBufferBase this also changes the target's generic binding
+         */
+        auto BindBufferBase(uint target, uint index, uint buffer) -> void;
+        /**
+         * @brief Binds part of a buffer to indexed binding point, always goes to GL since ranges
+         *      usually change every frame. Next BindBufferBase of the point isn't skipped
+         */
+        auto BindBufferRange(uint target, uint index, uint buffer, uint offset, uint size) -> void;
+        auto BindFramebuffer(uint framebuffer) -> void;
+
+        auto ActiveTexture(uint unit) -> void;
+        /**
+         * @brief Binds texture to given unit, changes active unit only if the binding changes
+         */
+        auto BindTexture(uint unit, uint target, uint texture) -> void;
+
+        auto SetCapability(uint capability, bool enabled) -> void;
+        inline auto Enable(uint capability) -> void { SetCapability(capability, true); }
+        inline auto Disable(uint capability) -> void { SetCapability(capability, false); }
+
+        auto BlendFunc(uint source, uint destination) -> void;
+        auto DepthFunc(uint function) -> void;
+        /**
+         * @brief Sets polygon mode for both faces (only mode core profile allows)
+         */
+        auto PolygonMode(uint mode) -> void;
+
+        auto ForgetProgram(uint program) -> void;
+        auto ForgetVertexArray(uint vertexArray) -> void;
+        auto ForgetBuffer(uint buffer) -> void;
+        auto ForgetFramebuffer(uint framebuffer) -> void;
+        auto ForgetTexture(uint texture) -> void;
+
+        /**
+         * @brief Counts a uniform upload of Shader, skipped when the program already had the value
+         */
+        inline auto CountUniform(bool issued) -> void
+        {
+            (issued ? m_counters.issued : m_counters.skipped)[static_cast<uint>(Call::Uniform)]++;
+        }
+
+        [[nodiscard]] inline auto GetCounters() const -> const Counters& { return m_counters; }
+        inline auto ResetCounters() -> void { m_counters = {}; }
+
+        static auto to_string(Call call) -> const char*;
+    private:
+        StateCache();
+        ~StateCache() = default;
+
+        static constexpr uint Unknown = std::numeric_limits<uint>::max();
+
+        // Buffer and texture targets with a cached binding, other targets always go to GL
+        static constexpr std::array<uint, 8> BufferTargets {
+            GL_ARRAY_BUFFER,
+            GL_ELEMENT_ARRAY_BUFFER,    // part of vertex array state
+            GL_UNIFORM_BUFFER,
+            GL_SHADER_STORAGE_BUFFER,
+            GL_DRAW_INDIRECT_BUFFER,
+            GL_PARAMETER_BUFFER,
+            GL_PIXEL_PACK_BUFFER,
+            GL_PIXEL_UNPACK_BUFFER
+        };
+        // Targets with indexed binding points
+        static constexpr std::array<uint, 2> IndexedBufferTargets {
+            GL_UNIFORM_BUFFER,
+            GL_SHADER_STORAGE_BUFFER
+        };
+        static constexpr std::array<uint, 3> TextureTargets {
+            GL_TEXTURE_2D,
+            GL_TEXTURE_2D_ARRAY,
+            GL_TEXTURE_CUBE_MAP
+        };
+        static constexpr std::array<uint, 4> Capabilities {
+            GL_BLEND,
+            GL_DEPTH_TEST,
+            GL_CULL_FACE,
+            GL_SCISSOR_TEST
+        };
+
+        // Everything starts as Unknown, see Reset
+        uint m_program{};
+        uint m_vertexArray{};
+        uint m_framebuffer{};
+        std::array<uint, BufferTargets.size()> m_buffers{};
+        std::array<std::array<uint, MaxBufferBindings>, IndexedBufferTargets.size()> m_bufferBases{};
+
+        uint m_activeTexture{};
+        std::array<std::array<uint, TextureTargets.size()>, MaxTextureUnits> m_textures{};
+
+        std::array<uint, Capabilities.size()> m_capabilities{};   // 0 / 1 / Unknown
+        std::array<uint, 2> m_blendFunc{};
+        uint m_depthFunc{};
+        uint m_polygonMode{};
+
+        Counters m_counters{};
+
+        // Returns true if the call has to be issued, updates cached value and counters
+        auto change(Call call, uint& cached, uint value) -> bool;
+
+        template<std::size_t N>
+        static auto find(const std::array<uint, N>& list, uint value) -> uint;
+}; // class StateCache
+
+} // namespace Renderer::GPU
@@ -0,0 +1,70 @@
+/**
+ * @file StorageBuffer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Abstraction of OpenGL Shader Storage Buffer Object (SSBO), general purpose buffer
+ *      written and read by shaders, can also be bound as indirect draw or parameter buffer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class StorageBuffer
+{
+    public:
+        /**
+         * @param data pointer to the data copied into the buffer, nullptr leaves it uninitialized
+         * @param size size of the buffer in bytes
+         */
+        StorageBuffer(const void* data, uint size);
+        ~StorageBuffer();
+
+        StorageBuffer(const StorageBuffer&) = delete;
+        StorageBuffer(StorageBuffer&&) = delete;
+        auto operator=(const StorageBuffer&) -> StorageBuffer& = delete;
+        auto operator=(StorageBuffer&&) -> StorageBuffer& = delete;
+
+        /**
+         * @brief Replaces content of the buffer, old storage is orphaned so the call doesn't wait for the GPU
+         */
+        auto SetData(const void* data, uint size) -> void;
+
+        /**
+         * @brief Overwrites part of the buffer, waits if the GPU still uses it
+         */
+        auto SetSubData(uint offset, const void* data, uint size) -> void;
+
+        /**
+         * @brief Copies start of source buffer to the start of this one on the GPU, nothing waits
+         */
+        auto CopyFrom(const StorageBuffer& source, uint size) -> void;
+
+        /**
+         * @brief Reads part of the buffer back, waits for all commands writing to it
+         */
+        auto GetSubData(uint offset, void* data, uint size) const -> void;
+
+        /**
+         * @brief Binds buffer to the indexed GL_SHADER_STORAGE_BUFFER binding, see StorageBinding in UniformBlocks.hpp
+         */
+        auto BindBase(uint index) const -> void;
+
+        /**
+         * @brief Binds buffer to any non-indexed target, e.g. GL_DRAW_INDIRECT_BUFFER
+         */
+        auto Bind(uint target) const -> void;
+
+        [[nodiscard]] inline auto GetSize() const -> uint { return m_size; }
+    private:
+        uint m_id{};
+        uint m_size{};
+}; // class StorageBuffer
+
+} // namespace Renderer::GPU
@@ -0,0 +1,109 @@
+/**
+ * @file StreamBuffer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Buffer persistently mapped for writing data that changes every frame (instances,
+ *      uniforms, dynamic vertices). Split into regions used by consecutive frames in turn,
+ *      each guarded by a fence, so writing never waits unless the CPU gets that many frames ahead
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+#include <glad/gl.h>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class StreamBuffer
+{
+    public:
+        /**
+         * @brief Part of the current region, written through data until the region's frame ends
+         */
+        struct Allocation {
+            void* data{};
+            uint offset{};  // from the start of the buffer, for vertex offsets, baseInstance or BindRange
+            uint size{};
+        }; // struct Allocation
+
+        struct Stats {
+            uint64_t waits{};           // frames whose region was still used by the GPU
+            double lastWaitMs{};        // last BeginFrame
+            double maxWaitMs{};
+            double totalWaitMs{};
+            uint peakBytes{};           // most bytes allocated in one frame
+            uint64_t overflows{};       // allocations that didn't fit into their region
+        }; // struct Stats
+
+        /**
+         * @param regionSize bytes available to a single frame
+         * @param regions frames that can be in flight, with 3 the CPU can be two frames ahead
+         */
+        StreamBuffer(uint regionSize, uint regions = 3);
+        ~StreamBuffer();
+
+        StreamBuffer(const StreamBuffer&) = delete;
+        StreamBuffer(StreamBuffer&&) = delete;
+        auto operator=(const StreamBuffer&) -> StreamBuffer& = delete;
+        auto operator=(StreamBuffer&&) -> StreamBuffer& = delete;
+
+        /**
+         * @retval bool glBufferStorage and persistent mapping are available (OpenGL 4.4)
+         */
+        static auto IsSupported() -> bool;
+
+        /**
+         * @brief Moves to the next region, waits until the GPU finished the frame that used it before
+         */
+        auto BeginFrame() -> void;
+
+        /**
+         * @brief Fences commands issued since BeginFrame, they are the last ones reading the region
+         */
+        auto EndFrame() -> void;
+
+        /**
+         * @brief Bump allocates from the current region, memory is write-only and visible to the GPU
+         *      without flushing. Offset is a multiple of alignment counted from the start of the buffer,
+         *      so alignment may be a vertex stride or GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+         *
+         * @retval std::nullopt region has no space left for this frame
+         */
+        [[nodiscard]] auto Allocate(uint size, uint alignment = 16) -> std::optional<Allocation>;
+
+        /**
+         * @brief Binds buffer to any non-indexed target, e.g. GL_ARRAY_BUFFER
+         */
+        auto Bind(uint target) const -> void;
+
+        /**
+         * @brief Binds allocation to an indexed target, GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+         */
+        auto BindRange(uint target, uint index, const Allocation& allocation) const -> void;
+
+        [[nodiscard]] inline auto GetRegionSize() const -> uint { return m_regionSize; }
+        [[nodiscard]] inline auto GetStats() const -> const Stats& { return m_stats; }
+        inline auto ResetStats() -> void { m_stats = {}; }
+    private:
+        uint m_id{};
+        uchar* m_data{};
+        uint m_regionSize{};
+        std::vector<GLsync> m_fences{};
+        uint m_region{};
+        uint m_used{};
+        bool m_inFrame{false};
+        Stats m_stats{};
+
+        [[nodiscard]] inline auto regionStart() const -> uint { return m_region * m_regionSize; }
+}; // class StreamBuffer
+
+} // namespace Renderer::GPU
@@ -15,15 +15,30 @@
 #include <iostream>
 #include <filesystem>
 
+#include "JobSystem.hpp"
+#include "Image/Cook.hpp"
+
 #include "jac/type_defs.hpp"
 
 namespace Renderer::GPU
 {
 
+/**
+ * @retval std::optional<uint> internal format taking data of the cooked format as it is,
+ *      std::nullopt if the driver lacks it
+ */
+auto internal_format(Image::Format format) -> std::optional<uint>;
+
 class Texture
 {
     public:
-        Texture(const std::filesystem::path& path);
+        /**
+         * @brief Loads cooked texture (.tex) directly, other images are cooked into
+         *      Image::CacheDirectory on the first load and read from there afterwards
+         *
+         * @param jobs optional, used when the image has to be cooked
+         */
+        Texture(const std::filesystem::path& path, JobSystem* jobs = nullptr);
         ~Texture();
 
         Texture(const Texture&) = delete;
@@ -35,6 +50,8 @@ class Texture
         auto Bind(uint slot) -> void;
         auto Unbind() const -> void;
 
+        [[nodiscard]] inline auto GetId() const -> uint { return m_id; }
+
         [[nodiscard]] auto GetTextureParameters() const {
             struct {
                 int widht;
@@ -49,6 +66,8 @@ class Texture
             return params;
         }
     private:
+        auto loadCooked(const Image::CookedTexture& texture) -> void;
+
         uint m_id{};
         uint m_slot{};
 
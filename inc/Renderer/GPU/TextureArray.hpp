@@ -0,0 +1,59 @@
+/**
+ * @file TextureArray.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Abstraction of OpenGL 2D array texture, images packed into layers of one texture
+ *      so a single binding serves draws mixing any of them
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <glad/gl.h>
+
+#include <vector>
+#include <filesystem>
+
+#include "JobSystem.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class TextureArray
+{
+    public:
+        /**
+         * @brief Packs images into layers in the given order. Layers take the size of the first image,
+         *      the others are resized to it. Layers are cooked (BC3 where the driver has S3TC) and
+         *      cached like Texture's, resized ones included
+         *
+         * @param jobs optional, used when an image has to be cooked
+         */
+        TextureArray(const std::vector<std::filesystem::path>& paths, JobSystem* jobs = nullptr);
+        ~TextureArray();
+
+        TextureArray(const TextureArray&) = delete;
+        TextureArray(TextureArray&&) = delete;
+        auto operator=(const TextureArray&) -> TextureArray& = delete;
+        auto operator=(TextureArray&&) -> TextureArray& = delete;
+
+        auto Bind() const -> void;
+        auto Bind(uint slot) -> void;
+        auto Unbind() const -> void;
+
+        [[nodiscard]] inline auto GetId() const -> uint { return m_id; }
+        [[nodiscard]] inline auto GetLayerCount() const -> uint { return m_layers; }
+        [[nodiscard]] inline auto GetWidth() const -> uint { return m_width; }
+        [[nodiscard]] inline auto GetHeight() const -> uint { return m_height; }
+    private:
+        uint m_id{};
+        uint m_slot{};
+
+        uint m_width{}, m_height{}, m_layers{};
+}; // class TextureArray
+
+} // namespace Renderer::GPU
@@ -0,0 +1,95 @@
+/**
+ * @file Uniform.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Names of uniforms hashed at compile time and typed handles to uniforms of a program,
+ *      so setting a uniform neither hashes nor allocates a string
+ * @version 0.1
+ * @date 2026-10-16
+ * @see Shader.hpp
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+/**
+ * @brief 64 bit FNV-1a, same value at compile time and run time
+ */
+constexpr auto hash_uniform_name(std::string_view name) -> uint64_t
+{
+    uint64_t hash = 0xcbf29ce484222325;
+
+    for (const char c : name)
+    {
+        hash ^= static_cast<uchar>(c);
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Uniform name, hashed when compiled: `shader.SetUniform("uMix", 0.5f)` does no hashing at run time.
+ *      Elements of arrays are named like in GLSL, "uPlanes[2]"
+ */
+struct UniformId {
+    uint64_t hash;
+    const char* name;   // string literal, only for messages
+
+    template<std::size_t N>
+    consteval UniformId(const char (&literal)[N]) :     // NOLINT (google-explicit-constructor)
+        hash{hash_uniform_name({literal, N - 1})},
+        name{literal}
+    {}
+}; // struct UniformId
+
+/**
+ * @brief Uniform of a program whose GLSL type matches T, resolved once with Shader::GetUniform.
+ *      Invalid handles (uniform missing or of another type) are ignored by Shader::Set
+ */
+template<typename T>
+struct Uniform {
+    static constexpr uint Invalid = std::numeric_limits<uint>::max();
+
+    uint index{Invalid};    // into the program's reflected uniforms
+
+    [[nodiscard]] constexpr auto isValid() const -> bool { return index != Invalid; }
+}; // struct Uniform
+
+/**
+ * @brief GLSL type a C++ type is uploaded to, 0 for unsupported types
+ */
+template<typename T>
+constexpr uint UniformType =
+    std::is_same_v<T, float> ? GL_FLOAT :
+    std::is_same_v<T, glm::vec2> ? GL_FLOAT_VEC2 :
+    std::is_same_v<T, glm::vec3> ? GL_FLOAT_VEC3 :
+    std::is_same_v<T, glm::vec4> ? GL_FLOAT_VEC4 :
+    std::is_same_v<T, int> ? GL_INT :
+    std::is_same_v<T, glm::ivec2> ? GL_INT_VEC2 :
+    std::is_same_v<T, glm::ivec3> ? GL_INT_VEC3 :
+    std::is_same_v<T, glm::ivec4> ? GL_INT_VEC4 :
+    std::is_same_v<T, uint> ? GL_UNSIGNED_INT :
+    std::is_same_v<T, glm::uvec2> ? GL_UNSIGNED_INT_VEC2 :
+    std::is_same_v<T, glm::uvec3> ? GL_UNSIGNED_INT_VEC3 :
+    std::is_same_v<T, glm::uvec4> ? GL_UNSIGNED_INT_VEC4 :
+    std::is_same_v<T, glm::mat2> ? GL_FLOAT_MAT2 :
+    std::is_same_v<T, glm::mat3> ? GL_FLOAT_MAT3 :
+    std::is_same_v<T, glm::mat4> ? GL_FLOAT_MAT4 :
+    0;
+
+} // namespace Renderer::GPU
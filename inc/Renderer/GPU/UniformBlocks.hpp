@@ -0,0 +1,95 @@
+/**
+ * @file UniformBlocks.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Interface blocks shared by all programs: std140 uniform blocks uploaded once per frame,
+ *      and the binding point of every named uniform and shader storage block. Shader assigns
+ *      these bindings after linking, so GLSL declares blocks by name only
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+namespace UniformBinding
+{
+    constexpr uint Camera = 0;
+    constexpr uint Frame = 1;
+    constexpr uint Lighting = 2;
+} // namespace UniformBinding
+
+namespace StorageBinding
+{
+    constexpr uint Instances = 0;   // PackedBoxInstance per box
+    constexpr uint Spheres = 1;     // bounding sphere per box
+    constexpr uint Visible = 2;     // visible box indices written by culling
+    constexpr uint Draws = 3;       // indirect draw commands
+    constexpr uint Textures = 4;    // bindless texture handles
+} // namespace StorageBinding
+
+/**
+ * @brief `layout (std140) uniform Camera`, matrices are column-major like in glm
+ */
+struct CameraBlock {
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 viewProjection;
+    glm::vec4 position;     // w unused
+}; // struct CameraBlock
+
+/**
+ * @brief `layout (std140) uniform Frame`
+ */
+struct alignas(16) FrameBlock {
+    float mix;              // between the two textures of a box
+}; // struct FrameBlock
+
+/**
+ * @brief `layout (std140) uniform Lighting`
+ */
+struct LightingBlock {
+    glm::vec4 color;        // w unused
+}; // struct LightingBlock
+
+// std140 rounds blocks up to 16 bytes and places vec4 and matrix columns at multiples of 16
+static_assert(sizeof(CameraBlock) == 208 && offsetof(CameraBlock, position) == 192);
+static_assert(sizeof(FrameBlock) == 16);
+static_assert(sizeof(LightingBlock) == 16);
+
+struct BlockBinding {
+    std::string_view name;  // block name in GLSL, not instance name
+    uint binding;
+}; // struct BlockBinding
+
+constexpr std::array UniformBlockBindings{
+    BlockBinding{"Camera", UniformBinding::Camera},
+    BlockBinding{"Frame", UniformBinding::Frame},
+    BlockBinding{"Lighting", UniformBinding::Lighting}
+};
+
+constexpr std::array StorageBlockBindings{
+    BlockBinding{"Instances", StorageBinding::Instances},
+    BlockBinding{"Spheres", StorageBinding::Spheres},
+    BlockBinding{"Visible", StorageBinding::Visible},
+    BlockBinding{"Draws", StorageBinding::Draws},
+    BlockBinding{"Textures", StorageBinding::Textures}
+};
+
+/**
+ * @brief Sets binding point of every registered block the linked program declares, others are left alone
+ */
+auto bind_blocks(uint program) -> void;
+
+} // namespace Renderer::GPU
@@ -0,0 +1,60 @@
+/**
+ * @file UniformBuffer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Abstraction of OpenGL Uniform Buffer Object (UBO), backs uniform blocks shared by programs
+ * @version 0.1
+ * @date 2026-10-16
+ * @see UniformBlocks.hpp
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer::GPU
+{
+
+class UniformBuffer
+{
+    public:
+        /**
+         * @param data pointer to the data copied into the buffer, nullptr leaves it uninitialized
+         * @param size size of the buffer in bytes
+         */
+        UniformBuffer(const void* data, uint size);
+        ~UniformBuffer();
+
+        UniformBuffer(const UniformBuffer&) = delete;
+        UniformBuffer(UniformBuffer&&) = delete;
+        auto operator=(const UniformBuffer&) -> UniformBuffer& = delete;
+        auto operator=(UniformBuffer&&) -> UniformBuffer& = delete;
+
+        /**
+         * @brief Offsets of ranges bound with BindRange have to be multiples of this
+         */
+        static auto GetOffsetAlignment() -> uint;
+
+        /**
+         * @brief Replaces content of the buffer, old storage is orphaned so the call doesn't wait for the GPU
+         */
+        auto SetData(const void* data, uint size) -> void;
+
+        /**
+         * @brief Binds whole buffer to the indexed GL_UNIFORM_BUFFER binding, see UniformBinding
+         */
+        auto BindBase(uint index) const -> void;
+
+        /**
+         * @brief Binds part of the buffer, offset has to be a multiple of GetOffsetAlignment
+         */
+        auto BindRange(uint index, uint offset, uint size) const -> void;
+
+        [[nodiscard]] inline auto GetSize() const -> uint { return m_size; }
+    private:
+        uint m_id{};
+        uint m_size{};
+}; // class UniformBuffer
+
+} // namespace Renderer::GPU
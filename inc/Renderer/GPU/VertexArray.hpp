@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include "Renderer/GPU/StreamBuffer.hpp"
 #include "Renderer/GPU/VertexBuffer.hpp"
 #include "Renderer/GPU/VertexBufferLayout.hpp"
 
@@ -27,12 +28,25 @@ class VertexArray
         auto operator=(const VertexArray&) -> VertexArray& = delete;
         auto operator=(VertexArray&&) -> VertexArray& = delete;
 
+        /**
+         * @brief Adds buffer to the vertex array, attributes of every added buffer
+         *      are placed after attributes of previously added ones
+         */
         auto AddBuffer(const VertexBuffer& vb, const VertexBufferLayout& layout) -> void;
+        /**
+         * @brief Adds stream buffer, attributes start at its beginning, allocations are
+         *      selected with base vertex or base instance of the draw
+         */
+        auto AddBuffer(const StreamBuffer& sb, const VertexBufferLayout& layout) -> void;
 
         auto Bind() const -> void;
         auto Unbind() const -> void;
     private:
         uint m_id{};
+        uint m_AttribCount{};
+
+        // Buffer has to be bound to GL_ARRAY_BUFFER
+        auto addAttributes(const VertexBufferLayout& layout) -> void;
 }; // class VertexArray
 
 } // namespace Renderer::GPU
@@ -18,7 +18,11 @@ namespace Renderer::GPU
 class VertexBuffer
 {
     public:
-        VertexBuffer(const void* data,  uint size);
+        /**
+         * @param data pointer to the data copied into the buffer
+         * @param size size of the data in bytes
+         */
+        VertexBuffer(const void* data, uint size);
         ~VertexBuffer();
 
         VertexBuffer(const VertexBuffer&) = delete;
@@ -26,6 +30,14 @@ class VertexBuffer
         auto operator=(const VertexBuffer&) -> VertexBuffer& = delete;
         auto operator=(VertexBuffer&&) -> VertexBuffer& = delete;
 
+        /**
+         * @brief Replaces content of the buffer, old storage is orphaned so the call doesn't wait for the GPU
+         * 
+         * @param data pointer to the data copied into the buffer
+         * @param size size of the data in bytes
+         */
+        auto SetData(const void* data, uint size) -> void;
+
         auto Bind() const -> void;
         auto Unbind() const -> void;
     private:
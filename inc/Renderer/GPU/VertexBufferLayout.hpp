@@ -14,18 +14,32 @@
 
 #include <vector>
 #include <cassert>
+#include <cstdint>
 
 #include "jac/type_defs.hpp"
 
 namespace Renderer::GPU
 {
 
+// Attribute types without a C++ counterpart, pushed as Push<Half>(count) and Push<Snorm10x3>(4)
+struct Half {
+    uint16_t bits;
+}; // struct Half
+
+// Signed normalized x, y, z in 10 bits each and w in the top 2 (GL_INT_2_10_10_10_REV), count is always 4
+struct Snorm10x3 {
+    uint32_t bits;
+}; // struct Snorm10x3
+
 struct VertexBufferElement 
 {
     uint count;
     uint type;
     uchar normalized;
 
+    /**
+     * @retval uint size of one component, packed types give size of the whole attribute
+     */
     static auto GetSizeOfType(uint type) -> uint
     {
         switch (type)
@@ -33,9 +47,29 @@ struct VertexBufferElement
             case GL_FLOAT: return sizeof(GLfloat);
             case GL_UNSIGNED_INT: return sizeof(GLuint);
             case GL_UNSIGNED_BYTE: return sizeof(GLbyte);
+            case GL_HALF_FLOAT: return sizeof(GLhalf);
+            case GL_SHORT: return sizeof(GLshort);
+            case GL_UNSIGNED_SHORT: return sizeof(GLushort);
+            case GL_INT_2_10_10_10_REV: return sizeof(GLuint);
             default: return 0;
         }
     }
+
+    static auto IsPacked(uint type) -> bool { return type == GL_INT_2_10_10_10_REV; }
+
+    // Integer types not normalized are read as integers (uint/uvec in shaders)
+    static auto IsInteger(uint type) -> bool
+    {
+        return type == GL_UNSIGNED_INT || type == GL_UNSIGNED_SHORT || type == GL_UNSIGNED_BYTE || type == GL_SHORT;
+    }
+
+    /**
+     * @retval uint bytes taken by the attribute in a vertex
+     */
+    [[nodiscard]] auto GetSize() const -> uint
+    {
+        return IsPacked(type) ? GetSizeOfType(type) : count * GetSizeOfType(type);
+    }
 }; // struct VertexBufferElement
 
 class VertexBufferLayout
@@ -47,12 +81,38 @@ class VertexBufferLayout
             assert(false);
         }
 
+        /**
+         * @brief Appends element as it is, e.g. one read back from a file
+         */
+        inline auto Push(const VertexBufferElement& element) -> void
+        {
+            m_Elements.push_back(element);
+            m_Stride += element.GetSize();
+        }
+
+        /**
+         * @brief Sets how often attributes of this layout advance,
+         *      0 - every vertex (default), N - every N instances
+         */
+        inline auto SetDivisor(uint divisor) -> void { m_Divisor = divisor; }
+
         [[nodiscard]] inline auto GetElements() const -> const std::vector<VertexBufferElement>& { return m_Elements; }
         [[nodiscard]] inline auto GetStride() const -> uint { return m_Stride; }
+        [[nodiscard]] inline auto GetDivisor() const -> uint { return m_Divisor; }
 
     private:
         std::vector<VertexBufferElement> m_Elements{};
         uint m_Stride{};
+        uint m_Divisor{};
 }; // class VertexBufferLayout
 
+// Defined in VertexBufferLayout.cpp, declared so the asserting primary template isn't used instead
+template<> auto VertexBufferLayout::Push<float>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<uint>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<u_char>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<short>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<u_short>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<Half>(uint count) -> void;
+template<> auto VertexBufferLayout::Push<Snorm10x3>(uint count) -> void;
+
 } // namespace Renderer::GPU
@@ -0,0 +1,47 @@
+/**
+ * @file MeshBuffers.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Vertex and index buffers of a mesh with their layout, ready for VertexArray::AddBuffer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <span>
+#include <memory>
+
+#include "Mesh/Obj.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Renderer/GPU/IndexBuffer.hpp"
+#include "Renderer/GPU/VertexBuffer.hpp"
+#include "Renderer/GPU/VertexBufferLayout.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+struct MeshBuffers {
+    GPU::VertexBufferLayout layout{};
+    std::unique_ptr<GPU::VertexBuffer> vertices{};
+    std::unique_ptr<GPU::IndexBuffer> indices{};    // nullptr for non-indexed meshes
+    uint vertexCount{};
+}; // struct MeshBuffers
+
+/**
+ * @brief Copies vertex data with given layout and optional indices into new buffers
+ */
+auto upload_mesh(std::span<const uchar> vertices, std::span<const uint> indices, const GPU::VertexBufferLayout& layout) -> MeshBuffers;
+
+auto upload_mesh(const Mesh::MeshData& mesh) -> MeshBuffers;
+auto upload_mesh(const Mesh::MappedMesh& mesh) -> MeshBuffers;
+
+/**
+ * @brief Position (3 floats), texture coordinates (2 floats) and normal (3 floats) layout
+ */
+auto upload_mesh(const Mesh::ObjMesh& mesh) -> MeshBuffers;
+
+} // namespace Renderer
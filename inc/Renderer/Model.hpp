@@ -0,0 +1,34 @@
+/**
+ * @file Model.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Vertex data and its layout read from text model files (res/models/*.dat)
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <vector>
+#include <filesystem>
+
+#include "Renderer/GPU/VertexBufferLayout.hpp"
+
+namespace Renderer
+{
+
+struct Model {
+    std::vector<float> vertices;
+    GPU::VertexBufferLayout layout;
+}; // struct Model
+
+/**
+ * @brief Reads model file, "float N" lines describe the layout, every other line is a single value
+ * 
+ * @param path path to the model file
+ * @retval Model read model, empty if file couldn't be opened
+ */
+auto read_model(const std::filesystem::path& path) -> Model;
+
+} // namespace Renderer
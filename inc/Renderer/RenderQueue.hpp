@@ -0,0 +1,105 @@
+/**
+ * @file RenderQueue.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Draw packets with 64-bit sort keys, sorted every frame with a parallel radix sort,
+ *      so submission is grouped by state and ordered by depth
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+#include "JobSystem.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+class RenderQueue
+{
+    public:
+        enum class Pass : uint {
+            Opaque,         // grouped by state, front to back inside a group for early-Z
+            Transparent     // back to front, state only breaks ties
+        };
+
+        struct Packet {
+            uint64_t key;
+            uint payload;   // meaning is up to the submitter, e.g. instance index
+        }; // struct Packet
+
+        /**
+         * @brief Key layout, most significant first. Opaque:
+         *      pass(2) | program(10) | textures(12) | vertex array(10) | depth(30)
+         *      transparent:
+         *      pass(2) | inverted depth(30) | program(10) | textures(12) | vertex array(10)
+         */
+        struct KeyBits {
+            static constexpr uint Pass = 2;
+            static constexpr uint Program = 10;
+            static constexpr uint Textures = 12;
+            static constexpr uint VertexArray = 10;
+            static constexpr uint Depth = 30;
+        }; // struct KeyBits
+
+        static constexpr uint RadixBits = 8;
+        static constexpr uint PacketsPerJob = 64 * 1024;
+
+        explicit RenderQueue(JobSystem& jobs);
+        ~RenderQueue() = default;
+
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue(RenderQueue&&) = delete;
+        auto operator=(const RenderQueue&) -> RenderQueue& = delete;
+        auto operator=(RenderQueue&&) -> RenderQueue& = delete;
+
+        inline auto clear() -> void { m_packets.clear(); }
+        inline auto push(uint64_t key, uint payload) -> void { m_packets.push_back({key, payload}); }
+
+        /**
+         * @brief Appends count packets to be filled by the caller, possibly from many jobs
+         */
+        auto allocate(uint count) -> std::span<Packet>;
+
+        /**
+         * @brief Stable LSD radix sort by key, 8 bits per pass, passes where all keys
+         *      share the digit are skipped. Chunks are histogrammed and scattered in parallel
+         */
+        auto sort() -> void;
+
+        [[nodiscard]] inline auto getPackets() const -> const std::vector<Packet>& { return m_packets; }
+        [[nodiscard]] inline auto size() const -> uint { return m_packets.size(); }
+
+        /**
+         * @param depth distance from the camera, negative values are clamped to 0
+         */
+        static auto make_key(Pass pass, uint program, uint textures, uint vertexArray, float depth) -> uint64_t;
+
+        static auto get_pass(uint64_t key) -> Pass;
+        static auto get_program(uint64_t key) -> uint;
+        static auto get_textures(uint64_t key) -> uint;
+        static auto get_vertex_array(uint64_t key) -> uint;
+
+        /**
+         * @brief Monotonic quantization of non-negative depth to KeyBits::Depth bits,
+         *      keeps float's relative precision (finer close to the camera)
+         */
+        static auto quantize_depth(float depth) -> uint;
+    private:
+        static constexpr uint Buckets = 1u << RadixBits;
+
+        JobSystem& m_jobs;
+
+        std::vector<Packet> m_packets{};
+        std::vector<Packet> m_scratch{};
+        std::vector<uint> m_histograms{};     // Buckets counters per chunk
+}; // class RenderQueue
+
+} // namespace Renderer
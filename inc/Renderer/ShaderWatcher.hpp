@@ -0,0 +1,47 @@
+/**
+ * @file ShaderWatcher.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Watches a shader directory with inotify and reports files written since the last poll,
+ *      so programs built from them can be reloaded while the program runs
+ * @version 0.1
+ * @date 2026-10-16
+ * @see GPU/Shader.hpp
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <filesystem>
+
+namespace Renderer
+{
+
+class ShaderWatcher
+{
+    public:
+        /**
+         * @param directory watched for files written, or moved in (editors often save by renaming a temporary file)
+         */
+        explicit ShaderWatcher(const std::filesystem::path& directory);
+        ~ShaderWatcher();
+
+        ShaderWatcher(const ShaderWatcher&) = delete;
+        ShaderWatcher(ShaderWatcher&&) = delete;
+        auto operator=(const ShaderWatcher&) -> ShaderWatcher& = delete;
+        auto operator=(ShaderWatcher&&) -> ShaderWatcher& = delete;
+
+        [[nodiscard]] inline auto isValid() const -> bool { return m_watch >= 0; }
+
+        /**
+         * @brief Files changed since the last call, each once. Never blocks, cheap enough for every frame
+         */
+        auto poll() -> std::vector<std::filesystem::path>;
+    private:
+        std::filesystem::path m_directory;
+        int m_fd{-1};
+        int m_watch{-1};
+}; // class ShaderWatcher
+
+} // namespace Renderer
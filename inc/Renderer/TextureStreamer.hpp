@@ -0,0 +1,140 @@
+/**
+ * @file TextureStreamer.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Streams textures in without blocking the frame, images are decoded and mipmapped
+ *      on workers and uploaded through a pool of pixel buffer objects, coarsest levels first.
+ *      Finest levels of textures not used recently are evicted to stay within a memory budget
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <glad/gl.h>
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+
+#include "JobSystem.hpp"
+#include "Image/Image.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+/**
+ * @brief Textures are RGBA8 with a full mip chain, levels become resident from the coarsest one.
+ *      Adding or dropping a level reallocates the texture and copies the other levels on the GPU,
+ *      the bound texture is always complete. Needs OpenGL 4.5 (DSA)
+ */
+class TextureStreamer
+{
+    public:
+        using Handle = uint;
+
+        struct Settings {
+            uint64_t budgetBytes = 256ull << 20;        // GPU memory of resident levels
+            uint64_t uploadBytesPerFrame = 4ull << 20;  // pixels copied to PBOs every update
+            uint pixelBuffers = 4;                      // PBOs in the pool, reused once their fence signals
+            uint pixelBufferSize = 1u << 20;            // bytes, levels are uploaded in strips of rows fitting one
+            uint tailSize = 32;                         // levels up to this size are uploaded at once, right after decoding
+            uint evictAfterFrames = 120;                // textures not bound for this long can lose levels
+        }; // struct Settings
+
+        struct Stats {
+            uint64_t uploadedBytes{};   // last update
+            uint64_t evictedBytes{};    // last update
+            uint64_t residentBytes{};
+            uint64_t budgetBytes{};
+            uint streaming{};           // textures still decoding or missing levels
+            uint textures{};
+        }; // struct Stats
+
+        explicit TextureStreamer(JobSystem& jobs);
+        TextureStreamer(JobSystem& jobs, const Settings& settings);
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer(TextureStreamer&&) = delete;
+        auto operator=(const TextureStreamer&) -> TextureStreamer& = delete;
+        auto operator=(TextureStreamer&&) -> TextureStreamer& = delete;
+
+        /**
+         * @brief Starts decoding image on a worker, until its first levels are uploaded a grey placeholder is bound
+         */
+        auto request(const std::filesystem::path& path) -> Handle;
+
+        /**
+         * @brief Binds texture (or the placeholder) to given unit and marks it as used this frame.
+         *      Texture object changes when levels are streamed in, so it has to be bound after every update
+         */
+        auto bind(Handle handle, uint slot) -> void;
+
+        /**
+         * @brief Uploads decoded images and next levels within the per-frame limit, evicts levels over budget.
+         *      Call once per frame on the OpenGL thread, before binding
+         */
+        auto update() -> void;
+
+        [[nodiscard]] inline auto getStats() const -> const Stats& { return m_stats; }
+
+        /**
+         * @retval uint number of resident levels, 0 while the placeholder is used
+         */
+        [[nodiscard]] auto getResidentLevels(Handle handle) const -> uint;
+    private:
+        using Level = Image::Bitmap;
+
+        struct Entry {
+            std::filesystem::path path;
+            JobSystem::Counter decoded{};
+            std::vector<Level> levels{};    // finest first, written by the decoding job, empty if it failed.
+                                            // Kept after upload, so evicted levels can be streamed in again
+            bool ready{false};              // decoded and handled by update
+            uint tail{};                    // coarsest levels from this one on are never evicted
+
+            uint texture{};                 // holds levels [top, levels.size())
+            uint top{};
+            uint64_t lastUsed{};
+
+            // Next finer level is uploaded into a new texture, swapped in when all rows are there
+            uint staging{};
+            uint stagingRow{};
+        }; // struct Entry
+
+        struct PixelBuffer {
+            uint buffer{};
+            GLsync fence{};
+        }; // struct PixelBuffer
+
+        JobSystem& m_jobs;  // NOLINT (cppcoreguidelines-avoid-const-or-ref-data-members)
+        Settings m_settings;
+
+        std::vector<std::unique_ptr<Entry>> m_entries{};
+        std::vector<PixelBuffer> m_pixelBuffers{};
+        uint m_placeholder{};
+
+        uint64_t m_frame{};
+        Stats m_stats{};
+
+        auto initialize(Entry& entry) -> void;
+        auto stream(Entry& entry, uint64_t& bandwidth) -> void;
+        auto evict(Entry& entry) -> bool;
+        // Evicts levels of textures not used recently, least recently used first, until bytes fit in the budget
+        auto makeRoom(uint64_t bytes, const Entry* keep) -> bool;
+
+        // Empty texture with storage for levels [top, levels.size()) of entry
+        auto allocate(const Entry& entry, uint top) -> uint;
+        auto copyLevels(const Entry& entry, uint source, uint sourceTop, uint destination, uint destinationTop) -> void;
+        auto acquirePixelBuffer() -> PixelBuffer*;
+
+        static auto decode(Entry& entry) -> void;
+        auto destroy(uint texture) -> void;
+}; // class TextureStreamer
+
+} // namespace Renderer
@@ -0,0 +1,123 @@
+/**
+ * @file AABB.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Axis aligned bounding box and ray
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <limits>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+namespace Scene
+{
+
+struct AABB
+{
+    // Default box is empty, growing it by anything gives that thing's bounds
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{std::numeric_limits<float>::lowest()};
+
+    inline auto grow(const glm::vec3& point) -> void
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    inline auto grow(const AABB& other) -> void
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    [[nodiscard]] inline auto isEmpty() const -> bool { return min.x > max.x || min.y > max.y || min.z > max.z; }
+    [[nodiscard]] inline auto center() const -> glm::vec3 { return (min + max) * 0.5f; }
+    [[nodiscard]] inline auto extent() const -> glm::vec3 { return max - min; }
+
+    [[nodiscard]] inline auto surfaceArea() const -> float
+    {
+        if (isEmpty())
+            return 0.f;
+
+        const glm::vec3 e = extent();
+        return 2.f * (e.x * e.y + e.y * e.z + e.z * e.x);
+    }
+
+    [[nodiscard]] inline auto overlaps(const AABB& other) const -> bool
+    {
+        return min.x <= other.max.x && max.x >= other.min.x &&
+               min.y <= other.max.y && max.y >= other.min.y &&
+               min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    /**
+     * @brief Squared distance from point to the box, 0 if point is inside
+     */
+    [[nodiscard]] inline auto distanceSquared(const glm::vec3& point) const -> float
+    {
+        const glm::vec3 d = glm::max(glm::max(min - point, point - max), glm::vec3{0.f});
+        return glm::dot(d, d);
+    }
+
+    /**
+     * @brief Bounds of this box after transforming it by matrix (Arvo's method)
+     */
+    [[nodiscard]] inline auto transformed(const glm::mat4& matrix) const -> AABB
+    {
+        AABB result;
+        result.min = result.max = glm::vec3{matrix[3]};
+
+        for (int column = 0; column < 3; column++)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                const float a = matrix[column][row] * min[column];
+                const float b = matrix[column][row] * max[column];
+
+                result.min[row] += std::min(a, b);
+                result.max[row] += std::max(a, b);
+            }
+        }
+
+        return result;
+    }
+}; // struct AABB
+
+struct Ray
+{
+    glm::vec3 origin;
+    glm::vec3 direction;    // doesn't have to be normalized, distances are then in its units
+}; // struct Ray
+
+/**
+ * @brief Slab test of ray against box
+ * 
+ * @param invDirection 1 / ray.direction, computed once per ray
+ * @param tMin, tMax range of the ray that is tested, on hit tMin is set to entry distance
+ * @retval bool whether ray hits the box within the range
+ */
+inline auto intersect(const Ray& ray, const glm::vec3& invDirection, const AABB& box, float& tMin, float tMax) -> bool
+{
+    const glm::vec3 t0 = (box.min - ray.origin) * invDirection;
+    const glm::vec3 t1 = (box.max - ray.origin) * invDirection;
+
+    const glm::vec3 tNear = glm::min(t0, t1);
+    const glm::vec3 tFar = glm::max(t0, t1);
+
+    const float enter = std::max({tMin, tNear.x, tNear.y, tNear.z});
+    const float exit = std::min({tMax, tFar.x, tFar.y, tFar.z});
+
+    if (enter > exit)
+        return false;
+
+    tMin = enter;
+    return true;
+}
+
+} // namespace Scene
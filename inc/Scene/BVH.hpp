@@ -0,0 +1,101 @@
+/**
+ * @file BVH.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Bounding volume hierarchy over object bounds, built with binned SAH,
+ *      nodes are stored in one array with siblings next to each other
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <optional>
+#include <functional>
+
+#include "Renderer/Frustum.hpp"
+#include "Scene/AABB.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Scene
+{
+
+class BVH
+{
+    public:
+        /**
+         * @brief 32 bytes, two nodes per cache line. Leaf if count > 0, objects of a leaf
+         *      are [first, first + count) in getObjects(), children of inner node are [first, first + 1]
+         */
+        struct Node {
+            glm::vec3 min;
+            uint first;
+            glm::vec3 max;
+            uint count;
+        }; // struct Node
+
+        struct Hit {
+            uint object;
+            float distance;
+        }; // struct Hit
+
+        // Exact test of ray against object, returns distance or nullopt on miss
+        using RayTest = std::function<std::optional<float>(uint object, const Ray& ray)>;
+
+        /**
+         * @brief Builds hierarchy from scratch, object i is bounded by bounds[i]
+         */
+        auto build(const std::vector<AABB>& bounds) -> void;
+
+        /**
+         * @brief Updates bounds of all nodes without changing the tree, for objects that moved.
+         *      Fast but the tree degrades if objects move far, build() again in that case
+         */
+        auto refit(const std::vector<AABB>& bounds) -> void;
+
+        auto queryFrustum(const Renderer::Frustum& frustum, std::vector<uint>& out) const -> void;
+        auto queryAABB(const AABB& box, std::vector<uint>& out) const -> void;
+        auto querySphere(const glm::vec3& center, float radius, std::vector<uint>& out) const -> void;
+
+        /**
+         * @brief Finds nearest object hit by the ray
+         * 
+         * @param test exact test of object, if empty object bounds are used
+         */
+        [[nodiscard]] auto raycast(
+            const Ray& ray,
+            float maxDistance = std::numeric_limits<float>::max(),
+            const RayTest& test = {}
+        ) const -> std::optional<Hit>;
+
+        /**
+         * @brief Surface area of all nodes relative to the root (SAH cost of traversal) divided by
+         *      the same right after build(), 1 for a fresh tree. Grows as refit() loosens nodes
+         */
+        [[nodiscard]] inline auto getDegradation() const -> float { return m_buildCost > 0.f ? m_cost / m_buildCost : 1.f; }
+
+        [[nodiscard]] inline auto getNodes() const -> const std::vector<Node>& { return m_nodes; }
+        [[nodiscard]] inline auto getObjects() const -> const std::vector<uint>& { return m_objects; }
+        [[nodiscard]] inline auto empty() const -> bool { return m_nodes.empty(); }
+    private:
+        std::vector<Node> m_nodes{};
+        std::vector<uint> m_objects{};      // object indices in leaf order
+        std::vector<AABB> m_bounds{};       // bounds in leaf order, m_bounds[i] belongs to m_objects[i]
+        float m_cost{};                     // summed node areas relative to root area
+        float m_buildCost{};                // m_cost after the last build()
+
+        [[nodiscard]] auto areaCost() const -> float;
+
+        auto subdivide(uint node, std::vector<glm::vec3>& centroids) -> bool;
+
+        template<typename NodeTest, typename ObjectTest>
+        auto query(NodeTest&& nodeTest, ObjectTest&& objectTest, std::vector<uint>& out) const -> void;
+
+        static auto boundsOf(const Node& node) -> AABB { return {node.min, node.max}; }
+}; // class BVH
+
+} // namespace Scene
@@ -0,0 +1,83 @@
+/**
+ * @file Box.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Box object placed in the scene, generation of random box fields
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+#include <optional>
+
+#include <glm/glm.hpp>
+
+#include "Scene/Transform.hpp"
+
+#include "jac/type_defs.hpp"
+
+namespace Scene
+{
+
+struct Box {
+    glm::vec3 position;
+    float scale;
+    glm::vec3 rotation;
+    glm::vec3 color;
+    std::array<uint, 2> textures{0, 1};   // images mixed on the box, indices into the renderer's texture set
+}; // struct Box
+
+/**
+ * @brief Creates a field of randomly placed, rotated and colored boxes,
+ *      first box is a huge "sky box" and the last one is a big box far away
+ * 
+ * @param count number of boxes to create
+ * @param seed same seed gives the same field, random field if not given
+ * @retval std::vector<Box> created boxes
+ */
+auto create_boxes(const uint count, const std::optional<uint> seed = std::nullopt) -> std::vector<Box>;
+
+/**
+ * @brief Gives every box a random pair of images out of textureCount (equal ones included)
+ *
+ * @param seed same seed gives the same pairs, random pairs if not given
+ */
+auto assign_textures(std::vector<Box>& boxes, uint textureCount, const std::optional<uint> seed = std::nullopt) -> void;
+
+auto to_transform(const Box& box) -> Transform;
+
+/**
+ * @brief Builds model matrix of a box (translation * rotation(x, y, z) * scale)
+ */
+auto model_matrix(const Box& box) -> glm::mat4;
+
+/**
+ * @brief Nodes created for boxes by add_boxes
+ */
+struct BoxNodes {
+    std::vector<TransformHierarchy::Node> groups;   // children of the root, parents of the boxes
+    std::vector<TransformHierarchy::Node> boxes;    // i-th node belongs to i-th box
+}; // struct BoxNodes
+
+/**
+ * @brief Adds boxes to hierarchy, boxes are spread evenly between groupCount group nodes
+ *      with identity transform, so moving one group moves only a part of the field
+ */
+auto add_boxes(TransformHierarchy& hierarchy, const std::vector<Box>& boxes, uint groupCount) -> BoxNodes;
+
+// Radius of sphere enclosing box mesh with scale 1 in any rotation, mesh spans [-0.5, 0.5] on every axis
+constexpr float UnitBoxRadius = 0.8660254f; // sqrt(3) / 2
+
+/**
+ * @brief Radius of sphere enclosing the box in any rotation
+ */
+inline auto bounding_radius(const Box& box) -> float
+{
+    return box.scale * UnitBoxRadius;
+}
+
+} // namespace Scene
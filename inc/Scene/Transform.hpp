@@ -0,0 +1,110 @@
+/**
+ * @file Transform.hpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Transform hierarchy (scene graph) with cached local/world matrices,
+ *      only subtrees of changed nodes are recomputed on update
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#pragma once
+
+#include <vector>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "jac/type_defs.hpp"
+
+namespace Scene
+{
+
+struct Transform {
+    glm::vec3 position{0.f};
+    glm::vec3 rotation{0.f};    // euler angles in radians, applied in X, Y, Z order
+    glm::vec3 scale{1.f};
+}; // struct Transform
+
+/**
+ * @brief Builds matrix translation * rotation(x, y, z) * scale
+ */
+auto local_matrix(const Transform& transform) -> glm::mat4;
+
+class TransformHierarchy
+{
+    public:
+        using Node = uint;
+
+        static constexpr Node Root = 0;
+        static constexpr Node None = std::numeric_limits<Node>::max();
+
+        TransformHierarchy();
+        ~TransformHierarchy() = default;
+
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy(TransformHierarchy&&) = delete;
+        auto operator=(const TransformHierarchy&) -> TransformHierarchy& = delete;
+        auto operator=(TransformHierarchy&&) -> TransformHierarchy& = delete;
+
+        /**
+         * @brief Creates node as the last child of parent, its matrices are valid after next update()
+         */
+        auto create(const Transform& local, Node parent = Root) -> Node;
+
+        /**
+         * @brief Removes every node except root
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Changes local transform, node and its subtree are recomputed on next update()
+         */
+        auto setLocal(Node node, const Transform& local) -> void;
+
+        /**
+         * @brief Recomputes matrices of changed nodes and their descendants, nothing is done if no node changed
+         * 
+         * @retval uint number of nodes whose world matrix was recomputed
+         */
+        auto update() -> uint;
+
+        [[nodiscard]] inline auto getLocal(Node node) const -> const Transform& { return m_local[node]; }
+        [[nodiscard]] inline auto getWorld(Node node) const -> const glm::mat4& { return m_world[node]; }
+        [[nodiscard]] inline auto getParent(Node node) const -> Node { return m_parent[node]; }
+        [[nodiscard]] inline auto size() const -> uint { return m_parent.size(); }
+
+        /**
+         * @brief Nodes recomputed by the last update() that changed anything, only describes the step
+         *      from getSerial() - 1. Users that missed more updates have to read every node
+         */
+        [[nodiscard]] inline auto getUpdated() const -> const std::vector<Node>& { return m_updated; }
+
+        /**
+         * @brief Incremented by every update() that recomputed at least one node,
+         *      lets users of the hierarchy know if they're out of date
+         */
+        [[nodiscard]] inline auto getSerial() const -> uint { return m_serial; }
+    private:
+        std::vector<Node> m_parent{};
+        std::vector<Node> m_firstChild{};
+        std::vector<Node> m_lastChild{};
+        std::vector<Node> m_nextSibling{};
+        std::vector<uint> m_depth{};
+
+        std::vector<Transform> m_local{};
+        std::vector<glm::mat4> m_localMatrix{};
+        std::vector<glm::mat4> m_world{};
+
+        std::vector<bool> m_dirty{};    // local transform changed since last update
+        std::vector<Node> m_dirtyNodes{};
+
+        std::vector<Node> m_updated{};
+        std::vector<Node> m_stack{};
+        uint m_serial{};
+
+        auto updateSubtree(Node node) -> void;
+}; // class TransformHierarchy
+
+} // namespace Scene
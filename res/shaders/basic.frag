@@ -5,7 +5,9 @@ in vec2 texCoord;
 
 uniform sampler2D uTexture_0;
 uniform sampler2D uTexture_1;
-uniform float uMix;
+layout (std140) uniform Frame {
+    float uMix;
+};
 uniform vec4 uColor;
 
 void main()
@@ -4,14 +4,24 @@ layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord;
 
 out vec2 texCoord;
+out vec4 color;
+flat out uvec2 textures;
 
+uniform vec4 uColor;
+uniform uvec2 uBoxTextures;
 uniform vec3 uOffset;
 uniform mat4 uModel;
-uniform mat4 uView;
-uniform mat4 uProjection;
+layout (std140) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    vec4 uCameraPosition;
+};
 
 void main()
 {
-    gl_Position = uProjection * uView * uModel * vec4(aPos + uOffset, 1.0);
+    gl_Position = uViewProjection * uModel * vec4(aPos + uOffset, 1.0);
     texCoord = aTexCoord;
+    color = uColor;
+    textures = uBoxTextures;
 }
\ No newline at end of file
@@ -5,12 +5,16 @@ in vec2 texCoord;
 
 uniform sampler2D uTexture_0;
 uniform sampler2D uTexture_1;
-uniform float uMix;
+layout (std140) uniform Frame {
+    float uMix;
+};
 
 uniform vec4 uColor;
-uniform vec3 uLightColor;
+layout (std140) uniform Lighting {
+    vec4 uLightColor;
+};
 
 void main()
 {
-    FragColor = mix(texture(uTexture_0, texCoord), texture(uTexture_1, texCoord), uMix) * uColor * vec4(uLightColor, 1.0);
+    FragColor = mix(texture(uTexture_0, texCoord), texture(uTexture_1, texCoord), uMix) * uColor * vec4(uLightColor.rgb, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,22 @@
+#version 460 core
+out vec4 FragColor;
+
+in vec2 texCoord;
+in vec4 color;
+
+// Lit and textured when baked, first row with image 0 and second with image 1,
+// lighting is linear in the texel so blending the rows equals baking with mix
+uniform sampler2D uImpostor;
+layout (std140) uniform Frame {
+    float uMix;
+};
+
+void main()
+{
+    const vec4 texel = mix(texture(uImpostor, texCoord), texture(uImpostor, texCoord + vec2(0.0, 0.5)), uMix);
+
+    if (texel.a < 0.5)
+        discard;
+
+    FragColor = vec4(texel.rgb, 1.0) * color;
+}
@@ -0,0 +1,48 @@
+#version 460 core
+// Camera facing quad showing one of the views baked around the mesh's Y axis
+layout (location = 0) in vec2 aCorner;
+// Per-instance attributes, PackedBoxInstance
+layout (location = 1) in vec4 aPositionScale;
+layout (location = 2) in vec4 aRotation;
+layout (location = 3) in vec4 aColor;
+
+out vec2 texCoord;
+out vec4 color;
+
+layout (std140) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    vec4 uCameraPosition;
+};
+uniform float uRadius;      // bounding radius of the mesh
+uniform uint uViews;        // views side by side in the atlas, first one looks from +X, rows below each other
+
+const float Pi = 3.14159265;
+
+vec3 rotate(vec4 q, vec3 v)
+{
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main()
+{
+    const vec3 center = aPositionScale.xyz;
+    const float radius = uRadius * aPositionScale.w;
+
+    const mat3 rotation = transpose(mat3(uView));
+    const vec3 right = rotation[0];
+    const vec3 up = rotation[1];
+    const vec3 eye = uCameraPosition.xyz;
+
+    // Direction to the camera in mesh space picks the closest baked view, scale doesn't change the angle
+    const vec4 orientation = normalize(aRotation);
+    const vec3 local = rotate(vec4(-orientation.xyz, orientation.w), eye - center);
+    const float turn = atan(local.z, local.x) / (2.0 * Pi);
+    const uint view = uint(round(turn * float(uViews)) + float(uViews)) % uViews;
+
+    gl_Position = uViewProjection * vec4(center + (right * aCorner.x + up * aCorner.y) * radius, 1.0);
+    // Coordinates in the first row, fragment shader reads the second one half the atlas up
+    texCoord = vec2((float(view) + aCorner.x * 0.5 + 0.5) / float(uViews), aCorner.y * 0.25 + 0.25);
+    color = aColor;
+}
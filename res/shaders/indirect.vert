@@ -0,0 +1,49 @@
+#version 460 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+
+// PackedBoxInstance
+struct Instance {
+    vec4 positionScale;
+    uvec2 rotation;     // snorm16 xy and zw
+    uint color;         // unorm8 RGBA
+    uint textures;      // 16 bits each, x in the low half
+};
+
+// Bindings of the blocks come from GPU::StorageBlockBindings and GPU::UniformBlockBindings
+layout (std430) readonly buffer Instances {
+    Instance instances[];
+};
+
+// Written by cull.comp, every draw command reads its range starting at its base instance
+layout (std430) readonly buffer Visible {
+    uint visible[];
+};
+
+out vec2 texCoord;
+out vec4 color;
+flat out uvec2 textures;
+
+layout (std140) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    vec4 uCameraPosition;
+};
+
+vec3 rotate(vec4 q, vec3 v)
+{
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main()
+{
+    const Instance instance = instances[visible[gl_BaseInstance + gl_InstanceID]];
+    const vec4 rotation = normalize(vec4(unpackSnorm2x16(instance.rotation.x), unpackSnorm2x16(instance.rotation.y)));
+    const vec3 world = instance.positionScale.xyz + rotate(rotation, aPos * instance.positionScale.w);
+
+    gl_Position = uViewProjection * vec4(world, 1.0);
+    texCoord = aTexCoord;
+    color = unpackUnorm4x8(instance.color);
+    textures = uvec2(instance.textures & 0xFFFFu, instance.textures >> 16);
+}
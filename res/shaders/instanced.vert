@@ -0,0 +1,34 @@
+#version 460 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+// Per-instance attributes, PackedBoxInstance
+layout (location = 2) in vec4 aPositionScale;
+layout (location = 3) in vec4 aRotation;
+layout (location = 4) in vec4 aColor;
+layout (location = 5) in uvec2 aTextures;
+
+out vec2 texCoord;
+out vec4 color;
+flat out uvec2 textures;
+
+layout (std140) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    vec4 uCameraPosition;
+};
+
+vec3 rotate(vec4 q, vec3 v)
+{
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main()
+{
+    const vec3 world = aPositionScale.xyz + rotate(normalize(aRotation), aPos * aPositionScale.w);
+
+    gl_Position = uViewProjection * vec4(world, 1.0);
+    texCoord = aTexCoord;
+    color = aColor;
+    textures = aTextures;
+}
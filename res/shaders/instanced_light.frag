@@ -0,0 +1,20 @@
+#version 460 core
+out vec4 FragColor;
+
+in vec2 texCoord;
+in vec4 color;
+
+uniform sampler2D uTexture_0;
+uniform sampler2D uTexture_1;
+layout (std140) uniform Frame {
+    float uMix;
+};
+
+layout (std140) uniform Lighting {
+    vec4 uLightColor;
+};
+
+void main()
+{
+    FragColor = mix(texture(uTexture_0, texCoord), texture(uTexture_1, texCoord), uMix) * color * vec4(uLightColor.rgb, 1.0);
+}
@@ -0,0 +1,24 @@
+#version 460 core
+out vec4 FragColor;
+
+in vec2 texCoord;
+in vec4 color;
+flat in uvec2 textures;
+
+// One layer per image, layers past the last one are clamped to it
+uniform sampler2DArray uTextureArray;
+layout (std140) uniform Frame {
+    float uMix;
+};
+
+layout (std140) uniform Lighting {
+    vec4 uLightColor;
+};
+
+void main()
+{
+    const vec4 first = texture(uTextureArray, vec3(texCoord, textures.x));
+    const vec4 second = texture(uTextureArray, vec3(texCoord, textures.y));
+
+    FragColor = mix(first, second, uMix) * color * vec4(uLightColor.rgb, 1.0);
+}
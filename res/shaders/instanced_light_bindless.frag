@@ -0,0 +1,29 @@
+#version 460 core
+#extension GL_ARB_bindless_texture : require
+out vec4 FragColor;
+
+in vec2 texCoord;
+in vec4 color;
+flat in uvec2 textures;
+
+// Resident texture handles, i-th image at i
+layout (std430) readonly buffer Textures {
+    uvec2 handles[];
+};
+
+layout (std140) uniform Frame {
+    float uMix;
+};
+
+layout (std140) uniform Lighting {
+    vec4 uLightColor;
+};
+
+void main()
+{
+    const uint last = uint(handles.length()) - 1u;
+    const vec4 first = texture(sampler2D(handles[min(textures.x, last)]), texCoord);
+    const vec4 second = texture(sampler2D(handles[min(textures.y, last)]), texCoord);
+
+    FragColor = mix(first, second, uMix) * color * vec4(uLightColor.rgb, 1.0);
+}
@@ -0,0 +1,551 @@
+/**
+ * @file Benchmark.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of the headless benchmark
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Benchmark.hpp"
+
+#include <glad/gl.h>
+
+#include <array>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <numbers>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
+#include "FrameStats.hpp"
+#include "Renderer/Camera.hpp"
+#include "Renderer/Culling.hpp"
+#include "Renderer/Frustum.hpp"
+#include "Mesh/Lod.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Renderer/TextureStreamer.hpp"
+#include "Renderer/GPU/Texture.hpp"
+#include "Renderer/GPU/TextureArray.hpp"
+#include "Renderer/GPU/BindlessTextures.hpp"
+#include "Renderer/GPU/VertexBuffer.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/HeadlessContext.hpp"
+#include "Scene/Box.hpp"
+#include "Scene/Transform.hpp"
+
+using Renderer::BoxRenderer;
+using Renderer::GPU::StateCache;
+
+namespace
+{
+
+constexpr uint GroupCount = 8;
+constexpr float TextureMix = 0.2f;
+constexpr uint TextureCount = 2;    // ContainerTexture and FaceTexture
+constexpr float AnimationSpeed = 0.5f / 60.f;  // radians per frame, same as interactive mode at 60 FPS
+
+const std::filesystem::path MeshPath = "res/models/box.mesh";
+const std::filesystem::path ModelPath = "res/models/box.dat";
+const std::filesystem::path LodPath = "res/models/box.lod";
+const std::filesystem::path ContainerTexture = "res/textures/container.png";
+const std::filesystem::path FaceTexture = "res/textures/grandfather-face.png";
+
+template<typename T>
+auto parse_number(std::string_view text, T& value) -> bool
+{
+    const char* end = text.data() + text.size();
+    const auto [ptr, error] = std::from_chars(text.data(), end, value);
+
+    return error == std::errc{} && ptr == end;
+}
+
+// Only reads files written by run_benchmark, so looking the keys up in order is enough
+auto read_metric(const std::string& json, std::string_view phase, std::string_view metric) -> std::optional<double>
+{
+    const auto stats = json.find(R"("stats":)");
+    const auto section = json.find(std::format(R"("{}":{{)", phase), stats);
+    const std::string key = std::format(R"("{}":)", metric);
+    const auto position = json.find(key, section);
+
+    if (stats == std::string::npos || section == std::string::npos || position == std::string::npos)
+        return std::nullopt;
+
+    const auto begin = position + key.size();
+    const auto end = json.find_first_of(",}", begin);
+
+    double value{};
+    if (!parse_number(std::string_view{json}.substr(begin, end - begin), value))
+        return std::nullopt;
+
+    return value;
+}
+
+auto read_config(const std::string& json) -> std::string_view
+{
+    const auto begin = json.find(R"("config":{)");
+    const auto end = json.find('}', begin);
+
+    if (begin == std::string::npos || end == std::string::npos)
+        return {};
+
+    return std::string_view{json}.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief Compares total frame time of result against baseline
+ * @retval int 0 - within tolerance, 1 - regression, -1 - baseline unreadable
+ */
+auto compare(const std::string& result, const std::filesystem::path& baselinePath, double tolerance) -> int
+{
+    std::ifstream file(baselinePath);
+
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open baseline: " << baselinePath << std::endl;
+        return -1;
+    }
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+    const std::string baseline = stream.str();
+
+    if (read_config(baseline) != read_config(result))
+        std::cerr << "Warning: baseline was recorded with different config, comparison may be meaningless" << std::endl;
+
+    const std::string_view phase = FrameStats::to_string(FrameStats::Total);
+    bool regression = false;
+
+    for (const std::string_view metric : {"mean", "p50", "p99"})
+    {
+        const auto expected = read_metric(baseline, phase, metric);
+        const auto measured = read_metric(result, phase, metric);
+
+        if (!expected || !measured)
+        {
+            std::cerr << "Baseline has no " << phase << ' ' << metric << " value" << std::endl;
+            return -1;
+        }
+
+        const double change = *expected > 0.0 ? *measured / *expected - 1.0 : 0.0;
+        const bool failed = change > tolerance;
+        regression |= failed;
+
+        std::cerr << std::format("{} {}: {:.3f} ms (baseline {:.3f} ms, {:+.1f}%){}\n",
+            phase, metric, *measured, *expected, change * 100.0, failed ? " REGRESSION" : "");
+    }
+
+    return regression ? 1 : 0;
+}
+
+/**
+ * @brief Compares boxes drawn by the last Indirect draw with CPU culling of the same camera,
+ *      boxes touching a frustum plane may land on either side due to rounding and are ignored
+ * @retval uint number of boxes missing, extra or duplicated on the GPU
+ */
+auto verify_indirect(const BoxRenderer& renderer, const Renderer::Camera& camera) -> uint
+{
+    constexpr float Epsilon = 1e-3f;
+
+    const std::vector<uint> gpu = renderer.readIndirectVisible();
+    const Renderer::BoundingSpheres& spheres = renderer.getSpheres();
+    const Renderer::Frustum frustum = Renderer::Frustum::FromCamera(camera);
+    const bool culling = renderer.getCulling() != BoxRenderer::Culling::None;
+
+    std::vector<uint> cpu(spheres.size());
+    if (culling)
+        Renderer::cull_spheres(frustum, spheres, cpu, Renderer::SimdLevel::Scalar);
+    else
+        std::iota(cpu.begin(), cpu.end(), 0);
+
+    std::vector<uint> difference;
+    std::set_symmetric_difference(gpu.begin(), gpu.end(), cpu.begin(), cpu.end(), std::back_inserter(difference));
+
+    uint mismatches = 0;
+
+    for (uint i = 1; i < gpu.size(); i++)
+        if (gpu[i] == gpu[i - 1])
+            mismatches++;
+
+    for (const uint box : difference)
+    {
+        float margin = std::numeric_limits<float>::max();
+
+        for (const auto& plane : frustum.planes)
+        {
+            const glm::vec3 center{spheres.x[box], spheres.y[box], spheres.z[box]};
+            margin = std::min(margin, std::abs(glm::dot(glm::vec3{plane}, center) + plane.w + spheres.radius[box]));
+        }
+
+        if (!culling || margin > Epsilon)
+            mismatches++;
+    }
+
+    return mismatches;
+}
+
+} // namespace
+
+auto parse_benchmark_config(const std::vector<std::string_view>& args) -> std::optional<BenchmarkConfig>
+{
+    BenchmarkConfig config;
+
+    for (uint i = 0; i < args.size(); i++)
+    {
+        const std::string_view option = args[i];
+
+        if (option == "--animate")
+        {
+            config.animate = true;
+            continue;
+        }
+
+        if (option == "--unsorted")
+        {
+            config.sorting = false;
+            continue;
+        }
+
+        if (option == "--verify")
+        {
+            config.verify = true;
+            continue;
+        }
+
+        if (option == "--no-lod")
+        {
+            config.lod = false;
+            continue;
+        }
+
+        if (option == "--stream-textures")
+        {
+            config.streamTextures = true;
+            continue;
+        }
+
+        const std::optional<std::string_view> value =
+            (i + 1 < args.size()) ? std::optional{args[i + 1]} : std::nullopt;
+
+        auto number = [&value](auto& target) {
+            return value && parse_number(*value, target);
+        };
+
+        bool known = true;
+        bool valid = true;
+
+        if (option == "--width")
+            valid = number(config.width) && config.width > 0;
+        else if (option == "--height")
+            valid = number(config.height) && config.height > 0;
+        else if (option == "--boxes")
+            valid = number(config.boxCount) && config.boxCount > 1;
+        else if (option == "--seed")
+            valid = number(config.seed);
+        else if (option == "--frames")
+            valid = number(config.frames) && config.frames > 0;
+        else if (option == "--warmup")
+            valid = number(config.warmup);
+        else if (option == "--tolerance")
+            valid = number(config.tolerance) && config.tolerance >= 0.0;
+        else if (option == "--out")
+        {
+            valid = value.has_value();
+            config.output = value.value_or("");
+        }
+        else if (option == "--trace-out")
+        {
+            valid = value.has_value();
+            config.trace = value.value_or("");
+        }
+        else if (option == "--baseline")
+        {
+            valid = value.has_value();
+            config.baseline = value.value_or("");
+        }
+        else if (option == "--mode")
+        {
+            valid = value == "perbox" || value == "instanced" || value == "indirect";
+            config.mode =
+                (value == "perbox") ? BoxRenderer::Mode::PerBox :
+                (value == "indirect") ? BoxRenderer::Mode::Indirect :
+                BoxRenderer::Mode::Instanced;
+        }
+        else if (option == "--texturing")
+        {
+            valid = value == "slots" || value == "array" || value == "bindless";
+            config.texturing =
+                (value == "array") ? BoxRenderer::Texturing::Array :
+                (value == "bindless") ? BoxRenderer::Texturing::Bindless :
+                BoxRenderer::Texturing::Slots;
+        }
+        else if (option == "--culling")
+        {
+            valid = value == "none" || value == "simd" || value == "bvh";
+            config.culling =
+                (value == "none") ? BoxRenderer::Culling::None :
+                (value == "bvh") ? BoxRenderer::Culling::BVH :
+                BoxRenderer::Culling::Simd;
+        }
+        else
+            known = false;
+
+        if (!known)
+            continue;
+
+        if (!valid)
+        {
+            std::cerr << "Invalid or missing value for " << option << std::endl;
+            return std::nullopt;
+        }
+
+        i++;
+    }
+
+    return config;
+}
+
+auto benchmark_camera_path(float t) -> glm::vec3
+{
+    // Orbit around the field, diving into it three times per loop, the origin stays in view
+    const float angle = t * 2.f * std::numbers::pi_v<float>;
+    const float radius = 60.f + 40.f * std::cos(3.f * angle);
+
+    return {
+        radius * std::cos(angle),
+        15.f * std::sin(2.f * angle),
+        radius * std::sin(angle)
+    };
+}
+
+auto run_benchmark(const BenchmarkConfig& config) -> int
+{
+    Renderer::GPU::HeadlessContext context(config.width, config.height);
+
+    if (!context.IsValid())
+        return -1;
+
+    StateCache::Get().Enable(GL_DEPTH_TEST);
+    StateCache::Get().Enable(GL_BLEND);
+    StateCache::Get().BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    JobSystem jobs;
+
+    const Mesh::MappedMesh mesh(MeshPath);
+
+    if (!mesh.isValid())
+        return -1;
+
+    Renderer::GPU::VertexBuffer vb(mesh.getVertexData().data(), mesh.getVertexData().size());
+
+    BoxRenderer boxRenderer(vb, mesh.getLayout(), mesh.getVertexCount(), jobs);
+
+    Scene::TransformHierarchy transforms;
+    std::vector<Scene::Box> boxes = Scene::create_boxes(config.boxCount, config.seed);
+    Scene::assign_textures(boxes, TextureCount, config.seed);
+    const Scene::BoxNodes nodes = Scene::add_boxes(transforms, boxes, GroupCount);
+    transforms.update();
+
+    boxRenderer.setBoxes(boxes, transforms, nodes.boxes);
+    boxRenderer.setCulling(config.culling);
+    boxRenderer.setSorting(config.sorting);
+    boxRenderer.setLods(Mesh::load_lod_chain(LodPath, ModelPath));
+    boxRenderer.setLod(config.lod);
+    boxRenderer.setLodSelection({.viewportHeight = config.height});
+
+    std::optional<Renderer::TextureStreamer> streamer;
+    std::array<Renderer::TextureStreamer::Handle, 2> streamed{};
+    std::optional<Renderer::GPU::Texture> texture, texture2;
+
+    if (config.streamTextures && GLAD_GL_VERSION_4_5)
+    {
+        streamer.emplace(jobs);
+        streamed = {streamer->request(ContainerTexture), streamer->request(FaceTexture)};
+    }
+    else
+    {
+        if (config.streamTextures)
+            std::cerr << "Texture streaming needs OpenGL 4.5, loading textures at once" << std::endl;
+
+        texture.emplace(ContainerTexture, &jobs);
+        texture2.emplace(FaceTexture, &jobs);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    // Per-box images, Slots texturing uses the textures bound above instead
+    std::optional<Renderer::GPU::TextureArray> textureArray;
+    std::optional<Renderer::GPU::BindlessTextures> bindlessTextures;
+
+    if (config.texturing != BoxRenderer::Texturing::Slots)
+        textureArray.emplace(std::vector{ContainerTexture, FaceTexture}, &jobs);
+
+    if (config.texturing == BoxRenderer::Texturing::Bindless && Renderer::GPU::BindlessTextures::IsSupported())
+        bindlessTextures.emplace(std::vector{ContainerTexture, FaceTexture}, &jobs);
+
+    boxRenderer.setTexturing(config.texturing);
+    boxRenderer.setTextureArray(textureArray ? &*textureArray : nullptr);
+    boxRenderer.setBindlessTextures(bindlessTextures ? &*bindlessTextures : nullptr);
+
+    Renderer::Camera camera{};
+    camera.setAspect(static_cast<float>(config.width) / static_cast<float>(config.height));
+
+    FrameStats stats;
+    uint64_t visibleSum{};
+    uint64_t triangleSum{};
+    double lodErrorSum{};
+    float lodErrorMax{};
+    uint64_t textureUploadSum{};
+    uint64_t textureUploadMax{};
+
+    const bool verify = config.verify && config.mode == BoxRenderer::Mode::Indirect;
+    uint64_t mismatches{};
+
+    if (config.verify && !verify)
+        std::cerr << "--verify only checks indirect mode, ignored" << std::endl;
+
+    if (config.trace)
+    {
+        if constexpr (!Profiler::Enabled)
+            std::cerr << "Profiler is compiled out (-DProfiler=ON), trace will be empty" << std::endl;
+
+        Profiler::instance().setCapturing(true);
+    }
+
+    for (uint frame = 0; frame < config.warmup + config.frames; frame++)
+    {
+        if (frame == config.warmup)
+        {
+            stats.reset();
+            StateCache::Get().ResetCounters();
+            boxRenderer.resetStreamStats();
+            Profiler::instance().clear();
+        }
+
+        PROFILE_ZONE("Frame");
+        stats.beginFrame();
+        // Nothing to poll, phase is kept so results line up with the interactive program
+        stats.mark(FrameStats::Input);
+
+        // Warmup frames get negative progress, so measured frames cover exactly one loop
+        const float t = (static_cast<float>(frame) - static_cast<float>(config.warmup)) / static_cast<float>(config.frames);
+
+        camera.setPosition(benchmark_camera_path(t));
+        camera.lookAt(glm::vec3{0.f});
+
+        if (config.animate)
+            transforms.setLocal(nodes.groups.front(), {
+                .rotation = glm::vec3{0.f, static_cast<float>(frame) * AnimationSpeed, 0.f}
+            });
+
+        transforms.update();
+        stats.mark(FrameStats::Update);
+
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        if (streamer)
+        {
+            streamer->update();
+            streamer->bind(streamed[0], 0);
+            streamer->bind(streamed[1], 1);
+        }
+        else
+        {
+            texture->Bind(0);
+            texture2->Bind(1);
+        }
+
+        boxRenderer.draw(config.mode, camera, TextureMix);
+        stats.mark(FrameStats::Submit);
+
+        // There is no swap, waiting for the GPU makes frame time include the rendering itself
+        glFinish();
+        stats.mark(FrameStats::Swap);
+
+        stats.endFrame();
+        PROFILE_FRAME();
+
+        if (frame >= config.warmup)
+        {
+            const auto& lod = boxRenderer.getLodStats();
+
+            visibleSum += boxRenderer.getVisibleCount();
+            triangleSum += lod.triangles;
+            lodErrorSum += lod.meanErrorPixels;
+            lodErrorMax = std::max(lodErrorMax, lod.maxErrorPixels);
+
+            if (streamer)
+            {
+                textureUploadSum += streamer->getStats().uploadedBytes;
+                textureUploadMax = std::max(textureUploadMax, streamer->getStats().uploadedBytes);
+            }
+        }
+
+        // After the frame is measured, reading back waits for the GPU
+        if (verify)
+            mismatches += verify_indirect(boxRenderer, camera);
+    }
+
+    const auto& glCalls = StateCache::Get().GetCounters();
+    const auto instanceStream = boxRenderer.getStreamStats();
+
+    const std::string result = std::format(
+        R"({{"renderer":"{}","config":{{"width":{},"height":{},"boxes":{},"seed":{},"frames":{},"warmup":{},"mode":"{}","culling":"{}","animate":{},"sorting":{},"lod":{},"streamTextures":{},"texturing":"{}"}},"visibleAverage":{:.1f},"trianglesPerFrame":{:.1f},"lodErrorPixels":{{"mean":{:.3f},"max":{:.3f}}},"textureStreaming":{{"uploadBytesPerFrame":{:.1f},"uploadBytesMax":{},"residentBytes":{},"budgetBytes":{}}},"instanceStreaming":{{"fenceWaits":{},"fenceWaitMs":{{"total":{:.3f},"max":{:.3f}}},"peakBytes":{},"overflows":{}}},"stateCallsPerFrame":{{"issued":{:.1f},"skipped":{:.1f}}},"stats":{}}})",
+        context.GetDescription(),
+        config.width, config.height, config.boxCount, config.seed, config.frames, config.warmup,
+        BoxRenderer::to_string(config.mode), BoxRenderer::to_string(config.culling), config.animate, config.sorting, config.lod, config.streamTextures,
+        BoxRenderer::to_string(boxRenderer.getActiveTexturing()),
+        static_cast<double>(visibleSum) / config.frames,
+        static_cast<double>(triangleSum) / config.frames,
+        lodErrorSum / config.frames, lodErrorMax,
+        static_cast<double>(textureUploadSum) / config.frames, textureUploadMax,
+        streamer ? streamer->getStats().residentBytes : 0, streamer ? streamer->getStats().budgetBytes : 0,
+        instanceStream.waits, instanceStream.totalWaitMs, instanceStream.maxWaitMs, instanceStream.peakBytes, instanceStream.overflows,
+        static_cast<double>(glCalls.totalIssued()) / config.frames,
+        static_cast<double>(glCalls.totalSkipped()) / config.frames,
+        FrameStats::to_json(stats.summary()));
+
+    if (config.trace)
+        Profiler::instance().writeTrace(*config.trace);
+
+    if (config.output)
+    {
+        std::ofstream file(*config.output);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open file: " << *config.output << std::endl;
+            return -1;
+        }
+
+        file << result << '\n';
+    }
+    else
+        std::cout << result << std::endl;
+
+    if (verify)
+    {
+        std::cerr << std::format("GPU culling verified over {} frames, {} mismatched boxes\n",
+            config.warmup + config.frames, mismatches);
+
+        if (mismatches > 0)
+            return 2;
+    }
+
+    if (config.baseline)
+        return compare(result, *config.baseline, config.tolerance);
+
+    return 0;
+}
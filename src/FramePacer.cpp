@@ -0,0 +1,164 @@
+/**
+ * @file FramePacer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of FramePacer class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "FramePacer.hpp"
+
+#include <cmath>
+#include <thread>
+#include <algorithm>
+
+#include <GLFW/glfw3.h>
+
+#include "Profiler.hpp"
+
+namespace
+{
+    constexpr FramePacer::Duration MinSpinMargin{0.0002};
+    constexpr FramePacer::Duration MaxSpinMargin{0.002};
+}   // namespace
+
+FramePacer::FramePacer(Mode mode, double targetRate) :
+    m_mode{mode},
+    m_targetRate{targetRate},
+    m_period{1.0 / targetRate}
+{
+    setMode(mode);
+}
+
+auto FramePacer::setMode(Mode mode) -> void
+{
+    m_mode = mode;
+
+    if (glfwGetCurrentContext() != nullptr)
+        glfwSwapInterval(mode == Mode::VSync ? 1 : 0);
+
+    m_deadline = {};
+    resetJitter();
+}
+
+auto FramePacer::setTargetRate(double rate) -> void
+{
+    m_targetRate = rate;
+    m_period = Duration{1.0 / rate};
+    m_deadline = {};
+    resetJitter();
+}
+
+auto FramePacer::wait() -> void
+{
+    PROFILE_ZONE("FramePacer::wait");
+
+    if (m_mode == Mode::Target)
+    {
+        const auto now = Clock::now();
+        const auto period = std::chrono::duration_cast<Clock::duration>(m_period);
+
+        // Deadlines advance by exactly one period, so early or late wake-ups don't accumulate.
+        // After a hitch longer than a frame start over instead of rushing to catch up.
+        if (m_deadline == Clock::time_point{} || now > m_deadline + period)
+            m_deadline = now;
+        else
+            m_deadline += period;
+
+        sleepUntil(m_deadline);
+    }
+
+    const auto now = Clock::now();
+
+    if (m_lastFrame != Clock::time_point{})
+        record(now - m_lastFrame);
+
+    m_lastFrame = now;
+}
+
+auto FramePacer::getJitter() const -> Jitter
+{
+    if (m_frames == 0)
+        return {};
+
+    const double mean = m_sumInterval / m_frames;
+    const double variance = std::max(0.0, m_sumIntervalSquared / m_frames - mean * mean);
+
+    Jitter jitter;
+    jitter.frames = m_frames;
+    jitter.meanInterval = mean * 1000.0;
+    jitter.stddev = std::sqrt(variance) * 1000.0;
+
+    // Without a target there is nothing to miss, stddev is what describes those intervals
+    if (m_mode == Mode::Target)
+    {
+        jitter.meanAbsError = m_sumAbsError / m_frames * 1000.0;
+        jitter.maxAbsError = m_maxAbsError * 1000.0;
+    }
+
+    return jitter;
+}
+
+auto FramePacer::resetJitter() -> void
+{
+    m_frames = 0;
+    m_sumInterval = 0.0;
+    m_sumIntervalSquared = 0.0;
+    m_sumAbsError = 0.0;
+    m_maxAbsError = 0.0;
+    m_lastFrame = {};
+}
+
+auto FramePacer::to_string(Mode mode) -> std::string_view
+{
+    switch (mode)
+    {
+        case Mode::VSync: return "vsync";
+        case Mode::Uncapped: return "uncapped";
+        case Mode::Target: return "target";
+    }
+
+    return "unknown";
+}
+
+    /**   PRIVATE   **/
+
+auto FramePacer::sleepUntil(Clock::time_point deadline) -> void
+{
+    const auto wakeUp = deadline - std::chrono::duration_cast<Clock::duration>(m_spinMargin);
+
+    if (Clock::now() < wakeUp)
+    {
+        std::this_thread::sleep_until(wakeUp);
+
+        // Scheduler wakes us up late by some amount, keep the margin a bit above what was observed
+        const Duration oversleep = Clock::now() - wakeUp;
+        m_spinMargin = std::clamp(
+            m_spinMargin * 0.9 + oversleep * 0.2,
+            MinSpinMargin,
+            MaxSpinMargin
+        );
+    }
+
+    while (Clock::now() < deadline)
+        std::this_thread::yield();
+}
+
+auto FramePacer::record(Duration interval) -> void
+{
+    const double seconds = interval.count();
+
+    m_frames++;
+    m_sumInterval += seconds;
+    m_sumIntervalSquared += seconds * seconds;
+
+    if (m_mode != Mode::Target)
+        return;
+
+    const double error = std::abs(seconds - m_period.count());
+
+    m_sumAbsError += error;
+    m_maxAbsError = std::max(m_maxAbsError, error);
+}
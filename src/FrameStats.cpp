@@ -0,0 +1,233 @@
+/**
+ * @file FrameStats.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of FrameStats class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "FrameStats.hpp"
+
+#include <format>
+#include <iostream>
+#include <algorithm>
+
+namespace
+{
+    auto elapsed_ms(FrameStats::Clock::time_point from, FrameStats::Clock::time_point to) -> float
+    {
+        return std::chrono::duration<float, std::milli>(to - from).count();
+    }
+}   // namespace
+
+FrameStats::FrameStats(uint capacity) :
+    m_ring(std::max(capacity, 1u))
+{
+    reset();
+}
+
+FrameStats::~FrameStats()
+{
+    if (m_file)
+        flush();
+}
+
+auto FrameStats::exportTo(const std::filesystem::path& path, Format format, double interval) -> bool
+{
+    m_file.emplace(path, std::ios::out | std::ios::trunc);
+
+    if (!m_file->is_open())
+    {
+        std::cerr << "Failed to open frame statistics file: " << path << std::endl;
+        m_file.reset();
+        return false;
+    }
+
+    m_format = format;
+    m_interval = interval;
+    m_lastExport = Clock::now();
+
+    if (m_format == Format::CSV)
+    {
+        *m_file << "duration,frames,hitches";
+        for (uint phase = 0; phase < PhaseCount; phase++)
+        {
+            const auto name = to_string(static_cast<Phase>(phase));
+            *m_file << std::format(",{0}_mean,{0}_p50,{0}_p95,{0}_p99,{0}_max", name);
+        }
+        *m_file << '\n';
+    }
+
+    return true;
+}
+
+auto FrameStats::beginFrame() -> void
+{
+    m_current.fill(0.f);
+    m_lastMark = Clock::now();
+}
+
+auto FrameStats::mark(Phase phase) -> void
+{
+    const auto now = Clock::now();
+
+    m_current[phase] += elapsed_ms(m_lastMark, now);
+    m_lastMark = now;
+}
+
+auto FrameStats::endFrame() -> void
+{
+    float total = 0.f;
+    for (uint phase = 0; phase < Total; phase++)
+        total += m_current[phase];
+    m_current[Total] = total;
+
+    for (uint phase = 0; phase < PhaseCount; phase++)
+        m_histograms[phase].add(m_current[phase]);
+
+    // Average follows slow changes of load, a hitch is a sudden spike above it
+    if (m_averageFrame > 0.0 && total > m_hitchFactor * m_averageFrame)
+        m_hitches++;
+    m_averageFrame = (m_averageFrame == 0.0) ? total : m_averageFrame * 0.95 + total * 0.05;
+
+    m_ring[m_ringHead] = m_current;
+    m_ringHead = (m_ringHead + 1) % m_ring.size();
+    m_totalFrames++;
+
+    if (m_file && m_interval > 0.0 &&
+        std::chrono::duration<double>(Clock::now() - m_lastExport).count() >= m_interval)
+        flush();
+}
+
+auto FrameStats::summary() const -> Summary
+{
+    Summary summary;
+    summary.frames = m_histograms[Total].count;
+    summary.hitches = m_hitches;
+    summary.duration = std::chrono::duration<double>(Clock::now() - m_windowStart).count();
+
+    for (uint phase = 0; phase < PhaseCount; phase++)
+    {
+        const auto& histogram = m_histograms[phase];
+        auto& percentiles = summary.phases[phase];
+
+        if (histogram.count == 0)
+            continue;
+
+        percentiles.mean = histogram.sum / histogram.count;
+        percentiles.p50 = histogram.percentile(0.50);
+        percentiles.p95 = histogram.percentile(0.95);
+        percentiles.p99 = histogram.percentile(0.99);
+        percentiles.max = histogram.max;
+    }
+
+    return summary;
+}
+
+auto FrameStats::reset() -> void
+{
+    m_histograms = {};
+    m_hitches = 0;
+    m_windowStart = Clock::now();
+}
+
+auto FrameStats::flush() -> void
+{
+    // An empty window (e.g. flushed again right after the last one) would add a record of zero frames
+    if (m_file && m_histograms[Total].count > 0)
+    {
+        write(summary());
+        m_lastExport = Clock::now();
+    }
+
+    reset();
+}
+
+auto FrameStats::recent() const -> std::vector<std::array<float, PhaseCount>>
+{
+    const uint size = std::min<uint64_t>(m_totalFrames, m_ring.size());
+    std::vector<std::array<float, PhaseCount>> frames;
+    frames.reserve(size);
+
+    const uint first = (m_ringHead + m_ring.size() - size) % m_ring.size();
+    for (uint i = 0; i < size; i++)
+        frames.push_back(m_ring[(first + i) % m_ring.size()]);
+
+    return frames;
+}
+
+auto FrameStats::to_string(Phase phase) -> std::string_view
+{
+    switch (phase)
+    {
+        case Input: return "input";
+        case Update: return "update";
+        case Submit: return "submit";
+        case Swap: return "swap";
+        case Total: return "total";
+        case PhaseCount: break;
+    }
+
+    return "unknown";
+}
+
+auto FrameStats::to_json(const Summary& summary) -> std::string
+{
+    std::string json = std::format(R"({{"duration":{:.3f},"frames":{},"hitches":{})",
+        summary.duration, summary.frames, summary.hitches);
+
+    for (uint phase = 0; phase < PhaseCount; phase++)
+    {
+        const auto& p = summary.phases[phase];
+        json += std::format(R"(,"{}":{{"mean":{:.4f},"p50":{:.4f},"p95":{:.4f},"p99":{:.4f},"max":{:.4f}}})",
+            to_string(static_cast<Phase>(phase)), p.mean, p.p50, p.p95, p.p99, p.max);
+    }
+
+    return json + '}';
+}
+
+    /**   PRIVATE   **/
+
+auto FrameStats::write(const Summary& summary) -> void
+{
+    if (m_format == Format::JsonLines)
+        *m_file << to_json(summary) << '\n';
+    else
+    {
+        *m_file << std::format("{:.3f},{},{}", summary.duration, summary.frames, summary.hitches);
+        for (const auto& p : summary.phases)
+            *m_file << std::format(",{:.4f},{:.4f},{:.4f},{:.4f},{:.4f}", p.mean, p.p50, p.p95, p.p99, p.max);
+        *m_file << '\n';
+    }
+
+    m_file->flush();
+}
+
+auto FrameStats::Histogram::add(double ms) -> void
+{
+    const uint bin = std::min<double>(BinCount - 1, ms / BinWidth);
+
+    bins[bin]++;
+    sum += ms;
+    max = std::max(max, ms);
+    count++;
+}
+
+auto FrameStats::Histogram::percentile(double p) const -> double
+{
+    const uint target = std::max(1u, static_cast<uint>(p * count + 0.5));
+    uint accumulated = 0;
+
+    for (uint bin = 0; bin < BinCount; bin++)
+    {
+        accumulated += bins[bin];
+
+        // Upper edge of the bin, but never more than the slowest frame seen
+        if (accumulated >= target)
+            return std::min((bin + 1) * BinWidth, max);
+    }
+
+    return max;
+}
@@ -0,0 +1,630 @@
+/**
+ * @file BlockCompression.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of BC1/BC3/BC7 encoders and decoders
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Image/BlockCompression.hpp"
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+using Image::BlockSize;
+using Image::BytesPerPixel;
+
+constexpr uint BlockTexels = BlockSize * BlockSize;
+
+// Block rows compressed by a single job
+constexpr uint BlockRowsPerJob = 8;
+
+using Texel = std::array<uchar, BytesPerPixel>;
+using Block = std::array<Texel, BlockTexels>;
+
+// Interpolation weights of BC7 4-bit indices, out of 64
+constexpr std::array<uint, 16> Bc7Weights{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+auto fetch_block(const Image::Bitmap& image, uint blockX, uint blockY) -> Block
+{
+    Block block{};
+
+    for (uint y = 0; y < BlockSize; y++)
+        for (uint x = 0; x < BlockSize; x++)
+        {
+            const uint column = std::min(blockX * BlockSize + x, image.width - 1);
+            const uint row = std::min(blockY * BlockSize + y, image.height - 1);
+
+            std::memcpy(
+                block[y * BlockSize + x].data(),
+                image.pixels.data() + (static_cast<std::size_t>(row) * image.width + column) * BytesPerPixel,
+                BytesPerPixel);
+        }
+
+    return block;
+}
+
+template<uint N>
+using Vector = std::array<float, N>;
+
+/**
+ * @brief Endpoints of the segment of the principal axis (of first N channels) covering all texels
+ */
+template<uint N>
+auto fit_endpoints(const Block& block) -> std::array<Vector<N>, 2>
+{
+    Vector<N> mean{};
+    Vector<N> low;
+    Vector<N> high;
+    low.fill(std::numeric_limits<float>::max());
+    high.fill(std::numeric_limits<float>::lowest());
+
+    for (const auto& texel : block)
+        for (uint c = 0; c < N; c++)
+        {
+            mean[c] += texel[c];
+            low[c] = std::min(low[c], static_cast<float>(texel[c]));
+            high[c] = std::max(high[c], static_cast<float>(texel[c]));
+        }
+
+    for (auto& value : mean)
+        value /= BlockTexels;
+
+    std::array<Vector<N>, N> covariance{};
+    for (const auto& texel : block)
+        for (uint i = 0; i < N; i++)
+            for (uint j = 0; j < N; j++)
+                covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+
+    // Power iteration, starting from the bounding box diagonal converges in a few steps
+    Vector<N> axis{};
+    for (uint c = 0; c < N; c++)
+        axis[c] = high[c] - low[c];
+
+    for (uint iteration = 0; iteration < 8; iteration++)
+    {
+        Vector<N> next{};
+        for (uint i = 0; i < N; i++)
+            for (uint j = 0; j < N; j++)
+                next[i] += covariance[i][j] * axis[j];
+
+        float length = 0.f;
+        for (const float value : next)
+            length += value * value;
+
+        if (length < 1e-12f)
+            break;
+
+        length = std::sqrt(length);
+        for (uint c = 0; c < N; c++)
+            axis[c] = next[c] / length;
+    }
+
+    float axisLength = 0.f;
+    for (const float value : axis)
+        axisLength += value * value;
+
+    // Flat block, both endpoints are the mean
+    if (axisLength < 1e-12f)
+        return {mean, mean};
+
+    float minimum = std::numeric_limits<float>::max();
+    float maximum = std::numeric_limits<float>::lowest();
+    for (const auto& texel : block)
+    {
+        float t = 0.f;
+        for (uint c = 0; c < N; c++)
+            t += (texel[c] - mean[c]) * axis[c];
+
+        minimum = std::min(minimum, t);
+        maximum = std::max(maximum, t);
+    }
+
+    std::array<Vector<N>, 2> endpoints{};
+    for (uint c = 0; c < N; c++)
+    {
+        endpoints[0][c] = std::clamp(mean[c] + axis[c] * minimum, 0.f, 255.f);
+        endpoints[1][c] = std::clamp(mean[c] + axis[c] * maximum, 0.f, 255.f);
+    }
+
+    return endpoints;
+}
+
+template<uint N, typename Palette>
+auto nearest(const Texel& texel, const Palette& palette, uint count) -> uint
+{
+    uint best = 0;
+    int bestError = std::numeric_limits<int>::max();
+
+    for (uint i = 0; i < count; i++)
+    {
+        int error = 0;
+        for (uint c = 0; c < N; c++)
+        {
+            const int difference = static_cast<int>(texel[c]) - static_cast<int>(palette[i][c]);
+            error += difference * difference;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+auto pack_565(const Vector<3>& color) -> uint
+{
+    const uint r = std::lround(color[0] * 31.f / 255.f);
+    const uint g = std::lround(color[1] * 63.f / 255.f);
+    const uint b = std::lround(color[2] * 31.f / 255.f);
+
+    return (r << 11) | (g << 5) | b;
+}
+
+auto unpack_565(uint color) -> Texel
+{
+    const uint r = (color >> 11) & 31;
+    const uint g = (color >> 5) & 63;
+    const uint b = color & 31;
+
+    return {
+        static_cast<uchar>((r << 3) | (r >> 2)),
+        static_cast<uchar>((g << 2) | (g >> 4)),
+        static_cast<uchar>((b << 3) | (b >> 2)),
+        255
+    };
+}
+
+auto lerp(const Texel& a, const Texel& b, uint weightA, uint weightB, uint divisor) -> Texel
+{
+    Texel result{};
+    for (uint c = 0; c < BytesPerPixel; c++)
+        result[c] = static_cast<uchar>((a[c] * weightA + b[c] * weightB) / divisor);
+
+    return result;
+}
+
+// 8 bytes: two 565 endpoints and 2-bit indices, always in 4 color mode (first endpoint greater)
+auto encode_bc1(const Block& block, uchar* out) -> void
+{
+    const auto endpoints = fit_endpoints<3>(block);
+
+    uint color0 = pack_565(endpoints[1]);
+    uint color1 = pack_565(endpoints[0]);
+    if (color0 < color1)
+        std::swap(color0, color1);
+
+    uint indices = 0;
+
+    if (color0 != color1)
+    {
+        const Texel p0 = unpack_565(color0);
+        const Texel p1 = unpack_565(color1);
+        const std::array<Texel, 4> palette{p0, p1, lerp(p0, p1, 2, 1, 3), lerp(p0, p1, 1, 2, 3)};
+
+        for (uint i = 0; i < BlockTexels; i++)
+            indices |= nearest<3>(block[i], palette, 4) << (i * 2);
+    }
+
+    const std::array<uchar, 8> bytes{
+        static_cast<uchar>(color0), static_cast<uchar>(color0 >> 8),
+        static_cast<uchar>(color1), static_cast<uchar>(color1 >> 8),
+        static_cast<uchar>(indices), static_cast<uchar>(indices >> 8),
+        static_cast<uchar>(indices >> 16), static_cast<uchar>(indices >> 24)
+    };
+    std::memcpy(out, bytes.data(), bytes.size());
+}
+
+// 8 bytes: two alpha endpoints and 3-bit indices, in 8 value mode (first endpoint greater)
+auto encode_bc3_alpha(const Block& block, uchar* out) -> void
+{
+    uint alpha0 = 0;
+    uint alpha1 = 255;
+    for (const auto& texel : block)
+    {
+        alpha0 = std::max<uint>(alpha0, texel[3]);
+        alpha1 = std::min<uint>(alpha1, texel[3]);
+    }
+
+    uint64_t indices = 0;
+
+    if (alpha0 != alpha1)
+    {
+        std::array<uint, 8> palette{alpha0, alpha1};
+        for (uint i = 2; i < 8; i++)
+            palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+
+        for (uint i = 0; i < BlockTexels; i++)
+        {
+            uint best = 0;
+            for (uint j = 1; j < 8; j++)
+                if (std::abs(static_cast<int>(palette[j]) - block[i][3]) < std::abs(static_cast<int>(palette[best]) - block[i][3]))
+                    best = j;
+
+            indices |= static_cast<uint64_t>(best) << (i * 3);
+        }
+    }
+
+    out[0] = static_cast<uchar>(alpha0);
+    out[1] = static_cast<uchar>(alpha1);
+    for (uint i = 0; i < 6; i++)
+        out[2 + i] = static_cast<uchar>(indices >> (i * 8));
+}
+
+class BitWriter
+{
+    public:
+        auto write(uint64_t value, uint count) -> void
+        {
+            for (uint i = 0; i < count; i++, m_position++)
+                m_bits[m_position / 64] |= ((value >> i) & 1) << (m_position % 64);
+        }
+
+        auto store(uchar* out) const -> void
+        {
+            for (uint i = 0; i < 16; i++)
+                out[i] = static_cast<uchar>(m_bits[i / 8] >> ((i % 8) * 8));
+        }
+    private:
+        std::array<uint64_t, 2> m_bits{};
+        uint m_position{};
+}; // class BitWriter
+
+class BitReader
+{
+    public:
+        explicit BitReader(const uchar* data)
+        {
+            for (uint i = 0; i < 16; i++)
+                m_bits[i / 8] |= static_cast<uint64_t>(data[i]) << ((i % 8) * 8);
+        }
+
+        auto read(uint count) -> uint
+        {
+            uint value = 0;
+            for (uint i = 0; i < count; i++, m_position++)
+                value |= ((m_bits[m_position / 64] >> (m_position % 64)) & 1) << i;
+
+            return value;
+        }
+    private:
+        std::array<uint64_t, 2> m_bits{};
+        uint m_position{};
+}; // class BitReader
+
+// 16 bytes in mode 6: RGBA endpoints of 7 bits plus a shared low bit each, 4-bit indices
+auto encode_bc7(const Block& block, uchar* out) -> void
+{
+    const auto endpoints = fit_endpoints<4>(block);
+
+    std::array<std::array<uint, BytesPerPixel>, 2> quantized{};
+    std::array<uint, 2> pbits{};
+
+    // Low bit is shared by all channels of an endpoint, the one closer overall wins
+    for (uint e = 0; e < 2; e++)
+    {
+        float bestError = std::numeric_limits<float>::max();
+
+        for (uint p = 0; p < 2; p++)
+        {
+            std::array<uint, BytesPerPixel> candidate{};
+            float error = 0.f;
+
+            for (uint c = 0; c < BytesPerPixel; c++)
+            {
+                candidate[c] = std::clamp<long>(std::lround((endpoints[e][c] - static_cast<float>(p)) / 2.f), 0, 127);
+                const float reconstructed = static_cast<float>((candidate[c] << 1) | p);
+                error += (reconstructed - endpoints[e][c]) * (reconstructed - endpoints[e][c]);
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                quantized[e] = candidate;
+                pbits[e] = p;
+            }
+        }
+    }
+
+    std::array<Texel, 16> palette{};
+    for (uint i = 0; i < palette.size(); i++)
+        for (uint c = 0; c < BytesPerPixel; c++)
+        {
+            const uint a = (quantized[0][c] << 1) | pbits[0];
+            const uint b = (quantized[1][c] << 1) | pbits[1];
+            palette[i][c] = static_cast<uchar>(((64 - Bc7Weights[i]) * a + Bc7Weights[i] * b + 32) >> 6);
+        }
+
+    std::array<uint, BlockTexels> indices{};
+    for (uint i = 0; i < BlockTexels; i++)
+        indices[i] = nearest<4>(block[i], palette, palette.size());
+
+    // Highest bit of the first index isn't stored, it has to be 0
+    if (indices[0] >= 8)
+    {
+        std::swap(quantized[0], quantized[1]);
+        std::swap(pbits[0], pbits[1]);
+        for (auto& index : indices)
+            index = 15 - index;
+    }
+
+    BitWriter writer;
+    writer.write(1u << 6, 7);   // mode 6
+    for (uint c = 0; c < BytesPerPixel; c++)
+    {
+        writer.write(quantized[0][c], 7);
+        writer.write(quantized[1][c], 7);
+    }
+    writer.write(pbits[0], 1);
+    writer.write(pbits[1], 1);
+    for (uint i = 0; i < BlockTexels; i++)
+        writer.write(indices[i], i == 0 ? 3 : 4);
+
+    writer.store(out);
+}
+
+auto decode_bc1(const uchar* data, bool alwaysFourColors) -> Block
+{
+    const uint color0 = data[0] | (data[1] << 8);
+    const uint color1 = data[2] | (data[3] << 8);
+    const uint indices = data[4] | (data[5] << 8) | (data[6] << 16) | (static_cast<uint>(data[7]) << 24);
+
+    const Texel p0 = unpack_565(color0);
+    const Texel p1 = unpack_565(color1);
+
+    std::array<Texel, 4> palette{p0, p1};
+    if (color0 > color1 || alwaysFourColors)
+    {
+        palette[2] = lerp(p0, p1, 2, 1, 3);
+        palette[3] = lerp(p0, p1, 1, 2, 3);
+    }
+    else
+    {
+        palette[2] = lerp(p0, p1, 1, 1, 2);
+        palette[3] = {0, 0, 0, 0};
+    }
+
+    Block block{};
+    for (uint i = 0; i < BlockTexels; i++)
+        block[i] = palette[(indices >> (i * 2)) & 3];
+
+    return block;
+}
+
+auto decode_bc3_alpha(const uchar* data, Block& block) -> void
+{
+    const uint alpha0 = data[0];
+    const uint alpha1 = data[1];
+
+    uint64_t indices = 0;
+    for (uint i = 0; i < 6; i++)
+        indices |= static_cast<uint64_t>(data[2 + i]) << (i * 8);
+
+    std::array<uint, 8> palette{alpha0, alpha1};
+    if (alpha0 > alpha1)
+        for (uint i = 2; i < 8; i++)
+            palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+    else
+    {
+        for (uint i = 2; i < 6; i++)
+            palette[i] = ((6 - i) * alpha0 + (i - 1) * alpha1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    for (uint i = 0; i < BlockTexels; i++)
+        block[i][3] = static_cast<uchar>(palette[(indices >> (i * 3)) & 7]);
+}
+
+auto decode_bc7(const uchar* data) -> Block
+{
+    BitReader reader{data};
+
+    // Only mode 6 is written here, other modes show up magenta
+    if (reader.read(7) != (1u << 6))
+    {
+        Block block{};
+        block.fill({255, 0, 255, 255});
+        return block;
+    }
+
+    std::array<std::array<uint, BytesPerPixel>, 2> endpoints{};
+    for (uint c = 0; c < BytesPerPixel; c++)
+    {
+        endpoints[0][c] = reader.read(7);
+        endpoints[1][c] = reader.read(7);
+    }
+
+    const std::array<uint, 2> pbits{reader.read(1), reader.read(1)};
+    for (uint e = 0; e < 2; e++)
+        for (auto& value : endpoints[e])
+            value = (value << 1) | pbits[e];
+
+    Block block{};
+    for (uint i = 0; i < BlockTexels; i++)
+    {
+        const uint weight = Bc7Weights[reader.read(i == 0 ? 3 : 4)];
+        for (uint c = 0; c < BytesPerPixel; c++)
+            block[i][c] = static_cast<uchar>(((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6);
+    }
+
+    return block;
+}
+
+} // namespace
+
+namespace Image
+{
+
+auto block_bytes(Format format) -> uint
+{
+    switch (format)
+    {
+        case Format::RGBA8: return 0;
+        case Format::BC1: return 8;
+        case Format::BC3: return 16;
+        case Format::BC7: return 16;
+    }
+
+    return 0;
+}
+
+auto data_bytes(Format format, uint width, uint height) -> std::size_t
+{
+    if (format == Format::RGBA8)
+        return static_cast<std::size_t>(width) * height * BytesPerPixel;
+
+    const std::size_t blocks = static_cast<std::size_t>((width + BlockSize - 1) / BlockSize) * ((height + BlockSize - 1) / BlockSize);
+    return blocks * block_bytes(format);
+}
+
+auto compress(const Bitmap& image, Format format, JobSystem* jobs) -> std::vector<uchar>
+{
+    PROFILE_ZONE("Image::compress");
+
+    if (format == Format::RGBA8)
+        return image.pixels;
+
+    const uint blocksX = (image.width + BlockSize - 1) / BlockSize;
+    const uint blocksY = (image.height + BlockSize - 1) / BlockSize;
+    const uint blockSize = block_bytes(format);
+
+    std::vector<uchar> data(data_bytes(format, image.width, image.height));
+
+    const auto encode = [&](uint begin, uint end) {
+        for (uint y = begin; y < end; y++)
+            for (uint x = 0; x < blocksX; x++)
+            {
+                const Block block = fetch_block(image, x, y);
+                uchar* out = data.data() + (static_cast<std::size_t>(y) * blocksX + x) * blockSize;
+
+                switch (format)
+                {
+                    case Format::BC1:
+                        encode_bc1(block, out);
+                        break;
+                    case Format::BC3:
+                        encode_bc3_alpha(block, out);
+                        encode_bc1(block, out + 8);
+                        break;
+                    case Format::BC7:
+                        encode_bc7(block, out);
+                        break;
+                    case Format::RGBA8:
+                        break;
+                }
+            }
+    };
+
+    if (jobs != nullptr)
+        jobs->parallel_for(0, blocksY, BlockRowsPerJob, encode);
+    else
+        encode(0, blocksY);
+
+    return data;
+}
+
+auto decompress(const uchar* data, Format format, uint width, uint height) -> Bitmap
+{
+    Bitmap image{width, height};
+
+    if (format == Format::RGBA8)
+    {
+        image.pixels.assign(data, data + image.size());
+        return image;
+    }
+
+    image.pixels.resize(image.size());
+
+    const uint blocksX = (width + BlockSize - 1) / BlockSize;
+    const uint blocksY = (height + BlockSize - 1) / BlockSize;
+    const uint blockSize = block_bytes(format);
+
+    for (uint by = 0; by < blocksY; by++)
+        for (uint bx = 0; bx < blocksX; bx++)
+        {
+            const uchar* in = data + (static_cast<std::size_t>(by) * blocksX + bx) * blockSize;
+
+            Block block{};
+            switch (format)
+            {
+                case Format::BC1:
+                    block = decode_bc1(in, false);
+                    break;
+                case Format::BC3:
+                    block = decode_bc1(in + 8, true);
+                    decode_bc3_alpha(in, block);
+                    break;
+                case Format::BC7:
+                    block = decode_bc7(in);
+                    break;
+                case Format::RGBA8:
+                    break;
+            }
+
+            for (uint y = 0; y < BlockSize && by * BlockSize + y < height; y++)
+                for (uint x = 0; x < BlockSize && bx * BlockSize + x < width; x++)
+                {
+                    const std::size_t pixel = static_cast<std::size_t>(by * BlockSize + y) * width + bx * BlockSize + x;
+                    std::memcpy(image.pixels.data() + pixel * BytesPerPixel, block[y * BlockSize + x].data(), BytesPerPixel);
+                }
+        }
+
+    return image;
+}
+
+auto psnr(const Bitmap& a, const Bitmap& b) -> double
+{
+    if (a.pixels.size() != b.pixels.size() || a.pixels.empty())
+        return 0.0;
+
+    double squared = 0.0;
+    for (std::size_t i = 0; i < a.pixels.size(); i++)
+    {
+        const double difference = static_cast<double>(a.pixels[i]) - static_cast<double>(b.pixels[i]);
+        squared += difference * difference;
+    }
+
+    if (squared == 0.0)
+        return std::numeric_limits<double>::infinity();
+
+    const double mse = squared / static_cast<double>(a.pixels.size());
+    return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+auto to_string(Format format) -> std::string_view
+{
+    switch (format)
+    {
+        case Format::RGBA8: return "rgba8";
+        case Format::BC1: return "bc1";
+        case Format::BC3: return "bc3";
+        case Format::BC7: return "bc7";
+    }
+
+    return "unknown";
+}
+
+auto parse_format(std::string_view name) -> std::optional<Format>
+{
+    for (const Format format : {Format::RGBA8, Format::BC1, Format::BC3, Format::BC7})
+        if (name == to_string(format))
+            return format;
+
+    return std::nullopt;
+}
+
+} // namespace Image
@@ -0,0 +1,246 @@
+/**
+ * @file Cook.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of texture cooking and the cooked texture cache
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Image/Cook.hpp"
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <iostream>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+constexpr std::array<char, 4> Magic{'T', 'E', 'X', 'C'};
+constexpr uint Version = 1;
+
+// Marks automatic format choice in the hash, distinct from every Image::Format value
+constexpr uint64_t AutoFormat = 0xFF;
+
+// Upper bound of the level count, only guards against garbage in a broken file
+constexpr uint MaxLevels = 32;
+
+constexpr uint64_t FnvOffset = 14695981039346656037ull;
+constexpr uint64_t FnvPrime = 1099511628211ull;
+
+auto fnv1a(uint64_t hash, const char* data, std::size_t size) -> uint64_t
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash ^= static_cast<uchar>(data[i]);
+        hash *= FnvPrime;
+    }
+
+    return hash;
+}
+
+template<typename T>
+auto write_value(std::ofstream& file, const T& value) -> void
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+template<typename T>
+auto read_value(std::ifstream& file, T& value) -> void
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+} // namespace
+
+namespace Image
+{
+
+auto choose_format(const Bitmap& image) -> Format
+{
+    return image.isOpaque() ? Format::BC1 : Format::BC3;
+}
+
+auto cook(Bitmap image, Format format, JobSystem* jobs) -> CookedTexture
+{
+    PROFILE_ZONE("Image::cook");
+
+    CookedTexture texture{format, image.width, image.height};
+
+    for (const Bitmap& level : build_mips(std::move(image), jobs))
+    {
+        std::vector<uchar> data = compress(level, format, jobs);
+
+        texture.levels.push_back({level.width, level.height, texture.data.size(), data.size()});
+        texture.data.insert(texture.data.end(), data.begin(), data.end());
+    }
+
+    return texture;
+}
+
+auto write_cooked(const std::filesystem::path& path, const CookedTexture& texture) -> bool
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Failed to open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    file.write(Magic.data(), Magic.size());
+    write_value(file, Version);
+    write_value(file, static_cast<uint>(texture.format));
+    write_value(file, texture.width);
+    write_value(file, texture.height);
+    write_value(file, static_cast<uint>(texture.levels.size()));
+    write_value(file, texture.sourceHash);
+
+    for (const CookedLevel& level : texture.levels)
+    {
+        write_value(file, level.width);
+        write_value(file, level.height);
+        write_value(file, static_cast<uint64_t>(level.offset));
+        write_value(file, static_cast<uint64_t>(level.size));
+    }
+
+    file.write(reinterpret_cast<const char*>(texture.data.data()), static_cast<std::streamsize>(texture.data.size()));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<bool>(file);
+}
+
+auto read_cooked(const std::filesystem::path& path) -> std::optional<CookedTexture>
+{
+    PROFILE_ZONE("Image::read_cooked");
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return std::nullopt;
+
+    std::array<char, 4> magic{};
+    uint version{}, format{}, levelCount{};
+    CookedTexture texture;
+
+    file.read(magic.data(), magic.size());
+    read_value(file, version);
+    read_value(file, format);
+    read_value(file, texture.width);
+    read_value(file, texture.height);
+    read_value(file, levelCount);
+    read_value(file, texture.sourceHash);
+
+    if (!file || magic != Magic || version != Version || format > static_cast<uint>(Format::BC7) || levelCount > MaxLevels)
+    {
+        std::cerr << "Invalid cooked texture " << path << std::endl;
+        return std::nullopt;
+    }
+
+    texture.format = static_cast<Format>(format);
+    texture.levels.resize(levelCount);
+
+    std::size_t dataSize = 0;
+    for (CookedLevel& level : texture.levels)
+    {
+        uint64_t offset{}, size{};
+        read_value(file, level.width);
+        read_value(file, level.height);
+        read_value(file, offset);
+        read_value(file, size);
+
+        level.offset = offset;
+        level.size = size;
+
+        if (size != data_bytes(texture.format, level.width, level.height) || offset != dataSize)
+            file.setstate(std::ios::failbit);
+
+        dataSize += size;
+    }
+
+    if (!file)
+    {
+        std::cerr << "Invalid level table in " << path << std::endl;
+        return std::nullopt;
+    }
+
+    texture.data.resize(dataSize);
+    file.read(reinterpret_cast<char*>(texture.data.data()), static_cast<std::streamsize>(dataSize));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    if (!file)
+    {
+        std::cerr << "Truncated cooked texture " << path << std::endl;
+        return std::nullopt;
+    }
+
+    return texture;
+}
+
+auto hash_file(const std::filesystem::path& path, std::optional<Format> format, uint width, uint height) -> std::optional<uint64_t>
+{
+    PROFILE_ZONE("Image::hash_file");
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return std::nullopt;
+
+    std::vector<char> contents(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+    if (!file)
+        return std::nullopt;
+
+    const std::array<uint64_t, 4> key{format ? static_cast<uint64_t>(*format) : AutoFormat, Version, width, height};
+
+    uint64_t hash = fnv1a(FnvOffset, contents.data(), contents.size());
+    return fnv1a(hash, reinterpret_cast<const char*>(key.data()), sizeof(key));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+auto cache_path(const std::filesystem::path& source, uint64_t hash) -> std::filesystem::path
+{
+    return CacheDirectory / std::format("{}-{:016x}{}", source.stem().string(), hash, CookedExtension.string());
+}
+
+auto cook_cached(
+    const std::filesystem::path& source,
+    std::optional<Format> format,
+    JobSystem* jobs,
+    uint width,
+    uint height
+) -> std::optional<CookedTexture>
+{
+    PROFILE_ZONE("Image::cook_cached");
+
+    const std::optional<uint64_t> hash = hash_file(source, format, width, height);
+    if (!hash)
+        return std::nullopt;
+
+    const std::filesystem::path path = cache_path(source, *hash);
+
+    std::error_code error;
+    if (std::filesystem::exists(path, error))
+        if (auto texture = read_cooked(path); texture && texture->sourceHash == *hash)
+            return texture;
+
+    std::optional<Bitmap> image = load_image(source);
+    if (!image)
+        return std::nullopt;
+
+    if (width != 0 && height != 0 && (image->width != width || image->height != height))
+        image = resize(*image, width, height);
+
+    const Format chosen = format.value_or(choose_format(*image));
+
+    CookedTexture texture = cook(std::move(*image), chosen, jobs);
+    texture.sourceHash = *hash;
+
+    // A cache that can't be written only costs the next load another cook
+    std::filesystem::create_directories(CacheDirectory, error);
+    if (error || !write_cooked(path, texture))
+        std::cerr << "Failed to write texture cache " << path << std::endl;
+
+    return texture;
+}
+
+} // namespace Image
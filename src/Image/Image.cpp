@@ -0,0 +1,223 @@
+/**
+ * @file Image.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of image decoding and mip generation
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Image/Image.hpp"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+// Rows of the halved image filtered by a single job
+constexpr uint RowsPerJob = 64;
+
+auto downsample_rows_scalar(const Image::Bitmap& image, Image::Bitmap& half, uint begin, uint end) -> void
+{
+    using Image::BytesPerPixel;
+
+    for (uint y = begin; y < end; y++)
+    {
+        const uint y0 = std::min(y * 2, image.height - 1);
+        const uint y1 = std::min(y * 2 + 1, image.height - 1);
+
+        for (uint x = 0; x < half.width; x++)
+        {
+            const uint x0 = std::min(x * 2, image.width - 1);
+            const uint x1 = std::min(x * 2 + 1, image.width - 1);
+
+            for (uint channel = 0; channel < BytesPerPixel; channel++)
+            {
+                const auto texel = [&](uint column, uint row) -> uint {
+                    return image.pixels[(static_cast<std::size_t>(row) * image.width + column) * BytesPerPixel + channel];
+                };
+
+                const uint sum = texel(x0, y0) + texel(x1, y0) + texel(x0, y1) + texel(x1, y1);
+                half.pixels[(static_cast<std::size_t>(y) * half.width + x) * BytesPerPixel + channel] = static_cast<uchar>((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+#ifdef __SSE2__
+
+// Two output pixels per iteration, same rounding as the scalar version. Needs both sides at least 2
+auto downsample_rows_sse2(const Image::Bitmap& image, Image::Bitmap& half, uint begin, uint end) -> void
+{
+    using Image::BytesPerPixel;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    const std::size_t sourceStride = static_cast<std::size_t>(image.width) * BytesPerPixel;
+
+    for (uint y = begin; y < end; y++)
+    {
+        const uchar* row0 = image.pixels.data() + y * 2 * sourceStride;
+        const uchar* row1 = row0 + sourceStride;
+        uchar* out = half.pixels.data() + static_cast<std::size_t>(y) * half.width * BytesPerPixel;
+
+        uint x = 0;
+        for (; x + 2 <= half.width; x += 2)
+        {
+            // 4 source pixels from both rows, widened to 16 bits: low halves hold pixels 0-1, high 2-3
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 2 * BytesPerPixel));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 2 * BytesPerPixel));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+            const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+            // Horizontal pairs: (p0 + p1, p2 + p3)
+            const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(low, high), _mm_unpackhi_epi64(low, high));
+            const __m128i average = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x * BytesPerPixel), _mm_packus_epi16(average, zero));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        // Odd output width, the last pixel
+        for (; x < half.width; x++)
+            for (uint channel = 0; channel < BytesPerPixel; channel++)
+            {
+                const std::size_t column = static_cast<std::size_t>(x) * 2 * BytesPerPixel + channel;
+                const uint sum = row0[column] + row0[column + BytesPerPixel] + row1[column] + row1[column + BytesPerPixel];
+                out[x * BytesPerPixel + channel] = static_cast<uchar>((sum + 2) / 4);
+            }
+    }
+}
+
+#endif
+
+} // namespace
+
+namespace Image
+{
+
+auto Bitmap::isOpaque() const -> bool
+{
+    for (std::size_t i = 3; i < pixels.size(); i += BytesPerPixel)
+        if (pixels[i] != 255)
+            return false;
+
+    return true;
+}
+
+auto load_image(const std::filesystem::path& path) -> std::optional<Bitmap>
+{
+    PROFILE_ZONE("Image::load_image");
+
+    int width{}, height{}, channels{};
+    uchar* data = stbi_load(path.c_str(), &width, &height, &channels, BytesPerPixel); // NOLINT (clang-analyzer-unix.Malloc)
+
+    if (data == nullptr)
+        return std::nullopt;
+
+    Bitmap image{static_cast<uint>(width), static_cast<uint>(height)};
+    image.pixels.resize(image.size());
+
+    const std::size_t rowBytes = static_cast<std::size_t>(width) * BytesPerPixel;
+    for (int row = 0; row < height; row++)
+        std::memcpy(image.pixels.data() + (height - 1 - row) * rowBytes, data + row * rowBytes, rowBytes);
+
+    stbi_image_free(data);
+    return image;
+}
+
+auto downsample(const Bitmap& image, JobSystem* jobs) -> Bitmap
+{
+    Bitmap half{std::max(image.width / 2, 1u), std::max(image.height / 2, 1u)};
+    half.pixels.resize(half.size());
+
+    const auto filter = [&](uint begin, uint end) {
+#ifdef __SSE2__
+        if (image.width >= 2 && image.height >= 2)
+        {
+            downsample_rows_sse2(image, half, begin, end);
+            return;
+        }
+#endif
+        downsample_rows_scalar(image, half, begin, end);
+    };
+
+    if (jobs != nullptr)
+        jobs->parallel_for(0, half.height, RowsPerJob, filter);
+    else
+        filter(0, half.height);
+
+    return half;
+}
+
+auto resize(const Bitmap& image, uint width, uint height) -> Bitmap
+{
+    PROFILE_ZONE("Image::resize");
+
+    Bitmap resized{width, height};
+    resized.pixels.resize(resized.size());
+
+    const float scaleX = static_cast<float>(image.width) / static_cast<float>(width);
+    const float scaleY = static_cast<float>(image.height) / static_cast<float>(height);
+
+    for (uint y = 0; y < height; y++)
+    {
+        const float sourceY = std::clamp((static_cast<float>(y) + 0.5f) * scaleY - 0.5f, 0.f, static_cast<float>(image.height - 1));
+        const uint y0 = static_cast<uint>(sourceY);
+        const uint y1 = std::min(y0 + 1, image.height - 1);
+        const float fy = sourceY - static_cast<float>(y0);
+
+        for (uint x = 0; x < width; x++)
+        {
+            const float sourceX = std::clamp((static_cast<float>(x) + 0.5f) * scaleX - 0.5f, 0.f, static_cast<float>(image.width - 1));
+            const uint x0 = static_cast<uint>(sourceX);
+            const uint x1 = std::min(x0 + 1, image.width - 1);
+            const float fx = sourceX - static_cast<float>(x0);
+
+            for (uint channel = 0; channel < BytesPerPixel; channel++)
+            {
+                const auto texel = [&](uint column, uint row) -> float {
+                    return image.pixels[(static_cast<std::size_t>(row) * image.width + column) * BytesPerPixel + channel];
+                };
+
+                const float top = texel(x0, y0) + (texel(x1, y0) - texel(x0, y0)) * fx;
+                const float bottom = texel(x0, y1) + (texel(x1, y1) - texel(x0, y1)) * fx;
+
+                resized.pixels[(static_cast<std::size_t>(y) * width + x) * BytesPerPixel + channel] =
+                    static_cast<uchar>(std::lround(top + (bottom - top) * fy));
+            }
+        }
+    }
+
+    return resized;
+}
+
+auto build_mips(Bitmap image, JobSystem* jobs) -> std::vector<Bitmap>
+{
+    PROFILE_ZONE("Image::build_mips");
+
+    std::vector<Bitmap> levels;
+    levels.push_back(std::move(image));
+
+    while (levels.back().width > 1 || levels.back().height > 1)
+    {
+        Bitmap next = downsample(levels.back(), jobs);
+        levels.push_back(std::move(next));
+    }
+
+    return levels;
+}
+
+} // namespace Image
@@ -0,0 +1,217 @@
+/**
+ * @file JobSystem.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of JobSystem class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "JobSystem.hpp"
+
+#include "Profiler.hpp"
+
+namespace
+{
+    // Queue owned by current thread in the system it works for, threads of one system
+    // pushing into another use its queue 0 like threads that aren't workers
+    struct Worker {
+        const JobSystem* owner;
+        uint index;
+    };
+
+    thread_local Worker worker{nullptr, 0};
+}   // namespace
+
+JobSystem::JobSystem(uint workerCount)
+{
+    m_queues.reserve(workerCount + 1);
+    for (uint i = 0; i <= workerCount; i++)
+        m_queues.push_back(std::make_unique<Queue>());
+
+    m_threads.reserve(workerCount);
+    for (uint i = 1; i <= workerCount; i++)
+        m_threads.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock{m_sleepMutex};
+        m_running = false;
+    }
+    m_wakeUp.notify_all();
+
+    // Workers leave once the queues are empty, whatever is left (everything without workers) runs here
+    for (auto& thread : m_threads)
+        thread.join();
+
+    Task task;
+    while (pop(task))
+        execute(task);
+}
+
+auto JobSystem::schedule(Job job, Counter* counter) -> void
+{
+    if (counter != nullptr)
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    push({std::move(job), counter});
+}
+
+auto JobSystem::scheduleAfter(Counter& dependency, Job job, Counter* counter) -> void
+{
+    if (counter != nullptr)
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard lock{dependency.m_mutex};
+
+        if (!dependency.isDone())
+        {
+            dependency.m_continuations.push_back({std::move(job), counter});
+            return;
+        }
+    }
+
+    push({std::move(job), counter});
+}
+
+auto JobSystem::wait(Counter& counter) -> void
+{
+    Task task;
+
+    while (!counter.isDone())
+    {
+        if (pop(task))
+            execute(task);
+        else
+            std::this_thread::yield();
+    }
+
+    // Job that brought the counter to zero may still hold its mutex, the counter
+    // usually lives on the caller's stack and mustn't be destroyed before it's released
+    std::lock_guard lock{counter.m_mutex};
+}
+
+auto JobSystem::default_worker_count() -> uint
+{
+    const uint hardware = std::thread::hardware_concurrency();
+
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+    /**   PRIVATE   **/
+
+auto JobSystem::push(Task task) -> void
+{
+    auto& queue = *m_queues[workerIndex()];
+    {
+        std::lock_guard lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    m_queued.fetch_add(1, std::memory_order_release);
+
+    // Sleeping worker checks m_queued while holding the mutex, taking it here makes sure
+    // the notification can't land between that check and the worker going to sleep
+    { std::lock_guard lock{m_sleepMutex}; }
+    m_wakeUp.notify_one();
+}
+
+auto JobSystem::pop(Task& task) -> bool
+{
+    if (m_queued.load(std::memory_order_acquire) == 0)
+        return false;
+
+    // Own queue first, newest task is most likely still in cache
+    {
+        auto& own = *m_queues[workerIndex()];
+        std::lock_guard lock{own.mutex};
+
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal oldest task from someone else, starting after own queue so victims are spread
+    const uint count = m_queues.size();
+    const uint own = workerIndex();
+    for (uint i = 1; i < count; i++)
+    {
+        auto& victim = *m_queues[(own + i) % count];
+        std::unique_lock lock{victim.mutex, std::try_to_lock};
+
+        if (lock.owns_lock() && !victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+auto JobSystem::execute(Task& task) -> void
+{
+    PROFILE_ZONE("Job");
+
+    task.job();
+    task.job = nullptr;
+
+    finish(task.counter);
+}
+
+auto JobSystem::finish(Counter* counter) -> void
+{
+    if (counter == nullptr)
+        return;
+
+    // Counter reaches zero while its mutex is held and isn't touched after the lock is released,
+    // wait() takes the mutex before returning, so the counter can't be destroyed while it's still in use
+    std::vector<Counter::Continuation> continuations;
+    {
+        std::lock_guard lock{counter->m_mutex};
+
+        if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            continuations.swap(counter->m_continuations);
+    }
+
+    for (auto& continuation : continuations)
+        push({std::move(continuation.job), continuation.counter});
+}
+
+auto JobSystem::workerIndex() const -> uint
+{
+    return worker.owner == this ? worker.index : 0;
+}
+
+auto JobSystem::workerLoop(uint index) -> void
+{
+    worker = {this, index};
+    PROFILE_THREAD("Worker " + std::to_string(index));
+
+    Task task;
+
+    // Queued jobs are still run after stopping, a job that's running may queue more of them
+    while (m_running || m_queued.load(std::memory_order_acquire) > 0)
+    {
+        if (pop(task))
+        {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock lock{m_sleepMutex};
+        m_wakeUp.wait(lock, [this]() {
+            return !m_running || m_queued.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
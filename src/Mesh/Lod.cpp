@@ -0,0 +1,174 @@
+/**
+ * @file Lod.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of LOD chain generation and serialization
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Lod.hpp"
+
+#include <cmath>
+#include <array>
+#include <fstream>
+#include <iostream>
+
+#include "Mesh/Simplify.hpp"
+#include "Mesh/Optimize.hpp"
+#include "Renderer/Model.hpp"
+
+namespace
+{
+
+constexpr std::array<char, 4> Magic{'L', 'O', 'D', 'C'};
+constexpr uint Version = 1;
+
+// Level has to drop at least this fraction of triangles of the previous one to be kept
+constexpr float MinReduction = 0.1f;
+
+auto append_level(Mesh::LodChain& chain, Mesh::IndexedMesh mesh, float error, bool optimize) -> void
+{
+    if (optimize)
+        Mesh::optimize_mesh(mesh);
+
+    chain.levels.push_back({
+        static_cast<uint>(chain.indices.size()),
+        static_cast<uint>(mesh.indices.size()),
+        static_cast<uint>(chain.vertices.size()),
+        error
+    });
+
+    chain.vertices.insert(chain.vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+    chain.indices.insert(chain.indices.end(), mesh.indices.begin(), mesh.indices.end());
+}
+
+template<typename T>
+auto write_array(std::ofstream& file, const std::vector<T>& data) -> void
+{
+    const uint count = data.size();
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(data.data()), count * sizeof(T));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+template<typename T>
+auto read_array(std::ifstream& file, std::vector<T>& data) -> bool
+{
+    // Upper bound, only guards against allocating garbage sizes from a broken file
+    constexpr uint MaxCount = 1u << 28;
+
+    uint count{};
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!file || count > MaxCount)
+        return false;
+
+    data.resize(count);
+    file.read(reinterpret_cast<char*>(data.data()), count * sizeof(T));     // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+namespace Mesh
+{
+
+auto build_lod_chain(const IndexedMesh& mesh, const LodSettings& settings) -> LodChain
+{
+    LodChain chain;
+    chain.radius = mesh.radius();
+    append_level(chain, mesh, 0.f, settings.optimize);
+
+    const float maxError = settings.maxRelativeError * chain.radius;
+    float target = static_cast<float>(mesh.triangleCount());
+
+    while (chain.levels.size() < settings.maxLevels)
+    {
+        target *= settings.ratio;
+
+        const auto [simplified, error] = simplify(mesh, static_cast<uint>(target), maxError);
+        const uint previous = chain.triangleCount(chain.levels.size() - 1);
+
+        if (simplified.triangleCount() == 0 ||
+            static_cast<float>(simplified.triangleCount()) > static_cast<float>(previous) * (1.f - MinReduction))
+            break;
+
+        append_level(chain, simplified, std::max(error, chain.levels.back().error), settings.optimize);
+    }
+
+    return chain;
+}
+
+auto write_lod_chain(const std::filesystem::path& path, const LodChain& chain) -> bool
+{
+    std::ofstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return false;
+    }
+
+    file.write(Magic.data(), Magic.size());
+    file.write(reinterpret_cast<const char*>(&Version), sizeof(Version));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(&chain.radius), sizeof(chain.radius));     // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    write_array(file, chain.levels);
+    write_array(file, chain.vertices);
+    write_array(file, chain.indices);
+
+    return static_cast<bool>(file);
+}
+
+auto read_lod_chain(const std::filesystem::path& path) -> std::optional<LodChain>
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+        return std::nullopt;
+
+    std::array<char, 4> magic{};
+    uint version{};
+    LodChain chain;
+
+    file.read(magic.data(), magic.size());
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    file.read(reinterpret_cast<char*>(&chain.radius), sizeof(chain.radius));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    if (!file || magic != Magic || version != Version)
+    {
+        std::cerr << "Not a LOD chain (or an old version): " << path << std::endl;
+        return std::nullopt;
+    }
+
+    if (!read_array(file, chain.levels) || !read_array(file, chain.vertices) || !read_array(file, chain.indices) ||
+        chain.levels.empty())
+    {
+        std::cerr << "LOD chain is truncated: " << path << std::endl;
+        return std::nullopt;
+    }
+
+    for (const auto& level : chain.levels)
+    {
+        if (static_cast<uint64_t>(level.firstIndex) + level.indexCount > chain.indices.size() ||
+            level.baseVertex > chain.vertices.size())
+        {
+            std::cerr << "LOD chain has levels out of range: " << path << std::endl;
+            return std::nullopt;
+        }
+    }
+
+    return chain;
+}
+
+auto load_lod_chain(const std::filesystem::path& chainPath, const std::filesystem::path& modelPath) -> LodChain
+{
+    if (auto chain = read_lod_chain(chainPath))
+        return std::move(*chain);
+
+    std::cerr << "No LOD chain in " << chainPath << ", building it from " << modelPath
+        << " (generate it offline with MeshLod)" << std::endl;
+
+    return build_lod_chain(from_model(Renderer::read_model(modelPath)));
+}
+
+} // namespace Mesh
@@ -0,0 +1,67 @@
+/**
+ * @file Mesh.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of indexed mesh helpers
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Mesh.hpp"
+
+#include <map>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+namespace Mesh
+{
+
+auto IndexedMesh::radius() const -> float
+{
+    float radius = 0.f;
+
+    for (const auto& vertex : vertices)
+        radius = std::max(radius, glm::length(vertex.position));
+
+    return radius;
+}
+
+auto from_model(const Renderer::Model& model) -> IndexedMesh
+{
+    constexpr uint FloatsPerVertex = 5;
+
+    const auto& elements = model.layout.GetElements();
+    if (elements.size() < 2 || elements[0].count != 3 || elements[1].count != 2 ||
+        model.layout.GetStride() != FloatsPerVertex * sizeof(float))
+    {
+        std::cerr << "Model layout has to be position (3 floats) and texture coordinates (2 floats)" << std::endl;
+        return {};
+    }
+
+    IndexedMesh mesh;
+    // Keyed by exact bits, only vertices written identically are welded
+    std::map<std::array<uint, FloatsPerVertex>, uint> unique;
+
+    for (uint i = 0; i + FloatsPerVertex <= model.vertices.size(); i += FloatsPerVertex)
+    {
+        std::array<uint, FloatsPerVertex> key{};
+        std::memcpy(key.data(), &model.vertices[i], sizeof(key));
+
+        const auto [it, inserted] = unique.try_emplace(key, mesh.vertices.size());
+        if (inserted)
+            mesh.vertices.push_back({
+                {model.vertices[i], model.vertices[i + 1], model.vertices[i + 2]},
+                {model.vertices[i + 3], model.vertices[i + 4]}
+            });
+
+        mesh.indices.push_back(it->second);
+    }
+
+    mesh.indices.resize(mesh.indices.size() / 3 * 3);
+    return mesh;
+}
+
+} // namespace Mesh
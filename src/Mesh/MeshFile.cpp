@@ -0,0 +1,286 @@
+/**
+ * @file MeshFile.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of mesh file writing and mapping
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/MeshFile.hpp"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+constexpr std::array<char, 4> Magic{'M', 'E', 'S', 'H'};
+constexpr uint Version = 1;
+
+// Upper bound of the attribute count, only guards against garbage in a broken file
+constexpr uint MaxAttributes = 16;
+
+struct FileHeader {
+    std::array<char, 4> magic;
+    uint version;
+    uint attributeCount;
+    uint stride;
+    uint vertexCount;
+    uint indexCount;
+    std::array<float, 3> boundsMin;
+    std::array<float, 3> boundsMax;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+}; // struct FileHeader
+
+struct FileAttribute {
+    uint count;
+    uint type;
+    uint normalized;
+}; // struct FileAttribute
+
+// Written and read as raw bytes, layout must not depend on the compiler
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) == 64);
+static_assert(std::is_trivially_copyable_v<FileAttribute> && sizeof(FileAttribute) == 12);
+
+auto align(uint64_t offset) -> uint64_t
+{
+    return (offset + Mesh::MeshBlobAlignment - 1) / Mesh::MeshBlobAlignment * Mesh::MeshBlobAlignment;
+}
+
+// Written so it can't overflow, offsets of a broken file can be anything
+auto fits(uint64_t offset, uint64_t bytes, uint64_t size) -> bool
+{
+    return offset <= size && bytes <= size - offset;
+}
+
+auto position_bounds(const Mesh::MeshData& mesh) -> Scene::AABB
+{
+    Scene::AABB bounds;
+
+    const auto& elements = mesh.layout.GetElements();
+    if (elements.empty() || elements[0].type != GL_FLOAT || elements[0].count != 3)
+        return bounds;
+
+    for (uint i = 0; i < mesh.vertexCount; i++)
+    {
+        glm::vec3 position;
+        std::memcpy(&position, mesh.vertices.data() + static_cast<std::size_t>(i) * mesh.layout.GetStride(), sizeof(position));
+        bounds.grow(position);
+    }
+
+    return bounds;
+}
+
+} // namespace
+
+namespace Mesh
+{
+
+auto to_mesh_data(const Renderer::Model& model) -> MeshData
+{
+    MeshData mesh{model.layout};
+
+    const std::size_t bytes = model.vertices.size() * sizeof(float);
+    mesh.vertexCount = model.layout.GetStride() != 0 ? bytes / model.layout.GetStride() : 0;
+    mesh.vertices.resize(static_cast<std::size_t>(mesh.vertexCount) * model.layout.GetStride());
+    std::memcpy(mesh.vertices.data(), model.vertices.data(), mesh.vertices.size());
+
+    mesh.bounds = position_bounds(mesh);
+    return mesh;
+}
+
+auto to_mesh_data(const IndexedMesh& indexed) -> MeshData
+{
+    MeshData mesh;
+    mesh.layout.Push<float>(3);     // position
+    mesh.layout.Push<float>(2);     // texture coordinates
+
+    static_assert(sizeof(Vertex) == 5 * sizeof(float));
+
+    mesh.vertexCount = indexed.vertices.size();
+    mesh.vertices.resize(indexed.vertices.size() * sizeof(Vertex));
+    std::memcpy(mesh.vertices.data(), indexed.vertices.data(), mesh.vertices.size());
+    mesh.indices = indexed.indices;
+
+    mesh.bounds = position_bounds(mesh);
+    return mesh;
+}
+
+auto to_mesh_data(const ObjMesh& obj) -> MeshData
+{
+    MeshData mesh;
+    mesh.layout.Push<float>(3);     // position
+    mesh.layout.Push<float>(2);     // texture coordinates
+    mesh.layout.Push<float>(3);     // normal
+
+    static_assert(sizeof(ObjVertex) == 8 * sizeof(float));
+
+    mesh.vertexCount = obj.vertices.size();
+    mesh.vertices.resize(obj.vertices.size() * sizeof(ObjVertex));
+    std::memcpy(mesh.vertices.data(), obj.vertices.data(), mesh.vertices.size());
+    mesh.indices = obj.indices;
+    mesh.bounds = obj.bounds;
+
+    return mesh;
+}
+
+auto write_mesh(const std::filesystem::path& path, const MeshData& mesh) -> bool
+{
+    const auto& elements = mesh.layout.GetElements();
+
+    FileHeader header{
+        .magic = Magic,
+        .version = Version,
+        .attributeCount = static_cast<uint>(elements.size()),
+        .stride = mesh.layout.GetStride(),
+        .vertexCount = mesh.vertexCount,
+        .indexCount = static_cast<uint>(mesh.indices.size()),
+        .boundsMin = {mesh.bounds.min.x, mesh.bounds.min.y, mesh.bounds.min.z},
+        .boundsMax = {mesh.bounds.max.x, mesh.bounds.max.y, mesh.bounds.max.z},
+        .vertexOffset = 0,
+        .indexOffset = 0
+    };
+
+    header.vertexOffset = align(sizeof(FileHeader) + elements.size() * sizeof(FileAttribute));
+    header.indexOffset = align(header.vertexOffset + mesh.vertices.size());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Failed to open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));     // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    for (const auto& element : elements)
+    {
+        const FileAttribute attribute{element.count, element.type, element.normalized};
+        file.write(reinterpret_cast<const char*>(&attribute), sizeof(attribute));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    const std::array<char, MeshBlobAlignment> padding{};
+    auto pad_to = [&](uint64_t offset) {
+        file.write(padding.data(), static_cast<std::streamsize>(offset - static_cast<uint64_t>(file.tellp())));
+    };
+
+    pad_to(header.vertexOffset);
+    file.write(reinterpret_cast<const char*>(mesh.vertices.data()), static_cast<std::streamsize>(mesh.vertices.size()));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    pad_to(header.indexOffset);
+    file.write(reinterpret_cast<const char*>(mesh.indices.data()), static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint)));     // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    return static_cast<bool>(file);
+}
+
+MappedMesh::MappedMesh(const std::filesystem::path& path)
+{
+    PROFILE_ZONE("MappedMesh::MappedMesh");
+
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        std::cerr << "Failed to open mesh " << path << std::endl;
+        return;
+    }
+
+    struct stat status{};
+    if (fstat(file, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(FileHeader))
+    {
+        m_size = status.st_size;
+        m_mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (m_mapping == MAP_FAILED)
+            m_mapping = nullptr;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(file);
+
+    if (m_mapping == nullptr)
+    {
+        std::cerr << "Failed to map mesh " << path << std::endl;
+        return;
+    }
+
+    // Blobs are read front to back by the upload, let the kernel read ahead
+    madvise(m_mapping, m_size, MADV_SEQUENTIAL);
+    madvise(m_mapping, m_size, MADV_WILLNEED);
+
+    const auto* bytes = static_cast<const uchar*>(m_mapping);
+
+    FileHeader header{};
+    std::memcpy(&header, bytes, sizeof(header));
+
+    const uint64_t tableEnd = sizeof(FileHeader) + static_cast<uint64_t>(header.attributeCount) * sizeof(FileAttribute);
+
+    if (header.magic != Magic || header.version != Version || header.attributeCount > MaxAttributes || tableEnd > m_size)
+    {
+        std::cerr << "Not a mesh file (or an old version): " << path << std::endl;
+        unmap();
+        return;
+    }
+
+    for (uint i = 0; i < header.attributeCount; i++)
+    {
+        FileAttribute attribute{};
+        std::memcpy(&attribute, bytes + sizeof(FileHeader) + i * sizeof(FileAttribute), sizeof(attribute));
+
+        m_layout.Push({attribute.count, attribute.type, static_cast<uchar>(attribute.normalized)});
+
+        if (Renderer::GPU::VertexBufferElement::GetSizeOfType(attribute.type) == 0)
+            header.stride = 0;  // unknown type, rejected below
+    }
+
+    const uint64_t vertexBytes = static_cast<uint64_t>(header.vertexCount) * header.stride;
+    const uint64_t indexBytes = static_cast<uint64_t>(header.indexCount) * sizeof(uint);
+
+    if (header.stride == 0 || header.stride != m_layout.GetStride() ||
+        header.vertexOffset % MeshBlobAlignment != 0 || header.indexOffset % MeshBlobAlignment != 0 ||
+        header.vertexOffset < tableEnd || !fits(header.vertexOffset, vertexBytes, m_size) ||
+        !fits(header.indexOffset, indexBytes, m_size) || header.indexOffset < header.vertexOffset + vertexBytes)
+    {
+        std::cerr << "Mesh has invalid layout or is truncated: " << path << std::endl;
+        unmap();
+        return;
+    }
+
+    m_vertexCount = header.vertexCount;
+    m_vertices = {bytes + header.vertexOffset, vertexBytes};
+    m_indices = {reinterpret_cast<const uint*>(bytes + header.indexOffset), header.indexCount};  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    m_bounds = {
+        {header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]},
+        {header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]}
+    };
+}
+
+MappedMesh::~MappedMesh()
+{
+    unmap();
+}
+
+/**   PRIVATE   **/
+
+auto MappedMesh::unmap() -> void
+{
+    if (m_mapping != nullptr)
+        munmap(m_mapping, m_size);
+
+    m_mapping = nullptr;
+    m_size = 0;
+}
+
+} // namespace Mesh
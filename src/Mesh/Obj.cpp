@@ -0,0 +1,607 @@
+/**
+ * @file Obj.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of the OBJ and MTL importer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Obj.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <unordered_map>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+// Marks a corner without texture coordinates or normal
+constexpr uint NoIndex = ~0u;
+
+// Chunks smaller than this aren't worth a job, more chunks than threads even out uneven lines
+constexpr std::size_t MinChunkBytes = 1 << 20;
+constexpr uint ChunksPerThread = 4;
+
+struct Corner {
+    uint position;
+    uint texCoord;
+    uint normal;
+
+    auto operator==(const Corner&) const -> bool = default;
+}; // struct Corner
+
+struct MaterialSwitch {
+    std::size_t corner;     // corners of the chunk before the switch
+    std::string_view name;
+}; // struct MaterialSwitch
+
+struct VertexCounts {
+    uint positions{};
+    uint texCoords{};
+    uint normals{};
+}; // struct VertexCounts
+
+struct Chunk {
+    std::string_view text;
+
+    // Counted by the first pass, the second one writes vertex data at the global offsets
+    VertexCounts count{};
+    VertexCounts base{};
+
+    std::vector<Corner> corners{};  // three per triangle
+    std::vector<MaterialSwitch> switches{};
+    std::vector<std::string_view> libraries{};
+    Scene::AABB bounds{};
+    std::string_view error{};       // first face referring to missing data
+}; // struct Chunk
+
+struct VertexData {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texCoords;
+    std::vector<glm::vec3> normals;
+}; // struct VertexData
+
+auto next_line(std::string_view& text) -> std::string_view
+{
+    const std::size_t end = text.find('\n');
+    std::string_view line = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+
+    return line;
+}
+
+auto is_space(char c) -> bool
+{
+    return c == ' ' || c == '\t';
+}
+
+auto trim(std::string_view text) -> std::string_view
+{
+    while (!text.empty() && is_space(text.front()))
+        text.remove_prefix(1);
+    while (!text.empty() && is_space(text.back()))
+        text.remove_suffix(1);
+
+    return text;
+}
+
+// Splits line into its keyword and the rest
+auto split_keyword(std::string_view line) -> std::pair<std::string_view, std::string_view>
+{
+    line = trim(line);
+
+    const auto space = std::find_if(line.begin(), line.end(), is_space);
+    const std::size_t length = space - line.begin();
+
+    return {line.substr(0, length), line.substr(length)};
+}
+
+auto parse_float(const char*& it, const char* end, float& value) -> bool
+{
+    while (it != end && is_space(*it))
+        ++it;
+    if (it != end && *it == '+')    // from_chars doesn't take a plus sign
+        ++it;
+
+    const auto [next, error] = std::from_chars(it, end, value);
+    if (error != std::errc{})
+        return false;
+
+    it = next;
+    return true;
+}
+
+// Missing components stay 0
+template<typename Vec>
+auto parse_vec(std::string_view text, uint count) -> Vec
+{
+    Vec value{};
+    const char* it = text.data();
+
+    for (uint i = 0; i < count; i++)
+        if (!parse_float(it, text.data() + text.size(), value[i]))
+            break;
+
+    return value;
+}
+
+auto parse_scalar(std::string_view text) -> float
+{
+    float value{};
+    const char* it = text.data();
+    parse_float(it, text.data() + text.size(), value);
+
+    return value;
+}
+
+// OBJ indices are 1-based, negative ones count back from the last element defined so far
+auto resolve_index(const char*& it, const char* end, uint defined, uint total, uint& index) -> bool
+{
+    int value{};
+    const auto [next, error] = std::from_chars(it, end, value);
+    if (error != std::errc{} || value == 0)
+        return false;
+
+    it = next;
+    const int64_t resolved = value < 0 ? static_cast<int64_t>(defined) + value : static_cast<int64_t>(value) - 1;
+
+    if (resolved < 0 || resolved >= static_cast<int64_t>(total))
+        return false;
+
+    index = static_cast<uint>(resolved);
+    return true;
+}
+
+auto count_vertices(Chunk& chunk) -> void
+{
+    std::string_view text = chunk.text;
+
+    while (!text.empty())
+    {
+        const std::string_view keyword = split_keyword(next_line(text)).first;
+
+        if (keyword == "v")
+            chunk.count.positions++;
+        else if (keyword == "vt")
+            chunk.count.texCoords++;
+        else if (keyword == "vn")
+            chunk.count.normals++;
+    }
+}
+
+auto parse_face(Chunk& chunk, std::string_view corners, const VertexCounts& defined, const VertexCounts& totals, std::vector<Corner>& polygon) -> bool
+{
+    polygon.clear();
+
+    const char* it = corners.data();
+    const char* end = corners.data() + corners.size();
+
+    while (true)
+    {
+        while (it != end && is_space(*it))
+            ++it;
+        if (it == end)
+            break;
+
+        // v, v/vt, v//vn or v/vt/vn
+        Corner corner{NoIndex, NoIndex, NoIndex};
+
+        if (!resolve_index(it, end, defined.positions, totals.positions, corner.position))
+            return false;
+
+        if (it != end && *it == '/')
+        {
+            ++it;
+            if (it != end && *it != '/' && !resolve_index(it, end, defined.texCoords, totals.texCoords, corner.texCoord))
+                return false;
+
+            if (it != end && *it == '/')
+            {
+                ++it;
+                if (!resolve_index(it, end, defined.normals, totals.normals, corner.normal))
+                    return false;
+            }
+        }
+
+        if (it != end && !is_space(*it))
+            return false;
+
+        polygon.push_back(corner);
+    }
+
+    for (std::size_t i = 2; i < polygon.size(); i++)
+        chunk.corners.insert(chunk.corners.end(), {polygon[0], polygon[i - 1], polygon[i]});
+
+    return true;
+}
+
+auto parse_chunk(Chunk& chunk, VertexData& data) -> void
+{
+    const VertexCounts totals{
+        static_cast<uint>(data.positions.size()),
+        static_cast<uint>(data.texCoords.size()),
+        static_cast<uint>(data.normals.size())
+    };
+    VertexCounts defined = chunk.base;
+
+    std::vector<Corner> polygon;
+    std::string_view text = chunk.text;
+
+    while (!text.empty())
+    {
+        const std::string_view line = next_line(text);
+        const auto [keyword, rest] = split_keyword(line);
+
+        if (keyword == "v")
+        {
+            const auto position = parse_vec<glm::vec3>(rest, 3);
+            data.positions[defined.positions++] = position;
+            chunk.bounds.grow(position);
+        }
+        else if (keyword == "vt")
+            data.texCoords[defined.texCoords++] = parse_vec<glm::vec2>(rest, 2);
+        else if (keyword == "vn")
+            data.normals[defined.normals++] = parse_vec<glm::vec3>(rest, 3);
+        else if (keyword == "f")
+        {
+            if (!parse_face(chunk, rest, defined, totals, polygon))
+            {
+                chunk.error = line;
+                return;
+            }
+        }
+        else if (keyword == "usemtl")
+            chunk.switches.push_back({chunk.corners.size(), trim(rest)});
+        else if (keyword == "mtllib")
+            chunk.libraries.push_back(trim(rest));
+    }
+}
+
+// Chunks end after a line break, so no line is split between two of them
+auto split_chunks(std::string_view text, uint count) -> std::vector<Chunk>
+{
+    std::vector<Chunk> chunks(count);
+    std::size_t begin = 0;
+
+    for (uint i = 0; i < count; i++)
+    {
+        std::size_t end = text.size();
+
+        if (i + 1 < count)
+        {
+            end = text.find('\n', std::max(begin, text.size() * (i + 1) / count));
+            end = end == std::string_view::npos ? text.size() : end + 1;
+        }
+
+        chunks[i].text = text.substr(begin, end - begin);
+        begin = end;
+    }
+
+    return chunks;
+}
+
+/**
+ * @brief Maps corners to vertex indices. Vertices are chained from their position, so a lookup
+ *      only compares texture coordinate and normal indices of vertices sharing it. Faces mostly
+ *      refer to nearby positions, which keeps lookups in cache unlike hashing whole corners
+ */
+class CornerTable
+{
+    public:
+        explicit CornerTable(std::size_t positionCount) :
+            m_first(positionCount, NoIndex)
+        {
+            m_next.reserve(positionCount);
+        }
+
+        auto insert(const Corner& corner, std::vector<Corner>& unique) -> uint
+        {
+            uint* link = &m_first[corner.position];
+
+            for (; *link != NoIndex; link = &m_next[*link])
+                if (unique[*link] == corner)
+                    return *link;
+
+            const uint vertex = unique.size();
+            *link = vertex;
+
+            unique.push_back(corner);
+            m_next.push_back(NoIndex);
+
+            return vertex;
+        }
+    private:
+        std::vector<uint> m_first;  // first vertex at every position
+        std::vector<uint> m_next;   // next vertex at the same position
+}; // class CornerTable
+
+template<typename Func>
+auto for_each_chunk(std::vector<Chunk>& chunks, JobSystem* jobs, Func&& func) -> void
+{
+    if (jobs == nullptr)
+    {
+        for (Chunk& chunk : chunks)
+            func(chunk);
+        return;
+    }
+
+    jobs->parallel_for(0, chunks.size(), 1, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+            func(chunks[i]);
+    });
+}
+
+auto read_text(const std::filesystem::path& path) -> std::optional<std::string>
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return std::nullopt;
+
+    std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    file.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+    return file ? std::optional{std::move(text)} : std::nullopt;
+}
+
+} // namespace
+
+namespace Mesh
+{
+
+auto parse_obj(std::string_view text, JobSystem* jobs) -> std::optional<ObjMesh>
+{
+    PROFILE_ZONE("Mesh::parse_obj");
+
+    const uint threads = jobs != nullptr ? jobs->getThreadCount() : 1;
+    const uint chunkCount = threads > 1 ?
+        std::clamp<std::size_t>(text.size() / MinChunkBytes, 1, threads * ChunksPerThread) : 1;
+
+    std::vector<Chunk> chunks = split_chunks(text, chunkCount);
+
+    // Vertex data counts first, so every chunk knows where its data goes and can resolve relative indices
+    for_each_chunk(chunks, jobs, count_vertices);
+
+    VertexCounts totals{};
+    for (Chunk& chunk : chunks)
+    {
+        chunk.base = totals;
+        totals.positions += chunk.count.positions;
+        totals.texCoords += chunk.count.texCoords;
+        totals.normals += chunk.count.normals;
+    }
+
+    VertexData data{
+        std::vector<glm::vec3>(totals.positions),
+        std::vector<glm::vec2>(totals.texCoords),
+        std::vector<glm::vec3>(totals.normals)
+    };
+
+    for_each_chunk(chunks, jobs, [&data](Chunk& chunk) { parse_chunk(chunk, data); });
+
+    ObjMesh mesh;
+    mesh.hasTexCoords = !data.texCoords.empty();
+    mesh.hasNormals = !data.normals.empty();
+
+    std::size_t cornerCount = 0;
+    for (const Chunk& chunk : chunks)
+    {
+        if (!chunk.error.empty())
+        {
+            std::cerr << "Face refers to missing vertex data: " << chunk.error << std::endl;
+            return std::nullopt;
+        }
+
+        cornerCount += chunk.corners.size();
+        mesh.bounds.grow(chunk.bounds);
+
+        for (const std::string_view library : chunk.libraries)
+            if (std::ranges::find(mesh.materialLibraries, library) == mesh.materialLibraries.end())
+                mesh.materialLibraries.emplace_back(library);
+    }
+
+    // Deduplication runs in file order, so vertex order doesn't depend on the chunk count
+    std::vector<Corner> unique;
+    unique.reserve(totals.positions);
+    CornerTable table(totals.positions);
+
+    mesh.indices.reserve(cornerCount);
+
+    std::unordered_map<std::string_view, uint> materials;
+    uint material = ObjSubmesh::NoMaterial;
+    uint submeshStart = 0;
+
+    const auto closeSubmesh = [&]() {
+        const uint end = mesh.indices.size();
+        if (end == submeshStart)
+            return;
+
+        if (!mesh.submeshes.empty() && mesh.submeshes.back().material == material)
+            mesh.submeshes.back().indexCount += end - submeshStart;
+        else
+            mesh.submeshes.push_back({submeshStart, end - submeshStart, material});
+
+        submeshStart = end;
+    };
+
+    for (const Chunk& chunk : chunks)
+    {
+        std::size_t corner = 0;
+
+        for (std::size_t i = 0; i <= chunk.switches.size(); i++)
+        {
+            const std::size_t until = i < chunk.switches.size() ? chunk.switches[i].corner : chunk.corners.size();
+
+            for (; corner < until; corner++)
+                mesh.indices.push_back(table.insert(chunk.corners[corner], unique));
+
+            if (i == chunk.switches.size())
+                break;
+
+            closeSubmesh();
+
+            const std::string_view name = chunk.switches[i].name;
+            const auto [it, inserted] = materials.try_emplace(name, mesh.materials.size());
+            if (inserted)
+                mesh.materials.push_back({.name = std::string(name)});
+
+            material = it->second;
+        }
+    }
+
+    closeSubmesh();
+
+    mesh.vertices.resize(unique.size());
+
+    const auto fill = [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+        {
+            const Corner& corner = unique[i];
+            mesh.vertices[i] = {
+                data.positions[corner.position],
+                corner.texCoord != NoIndex ? data.texCoords[corner.texCoord] : glm::vec2{},
+                corner.normal != NoIndex ? data.normals[corner.normal] : glm::vec3{}
+            };
+        }
+    };
+
+    constexpr uint VerticesPerJob = 64 * 1024;
+    if (jobs != nullptr)
+        jobs->parallel_for(0, unique.size(), VerticesPerJob, fill);
+    else
+        fill(0, unique.size());
+
+    return mesh;
+}
+
+auto read_obj(const std::filesystem::path& path, JobSystem* jobs) -> std::optional<ObjMesh>
+{
+    PROFILE_ZONE("Mesh::read_obj");
+
+    const std::optional<std::string> text = read_text(path);
+    if (!text)
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return std::nullopt;
+    }
+
+    std::optional<ObjMesh> mesh = parse_obj(*text, jobs);
+    if (!mesh)
+        return std::nullopt;
+
+    std::vector<bool> found(mesh->materials.size());
+
+    for (const std::string& library : mesh->materialLibraries)
+    {
+        for (ObjMaterial& material : read_mtl(path.parent_path() / library))
+        {
+            const auto it = std::ranges::find(mesh->materials, material.name, &ObjMaterial::name);
+            if (it == mesh->materials.end())
+                continue;
+
+            *it = std::move(material);
+            found[it - mesh->materials.begin()] = true;
+        }
+    }
+
+    for (std::size_t i = 0; i < found.size(); i++)
+        if (!found[i])
+            std::cerr << "Material " << mesh->materials[i].name << " not found in MTL files of " << path << std::endl;
+
+    return mesh;
+}
+
+auto read_mtl(const std::filesystem::path& path) -> std::vector<ObjMaterial>
+{
+    std::vector<ObjMaterial> materials;
+
+    const std::optional<std::string> file = read_text(path);
+    if (!file)
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return materials;
+    }
+
+    // Colors may be given as a single value for all channels
+    const auto color = [](std::string_view text) -> glm::vec3 {
+        const char* it = text.data();
+        const char* end = text.data() + text.size();
+
+        glm::vec3 value{};
+        if (!parse_float(it, end, value.r))
+            return value;
+        if (!parse_float(it, end, value.g) || !parse_float(it, end, value.b))
+            return glm::vec3{value.r};
+
+        return value;
+    };
+
+    std::string_view text = *file;
+
+    while (!text.empty())
+    {
+        const auto [keyword, rest] = split_keyword(next_line(text));
+
+        if (keyword == "newmtl")
+        {
+            materials.push_back({.name = std::string(trim(rest))});
+            continue;
+        }
+
+        if (materials.empty())
+            continue;
+
+        ObjMaterial& material = materials.back();
+
+        if (keyword == "Ka")
+            material.ambient = color(rest);
+        else if (keyword == "Kd")
+            material.diffuse = color(rest);
+        else if (keyword == "Ks")
+            material.specular = color(rest);
+        else if (keyword == "Ke")
+            material.emissive = color(rest);
+        else if (keyword == "Ns")
+            material.shininess = parse_scalar(rest);
+        else if (keyword == "d")
+            material.opacity = parse_scalar(rest);
+        else if (keyword == "Tr")
+            material.opacity = 1.f - parse_scalar(rest);
+        else if (keyword == "Ni")
+            material.refraction = parse_scalar(rest);
+        else if (keyword == "illum")
+            material.illumination = static_cast<uint>(parse_scalar(rest));
+        else if (keyword == "map_Kd")
+        {
+            // Options come before the file name, which is the last token
+            const std::string_view value = trim(rest);
+            const std::size_t space = value.find_last_of(" \t");
+            material.diffuseMap = std::string(space == std::string_view::npos ? value : value.substr(space + 1));
+        }
+    }
+
+    return materials;
+}
+
+auto to_indexed_mesh(const ObjMesh& mesh) -> IndexedMesh
+{
+    IndexedMesh indexed;
+    indexed.vertices.reserve(mesh.vertices.size());
+
+    for (const ObjVertex& vertex : mesh.vertices)
+        indexed.vertices.push_back({vertex.position, vertex.texCoord});
+
+    indexed.indices = mesh.indices;
+    return indexed;
+}
+
+} // namespace Mesh
@@ -0,0 +1,562 @@
+/**
+ * @file Optimize.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of mesh reordering and its analysis
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Optimize.hpp"
+
+#include <array>
+#include <limits>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+constexpr uint NoVertex = ~0u;
+
+constexpr uint CacheLineBytes = 64;
+constexpr uint FetchCacheLines = 64;   // 4 KB of vertex data
+constexpr uint OverdrawResolution = 256;
+
+struct Range {
+    uint first;
+    uint count;
+}; // struct Range
+
+/**
+ * @brief FIFO cache of given size over indices 0..count-1, inserted entries are stamped with the
+ *      insertion counter, so an entry is cached while fewer than size entries were inserted after it
+ */
+class FifoCache
+{
+    public:
+        FifoCache(uint count, uint size) :
+            m_stamps(count, 0),
+            m_size(size),
+            m_time(size + 1)
+        {}
+
+        // Returns true on a miss, the entry is inserted then
+        auto access(uint entry) -> bool
+        {
+            if (m_time - m_stamps[entry] <= m_size)
+                return false;
+
+            m_stamps[entry] = m_time++;
+            return true;
+        }
+
+        auto clear() -> void { m_time += m_size + 1; }
+    private:
+        std::vector<uint> m_stamps;
+        uint m_size;
+        uint m_time;
+}; // class FifoCache
+
+auto triangle_misses(FifoCache& cache, std::span<const uint> indices, uint triangle) -> uint
+{
+    return cache.access(indices[triangle * 3]) + cache.access(indices[triangle * 3 + 1]) + cache.access(indices[triangle * 3 + 2]);
+}
+
+auto analyze(std::span<const uint> indices, std::span<const glm::vec3> positions, uint vertexCount, uint vertexSize) -> Mesh::OptimizeReport::Stats
+{
+    return {
+        Mesh::analyze_vertex_cache(indices, vertexCount),
+        Mesh::analyze_vertex_fetch(indices, vertexCount, vertexSize),
+        positions.empty() ? 0.f : Mesh::analyze_overdraw(indices, positions)
+    };
+}
+
+// Reorders triangles of every range in place, returns the vertex fetch remap
+auto optimize_indices(
+    std::vector<uint>& indices,
+    std::span<const Range> ranges,
+    uint vertexCount,
+    std::span<const glm::vec3> positions,
+    const Mesh::OptimizeSettings& settings
+) -> std::vector<uint>
+{
+    for (const Range& range : ranges)
+    {
+        const std::span<uint> part{indices.data() + range.first, range.count};
+
+        std::vector<uint> reordered = Mesh::optimize_vertex_cache(part, vertexCount, settings.cacheSize);
+
+        if (!positions.empty() && settings.overdrawThreshold > 0.f)
+            reordered = Mesh::optimize_overdraw(reordered, positions, settings.cacheSize, settings.overdrawThreshold);
+
+        std::ranges::copy(reordered, part.begin());
+    }
+
+    const std::vector<uint> remap = Mesh::vertex_fetch_remap(indices, vertexCount);
+
+    for (uint& index : indices)
+        index = remap[index];
+
+    return remap;
+}
+
+auto used_count(std::span<const uint> remap) -> uint
+{
+    return std::ranges::count_if(remap, [](uint index) { return index != NoVertex; });
+}
+
+template<typename T>
+auto apply_remap(std::vector<T>& items, std::span<const uint> remap) -> void
+{
+    std::vector<T> reordered(used_count(remap));
+
+    for (uint i = 0; i < remap.size(); i++)
+        if (remap[i] != NoVertex)
+            reordered[remap[i]] = items[i];
+
+    items = std::move(reordered);
+}
+
+template<typename Vertex>
+auto positions_of(const std::vector<Vertex>& vertices) -> std::vector<glm::vec3>
+{
+    std::vector<glm::vec3> positions(vertices.size());
+    std::ranges::transform(vertices, positions.begin(), &Vertex::position);
+
+    return positions;
+}
+
+auto edge(const glm::vec2& a, const glm::vec2& b, const glm::vec2& p) -> float
+{
+    return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+} // namespace
+
+namespace Mesh
+{
+
+auto analyze_vertex_cache(std::span<const uint> indices, uint vertexCount, uint cacheSize) -> VertexCacheStats
+{
+    if (indices.size() < 3)
+        return {};
+
+    FifoCache cache(vertexCount, cacheSize);
+    std::vector<bool> used(vertexCount);
+
+    uint misses = 0, usedCount = 0;
+    for (const uint index : indices)
+    {
+        misses += cache.access(index);
+
+        if (!used[index])
+        {
+            used[index] = true;
+            usedCount++;
+        }
+    }
+
+    return {
+        static_cast<float>(misses) / static_cast<float>(indices.size() / 3),
+        static_cast<float>(misses) / static_cast<float>(usedCount)
+    };
+}
+
+auto analyze_vertex_fetch(std::span<const uint> indices, uint vertexCount, uint vertexSize) -> float
+{
+    if (indices.empty() || vertexCount == 0 || vertexSize == 0)
+        return 0.f;
+
+    const std::size_t lineCount = (static_cast<std::size_t>(vertexCount) * vertexSize + CacheLineBytes - 1) / CacheLineBytes;
+
+    // Vertices still in the post-transform cache aren't fetched again
+    FifoCache vertexCache(vertexCount, DefaultCacheSize);
+    FifoCache lineCache(lineCount, FetchCacheLines);
+
+    std::size_t fetchedBytes = 0;
+    for (const uint index : indices)
+    {
+        if (!vertexCache.access(index))
+            continue;
+
+        const std::size_t begin = static_cast<std::size_t>(index) * vertexSize;
+        for (std::size_t line = begin / CacheLineBytes; line <= (begin + vertexSize - 1) / CacheLineBytes; line++)
+            if (lineCache.access(line))
+                fetchedBytes += CacheLineBytes;
+    }
+
+    return static_cast<float>(fetchedBytes) / static_cast<float>(static_cast<std::size_t>(vertexCount) * vertexSize);
+}
+
+auto analyze_overdraw(std::span<const uint> indices, std::span<const glm::vec3> positions) -> float
+{
+    PROFILE_ZONE("Mesh::analyze_overdraw");
+
+    if (indices.size() < 3 || positions.empty())
+        return 0.f;
+
+    Scene::AABB bounds;
+    for (const uint index : indices)
+        bounds.grow(positions[index]);
+
+    const glm::vec3 center = bounds.center();
+    const float extent = std::max({bounds.extent().x, bounds.extent().y, bounds.extent().z, 1e-6f});
+    const float scale = (OverdrawResolution - 1) / extent;
+
+    // Forward and up of a camera on each side of the mesh
+    const std::array<std::pair<glm::vec3, glm::vec3>, 6> views{{
+        {{0.f, 0.f, -1.f}, {0.f, 1.f, 0.f}}, {{0.f, 0.f, 1.f}, {0.f, 1.f, 0.f}},
+        {{-1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}}, {{1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}},
+        {{0.f, -1.f, 0.f}, {0.f, 0.f, -1.f}}, {{0.f, 1.f, 0.f}, {0.f, 0.f, 1.f}}
+    }};
+
+    std::vector<float> depth(OverdrawResolution * OverdrawResolution);
+    std::size_t shaded = 0, covered = 0;
+
+    for (const auto& [forward, up] : views)
+    {
+        const glm::vec3 right = glm::cross(forward, up);
+        std::ranges::fill(depth, std::numeric_limits<float>::max());
+
+        for (std::size_t triangle = 0; triangle + 2 < indices.size(); triangle += 3)
+        {
+            std::array<glm::vec2, 3> screen;
+            std::array<float, 3> z{};
+
+            for (uint corner = 0; corner < 3; corner++)
+            {
+                const glm::vec3 p = positions[indices[triangle + corner]] - center;
+                screen[corner] = glm::vec2{glm::dot(right, p), glm::dot(up, p)} * scale + glm::vec2{OverdrawResolution / 2.f};
+                z[corner] = glm::dot(forward, p);
+            }
+
+            // Back faces and degenerate triangles are culled, front faces are counter-clockwise
+            const float area = edge(screen[0], screen[1], screen[2]);
+            if (area <= 0.f)
+                continue;
+
+            const auto lo = glm::max(glm::min(glm::min(screen[0], screen[1]), screen[2]), glm::vec2{0.f});
+            const auto hi = glm::min(glm::max(glm::max(screen[0], screen[1]), screen[2]), glm::vec2{OverdrawResolution - 1.f});
+
+            for (uint y = static_cast<uint>(lo.y); y <= static_cast<uint>(hi.y); y++)
+            {
+                for (uint x = static_cast<uint>(lo.x); x <= static_cast<uint>(hi.x); x++)
+                {
+                    const glm::vec2 pixel{x + 0.5f, y + 0.5f};
+                    const float w0 = edge(screen[1], screen[2], pixel);
+                    const float w1 = edge(screen[2], screen[0], pixel);
+                    const float w2 = edge(screen[0], screen[1], pixel);
+
+                    if (w0 < 0.f || w1 < 0.f || w2 < 0.f)
+                        continue;
+
+                    const float d = (w0 * z[0] + w1 * z[1] + w2 * z[2]) / area;
+                    float& stored = depth[y * OverdrawResolution + x];
+
+                    if (d < stored)
+                    {
+                        stored = d;
+                        shaded++;
+                    }
+                }
+            }
+        }
+
+        covered += std::ranges::count_if(depth, [](float d) { return d != std::numeric_limits<float>::max(); });
+    }
+
+    return covered != 0 ? static_cast<float>(shaded) / static_cast<float>(covered) : 0.f;
+}
+
+auto optimize_vertex_cache(std::span<const uint> indices, uint vertexCount, uint cacheSize) -> std::vector<uint>
+{
+    PROFILE_ZONE("Mesh::optimize_vertex_cache");
+
+    const uint triangleCount = indices.size() / 3;
+
+    // Triangles around every vertex, live counts drop as triangles get emitted
+    std::vector<uint> live(vertexCount, 0);
+    for (uint i = 0; i < triangleCount * 3; i++)
+        live[indices[i]]++;
+
+    std::vector<uint> offsets(vertexCount + 1, 0);
+    std::inclusive_scan(live.begin(), live.end(), offsets.begin() + 1);
+
+    std::vector<uint> adjacency(offsets.back());
+    std::vector<uint> fill(offsets.begin(), offsets.end() - 1);
+    for (uint i = 0; i < triangleCount * 3; i++)
+        adjacency[fill[indices[i]]++] = i / 3;
+
+    std::vector<uint> stamps(vertexCount, 0);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint> deadEnds, candidates;
+    std::vector<uint> result;
+    result.reserve(triangleCount * 3);
+
+    uint time = cacheSize + 1;
+    uint cursor = 0;
+    uint fanning = triangleCount > 0 ? indices[0] : NoVertex;
+
+    while (fanning != NoVertex)
+    {
+        candidates.clear();
+
+        for (uint i = offsets[fanning]; i < offsets[fanning + 1]; i++)
+        {
+            const uint triangle = adjacency[i];
+            if (emitted[triangle])
+                continue;
+
+            for (uint corner = 0; corner < 3; corner++)
+            {
+                const uint vertex = indices[triangle * 3 + corner];
+
+                result.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                live[vertex]--;
+
+                if (time - stamps[vertex] > cacheSize)
+                    stamps[vertex] = time++;
+            }
+
+            emitted[triangle] = true;
+        }
+
+        // Next fanning vertex: one with live triangles that stays in cache while they're emitted,
+        // the longest cached first
+        fanning = NoVertex;
+        int bestPriority = -1;
+
+        for (const uint vertex : candidates)
+        {
+            if (live[vertex] == 0)
+                continue;
+
+            int priority = 0;
+            if (time - stamps[vertex] + 2 * live[vertex] <= cacheSize)
+                priority = time - stamps[vertex];
+
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                fanning = vertex;
+            }
+        }
+
+        if (fanning != NoVertex)
+            continue;
+
+        // Dead end, recently used vertices first, then the next vertex with live triangles in input order
+        while (!deadEnds.empty() && fanning == NoVertex)
+        {
+            if (live[deadEnds.back()] > 0)
+                fanning = deadEnds.back();
+            deadEnds.pop_back();
+        }
+
+        for (; fanning == NoVertex && cursor < triangleCount * 3; cursor++)
+            if (live[indices[cursor]] > 0)
+                fanning = indices[cursor];
+    }
+
+    return result;
+}
+
+auto optimize_overdraw(std::span<const uint> indices, std::span<const glm::vec3> positions, uint cacheSize, float threshold) -> std::vector<uint>
+{
+    PROFILE_ZONE("Mesh::optimize_overdraw");
+
+    const uint triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return {indices.begin(), indices.end()};
+
+    // Hard boundaries where all vertices missed, the cache order restarted there anyway
+    FifoCache cache(positions.size(), cacheSize);
+    std::vector<uint> misses(triangleCount);
+    std::vector<uint> hard;
+
+    for (uint triangle = 0; triangle < triangleCount; triangle++)
+    {
+        misses[triangle] = triangle_misses(cache, indices, triangle);
+        if (misses[triangle] == 3 || triangle == 0)
+            hard.push_back(triangle);
+    }
+    hard.push_back(triangleCount);
+
+    // Soft boundaries inside, wherever ACMR since the last boundary is close to the hard cluster's one
+    std::vector<uint> clusters;
+
+    for (uint h = 0; h + 1 < hard.size(); h++)
+    {
+        const uint begin = hard[h], end = hard[h + 1];
+        const float target = threshold * std::accumulate(misses.begin() + begin, misses.begin() + end, 0.f) / (end - begin);
+
+        cache.clear();
+        uint clusterStart = begin, clusterMisses = 0;
+        clusters.push_back(begin);
+
+        for (uint triangle = begin; triangle < end; triangle++)
+        {
+            clusterMisses += triangle_misses(cache, indices, triangle);
+
+            if (triangle + 1 < end && static_cast<float>(clusterMisses) / (triangle + 1 - clusterStart) <= target)
+            {
+                clusterStart = triangle + 1;
+                clusterMisses = 0;
+                clusters.push_back(clusterStart);
+                cache.clear();
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // Area weighted centroid and normal of every cluster
+    struct Cluster {
+        uint begin, end;
+        glm::vec3 centroid, normal;
+        float area;
+    }; // struct Cluster
+
+    std::vector<Cluster> sorted;
+    glm::vec3 meshCentroid{0.f};
+    float meshArea = 0.f;
+
+    for (uint c = 0; c + 1 < clusters.size(); c++)
+    {
+        Cluster cluster{clusters[c], clusters[c + 1], glm::vec3{0.f}, glm::vec3{0.f}, 0.f};
+
+        for (uint triangle = cluster.begin; triangle < cluster.end; triangle++)
+        {
+            const glm::vec3& a = positions[indices[triangle * 3]];
+            const glm::vec3& b = positions[indices[triangle * 3 + 1]];
+            const glm::vec3& c3 = positions[indices[triangle * 3 + 2]];
+
+            const glm::vec3 normal = glm::cross(b - a, c3 - a);
+            const float area = glm::length(normal);
+
+            cluster.centroid += (a + b + c3) * (area / 3.f);
+            cluster.normal += normal;
+            cluster.area += area;
+        }
+
+        meshCentroid += cluster.centroid;
+        meshArea += cluster.area;
+        sorted.push_back(cluster);
+    }
+
+    if (meshArea > 0.f)
+        meshCentroid /= meshArea;
+
+    const auto facing = [&](const Cluster& cluster) {
+        if (cluster.area <= 0.f || glm::length(cluster.normal) <= 0.f)
+            return 0.f;
+
+        return glm::dot(cluster.centroid / cluster.area - meshCentroid, glm::normalize(cluster.normal));
+    };
+
+    std::ranges::stable_sort(sorted, std::greater{}, facing);
+
+    std::vector<uint> result;
+    result.reserve(indices.size());
+
+    for (const Cluster& cluster : sorted)
+        result.insert(result.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+
+    return result;
+}
+
+auto vertex_fetch_remap(std::span<const uint> indices, uint vertexCount) -> std::vector<uint>
+{
+    std::vector<uint> remap(vertexCount, NoVertex);
+    uint next = 0;
+
+    for (const uint index : indices)
+        if (remap[index] == NoVertex)
+            remap[index] = next++;
+
+    return remap;
+}
+
+auto optimize_mesh(IndexedMesh& mesh, const OptimizeSettings& settings) -> OptimizeReport
+{
+    PROFILE_ZONE("Mesh::optimize_mesh");
+
+    const std::vector<glm::vec3> positions = positions_of(mesh.vertices);
+
+    OptimizeReport report;
+    report.before = analyze(mesh.indices, positions, mesh.vertices.size(), sizeof(Vertex));
+
+    const Range whole{0, static_cast<uint>(mesh.indices.size())};
+    const std::vector<uint> remap = optimize_indices(mesh.indices, {&whole, 1}, mesh.vertices.size(), positions, settings);
+    apply_remap(mesh.vertices, remap);
+
+    report.after = analyze(mesh.indices, positions_of(mesh.vertices), mesh.vertices.size(), sizeof(Vertex));
+    return report;
+}
+
+auto optimize_mesh(ObjMesh& mesh, const OptimizeSettings& settings) -> OptimizeReport
+{
+    PROFILE_ZONE("Mesh::optimize_mesh");
+
+    const std::vector<glm::vec3> positions = positions_of(mesh.vertices);
+
+    OptimizeReport report;
+    report.before = analyze(mesh.indices, positions, mesh.vertices.size(), sizeof(ObjVertex));
+
+    std::vector<Range> ranges;
+    for (const ObjSubmesh& submesh : mesh.submeshes)
+        ranges.push_back({submesh.firstIndex, submesh.indexCount});
+
+    const std::vector<uint> remap = optimize_indices(mesh.indices, ranges, mesh.vertices.size(), positions, settings);
+    apply_remap(mesh.vertices, remap);
+
+    report.after = analyze(mesh.indices, positions_of(mesh.vertices), mesh.vertices.size(), sizeof(ObjVertex));
+    return report;
+}
+
+auto optimize_mesh(MeshData& mesh, const OptimizeSettings& settings) -> OptimizeReport
+{
+    PROFILE_ZONE("Mesh::optimize_mesh");
+
+    const uint stride = mesh.layout.GetStride();
+    const auto& elements = mesh.layout.GetElements();
+    const bool hasPositions = !elements.empty() && elements[0].type == GL_FLOAT && elements[0].count == 3;
+
+    const auto positions = [&]() {
+        std::vector<glm::vec3> result(hasPositions ? mesh.vertexCount : 0);
+        for (uint i = 0; i < result.size(); i++)
+            std::memcpy(&result[i], mesh.vertices.data() + static_cast<std::size_t>(i) * stride, sizeof(glm::vec3));
+        return result;
+    };
+
+    OptimizeReport report;
+    report.before = analyze(mesh.indices, positions(), mesh.vertexCount, stride);
+
+    if (mesh.indices.empty())
+    {
+        report.after = report.before;
+        return report;
+    }
+
+    const Range whole{0, static_cast<uint>(mesh.indices.size())};
+    const std::vector<uint> remap = optimize_indices(mesh.indices, {&whole, 1}, mesh.vertexCount, positions(), settings);
+
+    std::vector<uchar> reordered(static_cast<std::size_t>(used_count(remap)) * stride);
+    for (uint i = 0; i < remap.size(); i++)
+        if (remap[i] != NoVertex)
+            std::memcpy(reordered.data() + static_cast<std::size_t>(remap[i]) * stride, mesh.vertices.data() + static_cast<std::size_t>(i) * stride, stride);
+
+    mesh.vertices = std::move(reordered);
+    mesh.vertexCount = mesh.vertices.size() / stride;
+
+    report.after = analyze(mesh.indices, positions(), mesh.vertexCount, stride);
+    return report;
+}
+
+} // namespace Mesh
@@ -0,0 +1,198 @@
+/**
+ * @file Quantize.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of vertex attribute quantization
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Quantize.hpp"
+
+#include <cmath>
+#include <array>
+#include <cstring>
+#include <algorithm>
+
+#include <glm/gtc/packing.hpp>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+using Renderer::GPU::VertexBufferElement;
+
+enum class Encoding {
+    Copy,
+    Half,
+    Unorm16,
+    Snorm10x3
+};
+
+struct Attribute {
+    VertexBufferElement source;
+    VertexBufferElement target;
+    uint sourceOffset;
+    uint targetOffset;
+    Encoding encoding;
+}; // struct Attribute
+
+auto read_float(const uchar* vertex, uint component) -> float
+{
+    float value{};
+    std::memcpy(&value, vertex + component * sizeof(float), sizeof(float));
+    return value;
+}
+
+auto all_components_in(const Mesh::MeshData& mesh, uint offset, uint count, float lo, float hi) -> bool
+{
+    const uint stride = mesh.layout.GetStride();
+
+    for (uint vertex = 0; vertex < mesh.vertexCount; vertex++)
+    {
+        for (uint component = 0; component < count; component++)
+        {
+            const float value = read_float(mesh.vertices.data() + static_cast<std::size_t>(vertex) * stride + offset, component);
+            if (!(value >= lo && value <= hi))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+auto choose_encoding(const Mesh::MeshData& mesh, const VertexBufferElement& element, uint index, uint offset) -> Attribute
+{
+    Attribute attribute{element, element, offset, 0, Encoding::Copy};
+
+    if (element.type != GL_FLOAT || element.normalized != GL_FALSE)
+        return attribute;
+
+    if (index == 0 && element.count == 3)
+        attribute.encoding = Encoding::Half;
+    else if (element.count == 2 && all_components_in(mesh, offset, 2, 0.f, 1.f))
+        attribute.encoding = Encoding::Unorm16;
+    else if (element.count == 3 && all_components_in(mesh, offset, 3, -1.f, 1.f))
+        attribute.encoding = Encoding::Snorm10x3;
+    else
+        attribute.encoding = Encoding::Half;
+
+    switch (attribute.encoding)
+    {
+        case Encoding::Half:
+            attribute.target = {element.count + element.count % 2, GL_HALF_FLOAT, GL_FALSE};
+            break;
+        case Encoding::Unorm16:
+            attribute.target = {2, GL_UNSIGNED_SHORT, GL_TRUE};
+            break;
+        case Encoding::Snorm10x3:
+            attribute.target = {4, GL_INT_2_10_10_10_REV, GL_TRUE};
+            break;
+        case Encoding::Copy:
+            break;
+    }
+
+    return attribute;
+}
+
+// Encodes one vertex's attribute, returns the largest difference of a decoded component
+auto encode(const Attribute& attribute, const uchar* source, uchar* target) -> float
+{
+    const uint count = attribute.source.count;
+    float error = 0.f;
+
+    switch (attribute.encoding)
+    {
+        case Encoding::Copy:
+            std::memcpy(target, source, attribute.source.GetSize());
+            break;
+        case Encoding::Half:
+            for (uint component = 0; component < attribute.target.count; component++)
+            {
+                // Padding component is w of a position, so it's 1
+                const float value = component < count ? read_float(source, component) : 1.f;
+                const uint16_t half = glm::packHalf1x16(value);
+
+                std::memcpy(target + component * sizeof(half), &half, sizeof(half));
+                error = std::max(error, std::abs(glm::unpackHalf1x16(half) - value));
+            }
+            break;
+        case Encoding::Unorm16:
+            for (uint component = 0; component < count; component++)
+            {
+                const float value = read_float(source, component);
+                const uint16_t unorm = glm::packUnorm1x16(value);
+
+                std::memcpy(target + component * sizeof(unorm), &unorm, sizeof(unorm));
+                error = std::max(error, std::abs(glm::unpackUnorm1x16(unorm) - value));
+            }
+            break;
+        case Encoding::Snorm10x3:
+        {
+            const glm::vec4 value{read_float(source, 0), read_float(source, 1), read_float(source, 2), 0.f};
+            const uint32_t packed = glm::packSnorm3x10_1x2(value);
+            const glm::vec4 decoded = glm::unpackSnorm3x10_1x2(packed);
+
+            std::memcpy(target, &packed, sizeof(packed));
+            for (uint component = 0; component < 3; component++)
+                error = std::max(error, std::abs(decoded[component] - value[component]));
+            break;
+        }
+    }
+
+    return error;
+}
+
+} // namespace
+
+namespace Mesh
+{
+
+auto quantize_mesh(MeshData& mesh) -> QuantizeReport
+{
+    PROFILE_ZONE("Mesh::quantize_mesh");
+
+    const auto& elements = mesh.layout.GetElements();
+
+    std::vector<Attribute> attributes;
+    Renderer::GPU::VertexBufferLayout layout;
+    uint offset = 0;
+
+    for (uint i = 0; i < elements.size(); i++)
+    {
+        Attribute attribute = choose_encoding(mesh, elements[i], i, offset);
+        attribute.targetOffset = layout.GetStride();
+        layout.Push(attribute.target);
+
+        attributes.push_back(attribute);
+        offset += elements[i].GetSize();
+    }
+
+    QuantizeReport report{std::vector<float>(attributes.size(), 0.f), mesh.layout.GetStride(), layout.GetStride()};
+
+    const uint sourceStride = mesh.layout.GetStride();
+    const uint targetStride = layout.GetStride();
+    std::vector<uchar> vertices(static_cast<std::size_t>(mesh.vertexCount) * targetStride);
+
+    for (uint vertex = 0; vertex < mesh.vertexCount; vertex++)
+    {
+        const uchar* source = mesh.vertices.data() + static_cast<std::size_t>(vertex) * sourceStride;
+        uchar* target = vertices.data() + static_cast<std::size_t>(vertex) * targetStride;
+
+        for (uint i = 0; i < attributes.size(); i++)
+        {
+            const Attribute& attribute = attributes[i];
+            report.maxError[i] = std::max(report.maxError[i],
+                encode(attribute, source + attribute.sourceOffset, target + attribute.targetOffset));
+        }
+    }
+
+    mesh.layout = layout;
+    mesh.vertices = std::move(vertices);
+
+    return report;
+}
+
+} // namespace Mesh
@@ -0,0 +1,460 @@
+/**
+ * @file Simplify.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of quadric error mesh simplification
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Mesh/Simplify.hpp"
+
+#include <map>
+#include <array>
+#include <queue>
+#include <limits>
+#include <iterator>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+
+using Mesh::IndexedMesh;
+
+// Error of placing a vertex at p is p^T Q p, symmetric 4x4 matrix stored as its upper triangle
+struct Quadric {
+    std::array<double, 10> q{};
+
+    static auto FromPlane(const glm::dvec4& plane, double weight) -> Quadric
+    {
+        const auto [a, b, c, d] = std::array{plane.x, plane.y, plane.z, plane.w};
+
+        return {{
+            a * a * weight, a * b * weight, a * c * weight, a * d * weight,
+                            b * b * weight, b * c * weight, b * d * weight,
+                                            c * c * weight, c * d * weight,
+                                                            d * d * weight
+        }};
+    }
+
+    auto operator+=(const Quadric& other) -> Quadric&
+    {
+        for (uint i = 0; i < q.size(); i++)
+            q[i] += other.q[i];
+
+        return *this;
+    }
+
+    [[nodiscard]] auto error(const glm::dvec3& p) const -> double
+    {
+        const auto [x, y, z] = std::array{p.x, p.y, p.z};
+
+        return
+            q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x +
+            q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y +
+            q[7] * z * z + 2.0 * q[8] * z +
+            q[9];
+    }
+
+    // Point minimizing the error, nothing if the quadric is (close to) singular
+    [[nodiscard]] auto minimum(glm::dvec3& p) const -> bool
+    {
+        const glm::dmat3 a{
+            q[0], q[1], q[2],
+            q[1], q[4], q[5],
+            q[2], q[5], q[7]
+        };
+
+        const double det = glm::determinant(a);
+        if (std::abs(det) < 1e-12)
+            return false;
+
+        p = glm::inverse(a) * glm::dvec3{-q[3], -q[6], -q[8]};
+        return true;
+    }
+}; // struct Quadric
+
+// Constraint planes along open edges keep borders from shrinking
+constexpr double BoundaryWeight = 10.0;
+// Collapse is refused if a triangle normal turns by more than ~78 degrees
+constexpr double MinNormalDot = 0.2;
+
+struct Collapse {
+    double cost;
+    uint a;
+    uint b;
+    uint versionA;
+    uint versionB;
+    glm::dvec3 target;
+
+    auto operator>(const Collapse& other) const -> bool { return cost > other.cost; }
+}; // struct Collapse
+
+class Simplifier
+{
+    public:
+        explicit Simplifier(const IndexedMesh& mesh) :
+            m_mesh{mesh}
+        {
+            weld();
+            computeQuadrics();
+
+            for (uint triangle = 0; triangle < m_triangles.size(); triangle++)
+                for (uint corner = 0; corner < 3; corner++)
+                    pushEdge(node(triangle, corner), node(triangle, (corner + 1) % 3));
+        }
+
+        auto run(uint targetTriangles, double maxError) -> float
+        {
+            double error = 0.0;
+
+            while (m_aliveTriangles > targetTriangles && !m_heap.empty())
+            {
+                const Collapse collapse = m_heap.top();
+                m_heap.pop();
+
+                if (!m_alive[collapse.a] || !m_alive[collapse.b] ||
+                    m_version[collapse.a] != collapse.versionA || m_version[collapse.b] != collapse.versionB)
+                    continue;
+
+                const double cost = std::sqrt(std::max(collapse.cost, 0.0));
+                if (cost > maxError)
+                    break;
+
+                if (!canCollapse(collapse.a, collapse.b, collapse.target))
+                    continue;
+
+                collapseEdge(collapse.a, collapse.b, collapse.target);
+                error = std::max(error, cost);
+            }
+
+            return static_cast<float>(error);
+        }
+
+        [[nodiscard]] auto result() const -> IndexedMesh
+        {
+            IndexedMesh out;
+            std::vector<uint> remap(m_mesh.vertices.size(), ~0u);
+
+            for (uint triangle = 0; triangle < m_triangles.size(); triangle++)
+            {
+                if (!m_triangleAlive[triangle])
+                    continue;
+
+                for (const uint vertex : m_triangles[triangle])
+                {
+                    if (remap[vertex] == ~0u)
+                    {
+                        remap[vertex] = out.vertices.size();
+                        out.vertices.push_back({
+                            glm::vec3{m_position[find(m_vertexNode[vertex])]},
+                            m_mesh.vertices[vertex].texCoord
+                        });
+                    }
+
+                    out.indices.push_back(remap[vertex]);
+                }
+            }
+
+            return out;
+        }
+    private:
+        const IndexedMesh& m_mesh;
+
+        // Vertices (wedges) with the same position share a node, collapses work on nodes
+        std::vector<uint> m_vertexNode{};
+        std::vector<uint> m_parent{};       // collapsed node points to the node it was merged into
+        std::vector<glm::dvec3> m_position{};
+        std::vector<Quadric> m_quadric{};
+        std::vector<std::vector<uint>> m_nodeTriangles{};
+        std::vector<uint> m_version{};
+        std::vector<bool> m_alive{};
+
+        std::vector<std::array<uint, 3>> m_triangles{};
+        std::vector<bool> m_triangleAlive{};
+        uint m_aliveTriangles{};
+
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> m_heap{};
+
+        auto weld() -> void
+        {
+            std::map<std::array<float, 3>, uint> nodes;
+
+            for (const auto& vertex : m_mesh.vertices)
+            {
+                const std::array<float, 3> key{vertex.position.x, vertex.position.y, vertex.position.z};
+                const auto [it, inserted] = nodes.try_emplace(key, m_position.size());
+
+                if (inserted)
+                    m_position.emplace_back(vertex.position);
+
+                m_vertexNode.push_back(it->second);
+            }
+
+            const uint count = m_position.size();
+            m_parent.resize(count);
+            for (uint i = 0; i < count; i++)
+                m_parent[i] = i;
+
+            m_quadric.resize(count);
+            m_nodeTriangles.resize(count);
+            m_version.assign(count, 0);
+            m_alive.assign(count, true);
+
+            for (uint i = 0; i + 3 <= m_mesh.indices.size(); i += 3)
+            {
+                const std::array<uint, 3> triangle{m_mesh.indices[i], m_mesh.indices[i + 1], m_mesh.indices[i + 2]};
+                const uint a = m_vertexNode[triangle[0]];
+                const uint b = m_vertexNode[triangle[1]];
+                const uint c = m_vertexNode[triangle[2]];
+
+                if (a == b || b == c || a == c)
+                    continue;
+
+                for (const uint n : {a, b, c})
+                    m_nodeTriangles[n].push_back(m_triangles.size());
+
+                m_triangles.push_back(triangle);
+            }
+
+            m_triangleAlive.assign(m_triangles.size(), true);
+            m_aliveTriangles = m_triangles.size();
+        }
+
+        auto computeQuadrics() -> void
+        {
+            // Edges used by a single triangle are open, counted in both directions
+            std::map<std::pair<uint, uint>, uint> edgeUse;
+
+            for (uint triangle = 0; triangle < m_triangles.size(); triangle++)
+            {
+                const glm::dvec4 plane = trianglePlane(triangle);
+                const Quadric quadric = Quadric::FromPlane(plane, 1.0);
+
+                for (uint corner = 0; corner < 3; corner++)
+                {
+                    m_quadric[node(triangle, corner)] += quadric;
+
+                    const uint a = node(triangle, corner);
+                    const uint b = node(triangle, (corner + 1) % 3);
+                    edgeUse[{std::min(a, b), std::max(a, b)}]++;
+                }
+            }
+
+            for (uint triangle = 0; triangle < m_triangles.size(); triangle++)
+            {
+                const glm::dvec3 normal{trianglePlane(triangle)};
+
+                for (uint corner = 0; corner < 3; corner++)
+                {
+                    const uint a = node(triangle, corner);
+                    const uint b = node(triangle, (corner + 1) % 3);
+
+                    if (edgeUse[{std::min(a, b), std::max(a, b)}] != 1)
+                        continue;
+
+                    const glm::dvec3 edge = m_position[b] - m_position[a];
+                    const glm::dvec3 side = glm::cross(edge, normal);
+                    const double length = glm::length(side);
+                    if (length < 1e-12)
+                        continue;
+
+                    const glm::dvec3 n = side / length;
+                    const Quadric quadric = Quadric::FromPlane({n, -glm::dot(n, m_position[a])}, BoundaryWeight);
+                    m_quadric[a] += quadric;
+                    m_quadric[b] += quadric;
+                }
+            }
+        }
+
+        [[nodiscard]] auto find(uint n) const -> uint
+        {
+            while (m_parent[n] != n)
+                n = m_parent[n];
+
+            return n;
+        }
+
+        [[nodiscard]] auto node(uint triangle, uint corner) const -> uint
+        {
+            return find(m_vertexNode[m_triangles[triangle][corner]]);
+        }
+
+        [[nodiscard]] auto trianglePlane(uint triangle) const -> glm::dvec4
+        {
+            const glm::dvec3 p0 = m_position[node(triangle, 0)];
+            const glm::dvec3 p1 = m_position[node(triangle, 1)];
+            const glm::dvec3 p2 = m_position[node(triangle, 2)];
+
+            const glm::dvec3 cross = glm::cross(p1 - p0, p2 - p0);
+            const double length = glm::length(cross);
+            const glm::dvec3 normal = length > 0.0 ? cross / length : glm::dvec3{0.0};
+
+            return {normal, -glm::dot(normal, p0)};
+        }
+
+        auto pushEdge(uint a, uint b) -> void
+        {
+            if (a == b)
+                return;
+
+            Quadric quadric = m_quadric[a];
+            quadric += m_quadric[b];
+
+            glm::dvec3 target{};
+            double cost{};
+
+            if (quadric.minimum(target))
+                cost = quadric.error(target);
+            else
+            {
+                // Flat neighborhood, best of both ends and the middle
+                const std::array<glm::dvec3, 3> candidates{m_position[a], m_position[b], (m_position[a] + m_position[b]) * 0.5};
+                cost = std::numeric_limits<double>::max();
+
+                for (const auto& candidate : candidates)
+                {
+                    const double error = quadric.error(candidate);
+                    if (error < cost)
+                    {
+                        cost = error;
+                        target = candidate;
+                    }
+                }
+            }
+
+            m_heap.push({cost, a, b, m_version[a], m_version[b], target});
+        }
+
+        [[nodiscard]] auto canCollapse(uint a, uint b, const glm::dvec3& target) const -> bool
+        {
+            // More than two shared neighbors would pinch the surface into a non-manifold one
+            std::vector<uint> neighborsA = neighbors(a);
+            std::vector<uint> neighborsB = neighbors(b);
+            std::vector<uint> shared;
+            std::set_intersection(neighborsA.begin(), neighborsA.end(), neighborsB.begin(), neighborsB.end(), std::back_inserter(shared));
+
+            if (shared.size() > 2)
+                return false;
+
+            for (const uint n : {a, b})
+            {
+                for (const uint triangle : m_nodeTriangles[n])
+                {
+                    if (!m_triangleAlive[triangle])
+                        continue;
+
+                    std::array<glm::dvec3, 3> corners{};
+                    bool removed = false;
+
+                    for (uint corner = 0; corner < 3; corner++)
+                    {
+                        const uint current = node(triangle, corner);
+                        corners[corner] = m_position[current];
+
+                        if (current == a || current == b)
+                        {
+                            removed |= (current != n);
+                            corners[corner] = target;
+                        }
+                    }
+
+                    // Triangles on the collapsed edge disappear
+                    if (removed)
+                        continue;
+
+                    const glm::dvec3 before = glm::cross(
+                        m_position[node(triangle, 1)] - m_position[node(triangle, 0)],
+                        m_position[node(triangle, 2)] - m_position[node(triangle, 0)]);
+                    const glm::dvec3 after = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+
+                    const double lengths = glm::length(before) * glm::length(after);
+                    if (lengths < 1e-20 || glm::dot(before, after) < MinNormalDot * lengths)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] auto neighbors(uint n) const -> std::vector<uint>
+        {
+            std::vector<uint> result;
+
+            for (const uint triangle : m_nodeTriangles[n])
+            {
+                if (!m_triangleAlive[triangle])
+                    continue;
+
+                for (uint corner = 0; corner < 3; corner++)
+                    if (const uint other = node(triangle, corner); other != n)
+                        result.push_back(other);
+            }
+
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            return result;
+        }
+
+        auto collapseEdge(uint a, uint b, const glm::dvec3& target) -> void
+        {
+            m_parent[b] = a;
+            m_alive[b] = false;
+            m_position[a] = target;
+            m_quadric[a] += m_quadric[b];
+            m_version[a]++;
+
+            std::vector<uint> triangles;
+            for (const uint n : {a, b})
+            {
+                for (const uint triangle : m_nodeTriangles[n])
+                {
+                    if (!m_triangleAlive[triangle])
+                        continue;
+
+                    const uint n0 = node(triangle, 0);
+                    const uint n1 = node(triangle, 1);
+                    const uint n2 = node(triangle, 2);
+
+                    if (n0 == n1 || n1 == n2 || n0 == n2)
+                    {
+                        m_triangleAlive[triangle] = false;
+                        m_aliveTriangles--;
+                    }
+                    else
+                        triangles.push_back(triangle);
+                }
+            }
+
+            std::sort(triangles.begin(), triangles.end());
+            triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+            m_nodeTriangles[a] = std::move(triangles);
+            m_nodeTriangles[b].clear();
+
+            for (const uint neighbor : neighbors(a))
+            {
+                m_version[neighbor]++;
+                // Neighbor's other edges keep their old entries, re-push them with the new version
+                for (const uint other : neighbors(neighbor))
+                    pushEdge(neighbor, other);
+            }
+        }
+}; // class Simplifier
+
+} // namespace
+
+namespace Mesh
+{
+
+auto simplify(const IndexedMesh& mesh, uint targetTriangles, float maxError) -> SimplifyResult
+{
+    Simplifier simplifier(mesh);
+    const float error = simplifier.run(targetTriangles, maxError);
+
+    return {simplifier.result(), error};
+}
+
+} // namespace Mesh
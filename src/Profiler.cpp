@@ -0,0 +1,266 @@
+/**
+ * @file Profiler.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of Profiler class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Profiler.hpp"
+
+#include <glad/gl.h>
+
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+
+constexpr uint GpuThreadId = 0;
+constexpr uint64_t CalibrationInterval = 300;  // frames, GPU and CPU clocks drift apart slowly
+
+} // namespace
+
+Profiler::CpuZone::CpuZone(const char* name) :
+    m_name{name}
+{
+    if (instance().isCapturing())
+        m_start = now();
+}
+
+Profiler::CpuZone::~CpuZone()
+{
+    if (m_start >= 0)
+        instance().record(m_name, m_start, now());
+}
+
+Profiler::GpuZone::GpuZone(const char* name) :
+    m_name{name}
+{
+    if (instance().isCapturing())
+        m_begin = instance().beginGpuZone();
+}
+
+Profiler::GpuZone::~GpuZone()
+{
+    if (m_begin != 0)
+        instance().endGpuZone(m_name, m_begin);
+}
+
+auto Profiler::instance() -> Profiler&
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+auto Profiler::setCapturing(bool capturing) -> void
+{
+    m_capturing.store(capturing, std::memory_order_relaxed);
+}
+
+auto Profiler::setThreadName(std::string name) -> void
+{
+    auto& buffer = threadBuffer();
+
+    std::lock_guard lock{buffer.mutex};
+    buffer.name = std::move(name);
+}
+
+auto Profiler::endFrame() -> void
+{
+    m_frame++;
+
+    if (m_pendingGpu.empty())
+        return;
+
+    if (m_frame - m_calibratedFrame >= CalibrationInterval)
+        calibrate();
+
+    // Zones finish in order, so the first one not ready ends the readback for this frame
+    while (!m_pendingGpu.empty() && m_pendingGpu.front().frame + GpuLatency <= m_frame)
+    {
+        const auto zone = m_pendingGpu.front();
+
+        GLint available{};
+        glGetQueryObjectiv(zone.end, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            break;
+
+        GLuint64 begin{}, end{};
+        glGetQueryObjectui64v(zone.begin, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(zone.end, GL_QUERY_RESULT, &end);
+
+        m_gpuEvents.push_back({
+            zone.name,
+            static_cast<int64_t>(begin) - m_gpuOffset,
+            static_cast<int64_t>(end - begin)
+        });
+
+        m_freeQueries.push_back(zone.begin);
+        m_freeQueries.push_back(zone.end);
+        m_pendingGpu.pop_front();
+    }
+}
+
+auto Profiler::writeTrace(const std::filesystem::path& path) -> bool
+{
+    std::ofstream file(path);
+
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return false;
+    }
+
+    file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    bool first = true;
+    auto writeName = [&](uint tid, const std::string& name) {
+        file << (first ? "\n" : ",\n") << std::format(
+            R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})", tid, name);
+        first = false;
+    };
+
+    auto writeEvents = [&](uint tid, const char* category, const std::vector<Event>& events) {
+        for (const auto& event : events)
+            file << ",\n" << std::format(
+                R"({{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                event.name, category, tid,
+                static_cast<double>(event.start - m_epoch) / 1000.0,
+                static_cast<double>(event.duration) / 1000.0);
+    };
+
+    writeName(GpuThreadId, "GPU");
+    writeEvents(GpuThreadId, "gpu", m_gpuEvents);
+
+    {
+        std::lock_guard lock{m_threadsMutex};
+
+        for (const auto& buffer : m_threads)
+        {
+            std::lock_guard bufferLock{buffer->mutex};
+
+            writeName(buffer->id, buffer->name);
+            writeEvents(buffer->id, "cpu", buffer->events);
+
+            if (buffer->dropped > 0)
+                std::cerr << "Profiler: " << buffer->dropped << " zones dropped on " << buffer->name << std::endl;
+        }
+    }
+
+    file << "\n]}\n";
+
+    return file.good();
+}
+
+auto Profiler::clear() -> void
+{
+    m_gpuEvents.clear();
+
+    std::lock_guard lock{m_threadsMutex};
+
+    for (const auto& buffer : m_threads)
+    {
+        std::lock_guard bufferLock{buffer->mutex};
+
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+}
+
+    /**   PRIVATE   **/
+
+Profiler::Profiler() :
+    m_epoch{now()}
+{}
+
+// Query objects are left to the OpenGL context, it is usually gone by the time this runs
+Profiler::~Profiler() = default;
+
+auto Profiler::now() -> int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+auto Profiler::threadBuffer() -> ThreadBuffer&
+{
+    // Profiler is a singleton, so a plain thread_local pointer identifies the thread's buffer
+    thread_local ThreadBuffer* buffer = nullptr;
+
+    if (buffer == nullptr)
+    {
+        std::lock_guard lock{m_threadsMutex};
+
+        auto& created = m_threads.emplace_back(std::make_unique<ThreadBuffer>());
+        created->id = m_threads.size();
+        created->name = std::format("Thread {}", created->id);
+
+        buffer = created.get();
+    }
+
+    return *buffer;
+}
+
+auto Profiler::record(const char* name, int64_t start, int64_t end) -> void
+{
+    auto& buffer = threadBuffer();
+
+    std::lock_guard lock{buffer.mutex};
+
+    if (buffer.events.size() >= MaxEventsPerThread)
+    {
+        buffer.dropped++;
+        return;
+    }
+
+    buffer.events.push_back({name, start, end - start});
+}
+
+auto Profiler::acquireQuery() -> uint
+{
+    if (m_freeQueries.empty())
+    {
+        uint query{};
+        glGenQueries(1, &query);
+        return query;
+    }
+
+    const uint query = m_freeQueries.back();
+    m_freeQueries.pop_back();
+    return query;
+}
+
+auto Profiler::beginGpuZone() -> uint
+{
+    if (!m_calibrated)
+        calibrate();
+
+    const uint query = acquireQuery();
+    glQueryCounter(query, GL_TIMESTAMP);
+
+    return query;
+}
+
+auto Profiler::endGpuZone(const char* name, uint begin) -> void
+{
+    const uint end = acquireQuery();
+    glQueryCounter(end, GL_TIMESTAMP);
+
+    m_pendingGpu.push_back({name, begin, end, m_frame});
+}
+
+auto Profiler::calibrate() -> void
+{
+    // GL_TIMESTAMP query through glGet doesn't wait for previous commands to execute
+    GLint64 gpuTime{};
+    glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+
+    m_gpuOffset = gpuTime - now();
+    m_calibratedFrame = m_frame;
+    m_calibrated = true;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file BoxInstance.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of box instance packing
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/BoxInstance.hpp"
+
+#include <algorithm>
+
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Renderer
+{
+
+auto pack_instance(const BoxInstance& instance) -> PackedBoxInstance
+{
+    const glm::mat4& model = instance.model;
+
+    glm::mat3 rotation{1.f};
+    float scale = 0.f;
+
+    for (uint column = 0; column < 3; column++)
+    {
+        const glm::vec3 axis{model[column]};
+        const float length = glm::length(axis);
+
+        if (length > 0.f)
+            rotation[column] = axis / length;
+        scale = std::max(scale, length);
+    }
+
+    const glm::quat quaternion = glm::normalize(glm::quat_cast(rotation));
+
+    PackedBoxInstance packed{};
+    packed.positionScale = glm::vec4{glm::vec3{model[3]}, scale};
+    packed.rotation = {
+        static_cast<int16_t>(glm::packSnorm1x16(quaternion.x)),
+        static_cast<int16_t>(glm::packSnorm1x16(quaternion.y)),
+        static_cast<int16_t>(glm::packSnorm1x16(quaternion.z)),
+        static_cast<int16_t>(glm::packSnorm1x16(quaternion.w))
+    };
+    packed.color = glm::packUnorm4x8(instance.color);
+    packed.textures = {static_cast<uint16_t>(instance.textures.x), static_cast<uint16_t>(instance.textures.y)};
+
+    return packed;
+}
+
+auto unpack_model(const PackedBoxInstance& instance) -> glm::mat4
+{
+    const glm::quat quaternion = glm::normalize(glm::quat{
+        glm::unpackSnorm1x16(static_cast<uint16_t>(instance.rotation[3])),
+        glm::unpackSnorm1x16(static_cast<uint16_t>(instance.rotation[0])),
+        glm::unpackSnorm1x16(static_cast<uint16_t>(instance.rotation[1])),
+        glm::unpackSnorm1x16(static_cast<uint16_t>(instance.rotation[2]))
+    });
+
+    glm::mat4 model = glm::mat4_cast(quaternion);
+    for (uint column = 0; column < 3; column++)
+        model[column] *= instance.positionScale.w;
+    model[3] = glm::vec4{glm::vec3{instance.positionScale}, 1.f};
+
+    return model;
+}
+
+} // namespace Renderer
@@ -0,0 +1,1249 @@
+/**
+ * @file BoxRenderer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of BoxRenderer class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Renderer/BoxRenderer.hpp"
+
+#include <cmath>
+#include <string>
+#include <cstring>
+#include <limits>
+#include <cstddef>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+#include <glad/gl.h>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Profiler.hpp"
+#include "Mesh/Quantize.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+
+namespace
+{
+    namespace Shaders {
+        const std::filesystem::path basic_vert = "res/shaders/basic.vert";
+        const std::filesystem::path basic_light_frag = "res/shaders/basic_light.frag";
+        const std::filesystem::path instanced_vert = "res/shaders/instanced.vert";
+        const std::filesystem::path instanced_light_frag = "res/shaders/instanced_light.frag";
+        const std::filesystem::path instanced_light_array_frag = "res/shaders/instanced_light_array.frag";
+        const std::filesystem::path instanced_light_bindless_frag = "res/shaders/instanced_light_bindless.frag";
+        const std::filesystem::path indirect_vert = "res/shaders/indirect.vert";
+        const std::filesystem::path cull_comp = "res/shaders/cull.comp";
+        const std::filesystem::path impostor_vert = "res/shaders/impostor.vert";
+        const std::filesystem::path impostor_frag = "res/shaders/impostor.frag";
+
+        // Indexed by BoxRenderer::Mode
+        const std::array<std::filesystem::path, 3> mode_vert{basic_vert, instanced_vert, indirect_vert};
+    }
+
+    const glm::vec4 LightColor{0.1f, 0.1f, 0.1f, 1.f};
+
+    // Number of boxes handled by a single job
+    constexpr uint BoxesPerJob = 4096;
+
+    constexpr uint NoBox = std::numeric_limits<uint>::max();
+
+    // Refitted BVH is built again once its nodes cover this much more area than after the build
+    constexpr float BvhRebuildDegradation = 1.5f;
+
+    const Scene::AABB UnitBox{glm::vec3{-0.5f}, glm::vec3{0.5f}};
+
+    // Layout of the draw buffer filled by cull.comp
+    struct DrawArraysIndirectCommand {
+        uint count;
+        uint instanceCount;
+        uint first;
+        uint baseInstance;
+    };
+
+    struct DrawHeader {
+        uint drawCount;
+        uint visibleCount;
+        std::array<uint, 2> padding;    // commands start 16 bytes in, as std430 aligns the struct array
+    };
+
+    // Has to match local_size_x in cull.comp
+    constexpr uint CullGroupSize = 256;
+
+    constexpr std::array<Renderer::GPU::UniformId, Renderer::Frustum::COUNT> PlaneUniforms{
+        "uPlanes[0]", "uPlanes[1]", "uPlanes[2]", "uPlanes[3]", "uPlanes[4]", "uPlanes[5]"
+    };
+
+    // Triangle strip covering the billboard, corners in [-1, 1]
+    constexpr std::array<float, 8> ImpostorQuad{-1.f, -1.f, 1.f, -1.f, -1.f, 1.f, 1.f, 1.f};
+
+    // Views are baked from slightly above, boxes are mostly seen from around eye level or higher
+    constexpr float ImpostorElevation = 0.35f;  // rad
+    constexpr uint ImpostorTextureSlot = 2;
+
+    constexpr uint TextureArraySlot = 3;
+
+    // Compute shaders, SSBOs and multi-draw indirect are 4.3, DSA used by StorageBuffer is 4.5
+    auto indirect_supported() -> bool
+    {
+        return GLAD_GL_VERSION_4_5 != 0;
+    }
+}   // namespace
+
+namespace Renderer
+{
+
+BoxRenderer::BoxRenderer(const GPU::VertexBuffer& mesh, const GPU::VertexBufferLayout& layout, uint vertexCount, JobSystem& jobs) :
+    m_mesh{mesh},
+    m_layout{layout},
+    m_vertexCount{vertexCount},
+    m_jobs{jobs},
+    m_shader{Shaders::basic_vert, Shaders::basic_light_frag},
+    m_instancedShader{Shaders::instanced_vert, Shaders::instanced_light_frag},
+    m_queue{jobs},
+    m_impostorShader{Shaders::impostor_vert, Shaders::impostor_frag},
+    m_impostorQuad{ImpostorQuad.data(), ImpostorQuad.size() * sizeof(float)},
+    m_impostorBlocks{nullptr, 0}
+{
+    m_va.AddBuffer(m_mesh, m_layout);
+
+    // Matches PackedBoxInstance
+    m_instanceLayout.Push<float>(4);      // position and scale
+    m_instanceLayout.Push<short>(4);      // rotation
+    m_instanceLayout.Push<u_char>(4);     // color
+    m_instanceLayout.Push<u_short>(2);    // textures
+    m_instanceLayout.SetDivisor(1);
+
+    // Submitted with the rest, the driver compiles them in the background until the first Indirect draw
+    if (indirect_supported())
+    {
+        m_cullShader = std::make_unique<GPU::Shader>(Shaders::cull_comp);
+        m_indirectShader = std::make_unique<GPU::Shader>(Shaders::indirect_vert, Shaders::instanced_light_frag);
+    }
+}
+
+BoxRenderer::~BoxRenderer()
+{
+    for (auto& readback : m_readbacks)
+        if (readback.fence != nullptr)
+            glDeleteSync(readback.fence);
+
+    if (m_impostorAtlas != 0)
+    {
+        auto& cache = GPU::StateCache::Get();
+        cache.ForgetFramebuffer(m_impostorFramebuffer);
+        cache.ForgetTexture(m_impostorAtlas);
+
+        glDeleteFramebuffers(1, &m_impostorFramebuffer);
+        glDeleteRenderbuffers(1, &m_impostorDepth);
+        glDeleteTextures(1, &m_impostorAtlas);
+    }
+}
+
+auto BoxRenderer::setBoxes(
+    const std::vector<Scene::Box>& boxes,
+    const Scene::TransformHierarchy& hierarchy,
+    const std::vector<Scene::TransformHierarchy::Node>& nodes
+) -> void
+{
+    m_hierarchy = &hierarchy;
+    m_hierarchySerial = hierarchy.getSerial();
+
+    m_nodeToBox.assign(hierarchy.size(), NoBox);
+    for (uint i = 0; i < nodes.size(); i++)
+        m_nodeToBox[nodes[i]] = i;
+
+    m_spheres = make_bounding_spheres(boxes);
+    m_bounds.resize(boxes.size());
+    m_instances.resize(boxes.size());
+    m_packedInstances.resize(boxes.size());
+    m_boxLevel.assign(boxes.size(), 0);
+    m_highlighted.reset();
+
+    m_jobs.parallel_for(0, boxes.size(), BoxesPerJob, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+        {
+            m_instances[i].color = glm::vec4{boxes[i].color, 1.f};
+            m_instances[i].textures = glm::uvec4{boxes[i].textures[0], boxes[i].textures[1], 0, 0};
+            updateBox(i, hierarchy.getWorld(nodes[i]));
+        }
+    });
+
+    m_bvh.build(m_bounds);
+
+    // Sizes depend on the box count, buffers are recreated by the next Indirect draw
+    m_instanceStorage.reset();
+    m_indirectDirty = true;
+
+    // Attribute setup is stored in VAO, so it's recreated along with the instance buffer.
+    // A frame's region of the stream holds every box, visible ones are gathered into it once per frame
+    if (GPU::StreamBuffer::IsSupported())
+    {
+        m_instanceStream = std::make_unique<GPU::StreamBuffer>(m_packedInstances.size() * sizeof(PackedBoxInstance));
+        m_instanceBuffer.reset();
+    }
+    else
+    {
+        m_instanceBuffer = std::make_unique<GPU::VertexBuffer>(
+            m_packedInstances.data(), m_packedInstances.size() * sizeof(PackedBoxInstance));
+        m_instanceBufferGathered = false;
+    }
+
+    m_instancedVa = std::make_unique<GPU::VertexArray>();
+    m_instancedVa->AddBuffer(m_mesh, m_layout);
+    addInstanceBuffer(*m_instancedVa);
+
+    createLodArrays();
+}
+
+auto BoxRenderer::setLods(const Mesh::LodChain& chain) -> void
+{
+    if (chain.levels.empty() || chain.levels.size() > std::numeric_limits<uchar>::max())
+    {
+        std::cerr << "LOD chain with " << chain.levels.size() << " levels can't be drawn" << std::endl;
+        return;
+    }
+
+    m_lodLevels = chain.levels;
+    m_lodRadius = chain.radius;
+    m_boxLevel.assign(m_instances.size(), 0);
+    m_impostorsDirty = true;
+    m_lod = true;
+
+    // Positions as half floats and texture coordinates as 16 bit unorm, 12 bytes instead of 20 per vertex
+    Mesh::MeshData vertices = Mesh::to_mesh_data(Mesh::IndexedMesh{chain.vertices, {}});
+    Mesh::quantize_mesh(vertices);
+
+    m_lodLayout = vertices.layout;
+    m_lodVertices = std::make_unique<GPU::VertexBuffer>(vertices.vertices.data(), vertices.vertices.size());
+
+    // Index buffer binding is stored in the VAO bound while it's created
+    m_lodVa = std::make_unique<GPU::VertexArray>();
+    m_lodVa->Bind();
+    m_lodIndices = std::make_unique<GPU::IndexBuffer>(chain.indices.data(), chain.indices.size());
+    m_lodVa->Unbind();
+
+    m_lodVa->AddBuffer(*m_lodVertices, m_lodLayout);
+
+    createLodArrays();
+}
+
+auto BoxRenderer::setTextureArray(const GPU::TextureArray* textures) -> void
+{
+    m_textureArray = textures;
+
+    if (textures != nullptr && textures->GetId() != 0)
+        submitShaders(Texturing::Array);
+}
+
+auto BoxRenderer::setBindlessTextures(const GPU::BindlessTextures* textures) -> void
+{
+    m_bindlessTextures = textures;
+
+    if (textures != nullptr && textures->IsValid())
+        submitShaders(Texturing::Bindless);
+}
+
+auto BoxRenderer::draw(Mode mode, const Camera& camera, float mix) -> void
+{
+    PROFILE_ZONE("BoxRenderer::draw");
+    PROFILE_GPU_ZONE("BoxRenderer::draw");
+
+    m_drawCalls = 0;
+
+    if (mode == Mode::Indirect && !indirect_supported())
+    {
+        static bool warned = false;
+        if (!warned)
+            std::cerr << "Indirect mode needs OpenGL 4.5, drawing instanced instead" << std::endl;
+        warned = true;
+
+        mode = Mode::Instanced;
+    }
+
+    m_lastMode = mode;
+
+    const Texturing texturing = resolveTexturing();
+    if (texturing != m_texturing)
+    {
+        static bool warned = false;
+        if (!warned)
+            std::cerr << "Texturing " << to_string(m_texturing) << " has no texture set or support, using " << to_string(texturing) << std::endl;
+        warned = true;
+    }
+
+    if (texturing != m_activeTexturing)
+    {
+        m_activeTexturing = texturing;
+        m_impostorsDirty = true;
+    }
+
+    if (m_instances.empty())
+        return;
+
+    syncTransforms();
+
+    // Every program reads camera, mix and light from the same blocks, uploaded here once
+    m_frameUniforms.update(camera, {.mix = mix}, {.color = LightColor});
+
+    if (mode == Mode::Indirect)
+    {
+        prepareIndirect();
+        cullIndirect(camera);
+        bindShader(Mode::Indirect);
+        drawIndirect();
+        readbackIndirectCount();
+        updateLodStats(mode);
+        return;
+    }
+
+    updateVisibility(camera);
+
+    if (m_sorting)
+        sortVisible(mode, camera);
+
+    if (lodActive(mode))
+    {
+        selectLods(camera);
+
+        if (m_impostorsDirty)
+            bakeImpostors();
+    }
+
+    updateLodStats(mode);
+
+    if (m_instanceStream)
+        m_instanceStream->BeginFrame();
+
+    switch (mode)
+    {
+        case Mode::PerBox:
+            bindShader(Mode::PerBox);
+            drawPerBox();
+            break;
+        case Mode::Instanced:
+            bindShader(Mode::Instanced);
+            drawInstanced();
+            break;
+        case Mode::Indirect:
+            break;
+    }
+
+    if (m_instanceStream)
+        m_instanceStream->EndFrame();
+}
+
+auto BoxRenderer::readIndirectVisible() const -> std::vector<uint>
+{
+    if (!m_drawStorage)
+        return {};
+
+    const uint groups = getIndirectGroupCount();
+
+    DrawHeader header{};
+    std::vector<DrawArraysIndirectCommand> commands(groups);
+    m_drawStorage->GetSubData(0, &header, sizeof(DrawHeader));
+    m_drawStorage->GetSubData(sizeof(DrawHeader), commands.data(), groups * sizeof(DrawArraysIndirectCommand));
+
+    std::vector<uint> visible;
+    visible.reserve(header.visibleCount);
+
+    // Only commands below draw count are submitted, the rest have to be empty anyway
+    for (uint group = 0; group < std::min(header.drawCount, groups); group++)
+    {
+        const auto& command = commands[group];
+        const uint first = visible.size();
+
+        visible.resize(first + command.instanceCount);
+        m_visibleStorage->GetSubData(
+            command.baseInstance * sizeof(uint), visible.data() + first, command.instanceCount * sizeof(uint));
+    }
+
+    std::sort(visible.begin(), visible.end());
+    return visible;
+}
+
+auto BoxRenderer::to_string(Mode mode) -> std::string_view
+{
+    switch (mode)
+    {
+        case Mode::PerBox: return "perbox";
+        case Mode::Instanced: return "instanced";
+        case Mode::Indirect: return "indirect";
+    }
+
+    return "unknown";
+}
+
+auto BoxRenderer::to_string(Culling culling) -> std::string_view
+{
+    switch (culling)
+    {
+        case Culling::None: return "none";
+        case Culling::Simd: return "simd";
+        case Culling::BVH: return "bvh";
+    }
+
+    return "unknown";
+}
+
+auto BoxRenderer::to_string(Texturing texturing) -> std::string_view
+{
+    switch (texturing)
+    {
+        case Texturing::Slots: return "slots";
+        case Texturing::Array: return "array";
+        case Texturing::Bindless: return "bindless";
+    }
+
+    return "unknown";
+}
+
+    /**   PRIVATE   **/
+
+auto BoxRenderer::syncTransforms() -> void
+{
+    if (m_hierarchy == nullptr || m_hierarchy->getSerial() == m_hierarchySerial)
+        return;
+
+    PROFILE_ZONE("BoxRenderer::syncTransforms");
+
+    bool changed = false;
+
+    if (m_hierarchy->getSerial() - m_hierarchySerial == 1)
+    {
+        // Only nodes recomputed by the last update are touched
+        for (const auto node : m_hierarchy->getUpdated())
+        {
+            const uint box = node < m_nodeToBox.size() ? m_nodeToBox[node] : NoBox;
+            if (box == NoBox)
+                continue;
+
+            updateBox(box, m_hierarchy->getWorld(node));
+            changed = true;
+        }
+    }
+    else
+    {
+        // More than one update since the last draw, the list only has nodes of the last one
+        const uint nodes = std::min<uint>(m_nodeToBox.size(), m_hierarchy->size());
+
+        m_jobs.parallel_for(0, nodes, BoxesPerJob, [&](uint begin, uint end) {
+            for (uint node = begin; node < end; node++)
+                if (m_nodeToBox[node] != NoBox)
+                    updateBox(m_nodeToBox[node], m_hierarchy->getWorld(node));
+        });
+
+        changed = !m_instances.empty();
+    }
+
+    m_hierarchySerial = m_hierarchy->getSerial();
+
+    if (changed)
+    {
+        m_bvh.refit(m_bounds);
+        if (m_bvh.getDegradation() > BvhRebuildDegradation)
+            m_bvh.build(m_bounds);
+
+        uploadInstances();
+        m_indirectDirty = true;
+    }
+}
+
+auto BoxRenderer::updateBox(uint box, const glm::mat4& world) -> void
+{
+    m_instances[box].model = world;
+    m_packedInstances[box] = pack_instance(m_instances[box]);
+
+    const float scale = std::max({
+        glm::length(glm::vec3{world[0]}),
+        glm::length(glm::vec3{world[1]}),
+        glm::length(glm::vec3{world[2]})
+    });
+
+    m_spheres.x[box] = world[3].x;
+    m_spheres.y[box] = world[3].y;
+    m_spheres.z[box] = world[3].z;
+    m_spheres.radius[box] = Scene::UnitBoxRadius * scale;
+
+    m_bounds[box] = UnitBox.transformed(world);
+}
+
+auto BoxRenderer::pick(const Scene::Ray& ray) const -> std::optional<uint>
+{
+    // Exact test in box space, where the box is the unit cube
+    const auto testBox = [this](uint box, const Scene::Ray& ray) -> std::optional<float> {
+        const glm::mat4 inverse = glm::inverse(m_instances[box].model);
+        const Scene::Ray local{
+            glm::vec3{inverse * glm::vec4{ray.origin, 1.f}},
+            glm::vec3{inverse * glm::vec4{ray.direction, 0.f}}
+        };
+
+        // Entry distance is the same in both spaces, since direction is transformed without normalizing
+        float distance = 0.f;
+        if (!Scene::intersect(local, 1.f / local.direction, UnitBox, distance, std::numeric_limits<float>::max()))
+            return std::nullopt;
+
+        if (distance <= 0.f)
+            return std::nullopt;
+
+        return distance;
+    };
+
+    const auto hit = m_bvh.raycast(ray, std::numeric_limits<float>::max(), testBox);
+    if (!hit)
+        return std::nullopt;
+
+    return hit->object;
+}
+
+auto BoxRenderer::highlight(std::optional<uint> box) -> void
+{
+    if (m_highlighted == box)
+        return;
+
+    if (m_highlighted)
+    {
+        m_instances[*m_highlighted].color = m_highlightedColor;
+        m_packedInstances[*m_highlighted] = pack_instance(m_instances[*m_highlighted]);
+    }
+
+    m_highlighted = box;
+
+    if (m_highlighted)
+    {
+        m_highlightedColor = m_instances[*m_highlighted].color;
+        m_instances[*m_highlighted].color = glm::vec4{1.f};
+        m_packedInstances[*m_highlighted] = pack_instance(m_instances[*m_highlighted]);
+    }
+
+    uploadInstances();
+    m_indirectDirty = true;
+}
+
+auto BoxRenderer::updateVisibility(const Camera& camera) -> void
+{
+    PROFILE_ZONE("BoxRenderer::updateVisibility");
+
+    if (m_culling == Culling::None)
+    {
+        m_visible.resize(m_instances.size());
+        for (uint i = 0; i < m_instances.size(); i++)
+            m_visible[i] = i;
+
+        return;
+    }
+
+    const Frustum frustum = Frustum::FromCamera(camera);
+
+    if (m_culling == Culling::Simd)
+        cull_spheres(m_jobs, frustum, m_spheres, m_visible);
+    else
+    {
+        m_visible.clear();
+        m_bvh.queryFrustum(frustum, m_visible);
+    }
+}
+
+auto BoxRenderer::sortVisible(Mode mode, const Camera& camera) -> void
+{
+    PROFILE_ZONE("BoxRenderer::sortVisible");
+
+    // Both paths use a single program, vertex array and texture set, so for now only pass and depth differ
+    const uint program = static_cast<uint>(mode);
+    const glm::vec3 eye = camera.getPosition();
+
+    m_queue.clear();
+    const auto packets = m_queue.allocate(m_visible.size());
+
+    m_jobs.parallel_for(0, m_visible.size(), BoxesPerJob, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+        {
+            const uint box = m_visible[i];
+            const glm::vec3 center{m_spheres.x[box], m_spheres.y[box], m_spheres.z[box]};
+
+            const auto pass = m_instances[box].color.a < 1.f ?
+                RenderQueue::Pass::Transparent :
+                RenderQueue::Pass::Opaque;
+
+            packets[i] = {
+                RenderQueue::make_key(pass, program, 0, program, glm::length(center - eye)),
+                box
+            };
+        }
+    });
+
+    m_queue.sort();
+
+    const auto& sorted = m_queue.getPackets();
+    m_jobs.parallel_for(0, sorted.size(), BoxesPerJob, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+            m_visible[i] = sorted[i].payload;
+    });
+}
+
+auto BoxRenderer::selectLods(const Camera& camera) -> void
+{
+    PROFILE_ZONE("BoxRenderer::selectLods");
+
+    const uint levels = m_lodLevels.size();
+    const uint impostor = levels;
+    const glm::vec3 eye = camera.getPosition();
+
+    // Pixels covered by a unit at unit distance, divided by distance per box
+    const float pixelsPerUnit = static_cast<float>(m_lodSelection.viewportHeight) * 0.5f /
+        std::tan(glm::radians(camera.getFov()) * 0.5f);
+
+    // Impostor is wrong by the angle to the nearest baked view and by its texel size
+    const float impostorError = m_lodRadius * std::max(
+        1.f - std::cos(glm::pi<float>() / ImpostorViews),
+        2.f / ImpostorTileSize
+    );
+
+    const float threshold = m_lodSelection.errorPixels;
+    const float coarser = 1.f - m_lodSelection.hysteresis;
+
+    m_visibleLevel.resize(m_visible.size());
+    m_visibleError.resize(m_visible.size());
+
+    m_jobs.parallel_for(0, m_visible.size(), BoxesPerJob, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+        {
+            const uint box = m_visible[i];
+            const glm::vec3 center{m_spheres.x[box], m_spheres.y[box], m_spheres.z[box]};
+
+            // Mesh units to pixels, boxes the camera is inside of get the full mesh
+            const float scale = m_spheres.radius[box] / Scene::UnitBoxRadius;
+            const float distance = glm::length(center - eye);
+            const float pixels = distance > m_spheres.radius[box] ?
+                scale * pixelsPerUnit / distance :
+                std::numeric_limits<float>::max();
+
+            const auto error = [&](uint level) {
+                return (level == impostor ? impostorError : m_lodLevels[level].error) * pixels;
+            };
+            const float diameter = 2.f * m_lodRadius * pixels;
+
+            uint level = std::min<uint>(m_lod ? m_boxLevel[box] : 0, impostor);
+
+            if (m_lod)
+            {
+                // Finer levels are taken as soon as needed, coarser ones only with some margin, so boxes
+                // around the threshold don't switch back and forth every frame
+                while (level > 0 && (level == impostor ? diameter >= m_lodSelection.impostorPixels : error(level) > threshold))
+                    level--;
+
+                while (level < impostor)
+                {
+                    const bool next = level + 1 == impostor ?
+                        diameter < m_lodSelection.impostorPixels * coarser :
+                        error(level + 1) < threshold * coarser;
+
+                    if (!next)
+                        break;
+
+                    level++;
+                }
+            }
+
+            m_boxLevel[box] = level;
+            m_visibleLevel[i] = level;
+            m_visibleError[i] = pixels < std::numeric_limits<float>::max() ? error(level) : 0.f;
+        }
+    });
+
+    // Stable counting sort by level, order given by sorting is kept within every level
+    m_levelOffsets.assign(levels + 2, 0);
+    for (const uchar level : m_visibleLevel)
+        m_levelOffsets[level + 1]++;
+    for (uint level = 0; level <= levels; level++)
+        m_levelOffsets[level + 1] += m_levelOffsets[level];
+
+    m_lodScratch.resize(m_visible.size());
+    std::vector<uint> next{m_levelOffsets.begin(), m_levelOffsets.end() - 1};
+    for (uint i = 0; i < m_visible.size(); i++)
+        m_lodScratch[next[m_visibleLevel[i]]++] = m_visible[i];
+
+    m_visible.swap(m_lodScratch);
+}
+
+auto BoxRenderer::updateLodStats(Mode mode) -> void
+{
+    m_lodStats.boxes.clear();
+    m_lodStats.meanErrorPixels = 0.f;
+    m_lodStats.maxErrorPixels = 0.f;
+
+    if (!lodActive(mode))
+    {
+        const uint visible = getVisibleCount();
+        m_lodStats.boxes.push_back(visible);
+        m_lodStats.triangles = static_cast<uint64_t>(visible) * (m_vertexCount / 3);
+        return;
+    }
+
+    m_lodStats.triangles = 0;
+    for (uint level = 0; level <= m_lodLevels.size(); level++)
+    {
+        const uint count = m_levelOffsets[level + 1] - m_levelOffsets[level];
+        const uint triangles = level < m_lodLevels.size() ? m_lodLevels[level].indexCount / 3 : 2;
+
+        m_lodStats.boxes.push_back(count);
+        m_lodStats.triangles += static_cast<uint64_t>(count) * triangles;
+    }
+
+    double sum = 0.0;
+    for (const float error : m_visibleError)
+    {
+        sum += error;
+        m_lodStats.maxErrorPixels = std::max(m_lodStats.maxErrorPixels, error);
+    }
+
+    if (!m_visibleError.empty())
+        m_lodStats.meanErrorPixels = static_cast<float>(sum / m_visibleError.size());
+}
+
+auto BoxRenderer::createLodArrays() -> void
+{
+    if (!m_lodVa || (!m_instanceStream && !m_instanceBuffer))
+        return;
+
+    m_lodInstancedVa = std::make_unique<GPU::VertexArray>();
+    m_lodInstancedVa->AddBuffer(*m_lodVertices, m_lodLayout);
+    addInstanceBuffer(*m_lodInstancedVa);
+    m_lodInstancedVa->Bind();
+    m_lodIndices->Bind();
+    m_lodInstancedVa->Unbind();
+
+    GPU::VertexBufferLayout corner;
+    corner.Push<float>(2);
+
+    m_impostorVa = std::make_unique<GPU::VertexArray>();
+    m_impostorVa->AddBuffer(m_impostorQuad, corner);
+    addInstanceBuffer(*m_impostorVa);
+}
+
+auto BoxRenderer::addInstanceBuffer(GPU::VertexArray& va) const -> void
+{
+    if (m_instanceStream)
+        va.AddBuffer(*m_instanceStream, m_instanceLayout);
+    else
+        va.AddBuffer(*m_instanceBuffer, m_instanceLayout);
+}
+
+auto BoxRenderer::bakeImpostors() -> void
+{
+    PROFILE_ZONE("BoxRenderer::bakeImpostors");
+
+    auto& cache = GPU::StateCache::Get();
+    constexpr uint Width = ImpostorViews * ImpostorTileSize;
+    constexpr uint Height = 2 * ImpostorTileSize;   // row 0 with image 0, row 1 with image 1
+
+    // Caller's target, viewport and clear color are restored afterwards
+    std::array<int, 4> viewport{};
+    std::array<float, 4> clearColor{};
+    int framebuffer{};
+    glGetIntegerv(GL_VIEWPORT, viewport.data());
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor.data());
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    const bool depthTest = glIsEnabled(GL_DEPTH_TEST) == GL_TRUE;
+
+    if (m_impostorAtlas == 0)
+    {
+        glGenTextures(1, &m_impostorAtlas);
+        cache.BindTexture(ImpostorTextureSlot, GL_TEXTURE_2D, m_impostorAtlas);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, Width, Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        glGenRenderbuffers(1, &m_impostorDepth);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_impostorDepth);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, Width, Height);
+
+        glGenFramebuffers(1, &m_impostorFramebuffer);
+        cache.BindFramebuffer(m_impostorFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_impostorAtlas, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_impostorDepth);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cerr << "Impostor framebuffer is incomplete" << std::endl;
+    }
+
+    cache.BindFramebuffer(m_impostorFramebuffer);
+    cache.Enable(GL_DEPTH_TEST);
+    glViewport(0, 0, Width, Height);
+    glClearColor(0.f, 0.f, 0.f, 0.f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Same lighting and textures as the mesh, white so instance color can be applied when drawing
+    // Light comes from this frame's block, mix from the row's
+    GPU::Shader& shader = bindShader(Mode::PerBox);
+    if (m_activeTexturing != Texturing::Slots)
+        shader.SetUniform("uBoxTextures", 0u, 1u);
+    shader.SetUniform("uColor", 1.f, 1.f, 1.f, 1.f);
+    shader.SetUniformM("uModel", glm::mat4{1.f});
+
+    // Cameras of all views and mix of both rows are uploaded at once, each view and row binds its range
+    const float radius = m_lodRadius;
+    const glm::mat4 projection = glm::ortho(-radius, radius, -radius, radius, 0.f, 4.f * radius);
+    const uint alignment = GPU::UniformBuffer::GetOffsetAlignment();
+    const uint cameraStride = (sizeof(GPU::CameraBlock) + alignment - 1) / alignment * alignment;
+    const uint frameStride = (sizeof(GPU::FrameBlock) + alignment - 1) / alignment * alignment;
+    const uint frameOffset = ImpostorViews * cameraStride;
+    std::vector<uchar> blocks(frameOffset + 2 * frameStride);
+
+    for (uint view = 0; view < ImpostorViews; view++)
+    {
+        // Matches view selection in impostor.vert, view 0 looks from +X, angles grow towards +Z
+        const float angle = 2.f * glm::pi<float>() * static_cast<float>(view) / ImpostorViews;
+        const glm::vec3 direction{
+            std::cos(ImpostorElevation) * std::cos(angle),
+            std::sin(ImpostorElevation),
+            std::cos(ImpostorElevation) * std::sin(angle)
+        };
+
+        const GPU::CameraBlock block = FrameUniforms::to_block(
+            glm::lookAt(direction * 2.f * radius, glm::vec3{0.f}, glm::vec3{0.f, 1.f, 0.f}), projection);
+        std::memcpy(blocks.data() + view * cameraStride, &block, sizeof(block));
+    }
+
+    for (uint row = 0; row < 2; row++)
+    {
+        const GPU::FrameBlock block{.mix = static_cast<float>(row)};
+        std::memcpy(blocks.data() + frameOffset + row * frameStride, &block, sizeof(block));
+    }
+
+    m_impostorBlocks.SetData(blocks.data(), blocks.size());
+
+    const auto& range = m_lodLevels.front();
+    const void* indices = reinterpret_cast<const void*>(range.firstIndex * sizeof(uint));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    m_lodVa->Bind();
+
+    for (uint row = 0; row < 2; row++)
+    {
+        m_impostorBlocks.BindRange(GPU::UniformBinding::Frame, frameOffset + row * frameStride, sizeof(GPU::FrameBlock));
+
+        for (uint view = 0; view < ImpostorViews; view++)
+        {
+            m_impostorBlocks.BindRange(GPU::UniformBinding::Camera, view * cameraStride, sizeof(GPU::CameraBlock));
+
+            glViewport(view * ImpostorTileSize, row * ImpostorTileSize, ImpostorTileSize, ImpostorTileSize);
+            glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT, indices, range.baseVertex);
+        }
+    }
+
+    cache.BindTexture(ImpostorTextureSlot, GL_TEXTURE_2D, m_impostorAtlas);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    cache.BindFramebuffer(framebuffer);
+    cache.SetCapability(GL_DEPTH_TEST, depthTest);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    m_frameUniforms.bind();
+
+    m_impostorShader.Bind();
+    m_impostorShader.SetUniform("uImpostor", static_cast<int>(ImpostorTextureSlot));
+    m_impostorShader.SetUniform("uRadius", m_lodRadius);
+    m_impostorShader.SetUniform("uViews", ImpostorViews);
+
+    m_impostorsDirty = false;
+}
+
+auto BoxRenderer::drawImpostors(uint baseInstance, uint count) -> void
+{
+    PROFILE_ZONE("BoxRenderer::drawImpostors");
+
+    GPU::StateCache::Get().BindTexture(ImpostorTextureSlot, GL_TEXTURE_2D, m_impostorAtlas);
+
+    m_impostorShader.Bind();
+    m_impostorVa->Bind();
+    glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, ImpostorQuad.size() / 2, count, baseInstance);
+    m_drawCalls++;
+}
+
+auto BoxRenderer::lodActive(Mode mode) const -> bool
+{
+    return !m_lodLevels.empty() && mode != Mode::Indirect && m_lodVa && m_impostorVa;
+}
+
+auto BoxRenderer::uploadInstances() -> void
+{
+    // Gathered and streamed instances are uploaded every frame anyway
+    if (!m_instanceBufferGathered && m_instanceBuffer)
+        m_instanceBuffer->SetData(m_packedInstances.data(), m_packedInstances.size() * sizeof(PackedBoxInstance));
+}
+
+auto BoxRenderer::drawPerBox() -> void
+{
+    PROFILE_ZONE("BoxRenderer::drawPerBox");
+
+    GPU::Shader& shader = getShader(Mode::PerBox);
+
+    // Resolved once per frame, setting them for every box is then a compare and at most one upload each
+    const auto model = shader.GetUniform<glm::mat4>("uModel");
+    const auto color = shader.GetUniform<glm::vec4>("uColor");
+    const auto textures = m_activeTexturing != Texturing::Slots ? shader.GetUniform<glm::uvec2>("uBoxTextures") : GPU::Uniform<glm::uvec2>{};
+
+    const auto setBoxUniforms = [&](uint index) {
+        const auto& instance = m_instances[index];
+
+        shader.Set(model, instance.model);
+        shader.Set(color, instance.color);
+        shader.Set(textures, glm::uvec2{instance.textures.x, instance.textures.y});
+    };
+
+    if (!lodActive(Mode::PerBox))
+    {
+        m_va.Bind();
+
+        for (const uint index : m_visible)
+        {
+            setBoxUniforms(index);
+
+            glDrawArrays(GL_TRIANGLES, 0, m_vertexCount);
+            m_drawCalls++;
+        }
+
+        return;
+    }
+
+    m_lodVa->Bind();
+
+    for (uint level = 0; level < m_lodLevels.size(); level++)
+    {
+        const auto& range = m_lodLevels[level];
+        const void* indices = reinterpret_cast<const void*>(range.firstIndex * sizeof(uint));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+
+        for (uint i = m_levelOffsets[level]; i < m_levelOffsets[level + 1]; i++)
+        {
+            setBoxUniforms(m_visible[i]);
+
+            glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT, indices, range.baseVertex);
+            m_drawCalls++;
+        }
+    }
+
+    // Impostors are instanced even here, a draw call per distant box would defeat their purpose
+    const uint first = m_levelOffsets[m_lodLevels.size()];
+    const uint count = m_visible.size() - first;
+    if (count == 0)
+        return;
+
+    if (m_instanceStream)
+    {
+        if (const auto base = streamInstances(first, count))
+            drawImpostors(*base, count);
+
+        return;
+    }
+
+    m_visibleInstances.resize(count);
+    for (uint i = 0; i < count; i++)
+        m_visibleInstances[i] = m_packedInstances[m_visible[first + i]];
+
+    m_instanceBuffer->SetData(m_visibleInstances.data(), count * sizeof(PackedBoxInstance));
+    m_instanceBufferGathered = true;
+
+    drawImpostors(0, count);
+}
+
+auto BoxRenderer::drawInstanced() -> void
+{
+    PROFILE_ZONE("BoxRenderer::drawInstanced");
+
+    const bool lod = lodActive(Mode::Instanced);
+    uint base = 0;
+
+    // Streamed instances are always gathered, a frame's region holds nothing from earlier frames
+    if (m_instanceStream)
+    {
+        const auto first = streamInstances(0, m_visible.size());
+        if (!first)
+            return;
+
+        base = *first;
+    }
+    else if (m_culling != Culling::None || m_sorting || lod)
+    {
+        m_visibleInstances.resize(m_visible.size());
+        m_jobs.parallel_for(0, m_visible.size(), BoxesPerJob, [this](uint begin, uint end) {
+            for (uint i = begin; i < end; i++)
+                m_visibleInstances[i] = m_packedInstances[m_visible[i]];
+        });
+
+        m_instanceBuffer->SetData(m_visibleInstances.data(), m_visibleInstances.size() * sizeof(PackedBoxInstance));
+        m_instanceBufferGathered = true;
+    }
+    else if (m_instanceBufferGathered)
+    {
+        m_instanceBuffer->SetData(m_packedInstances.data(), m_packedInstances.size() * sizeof(PackedBoxInstance));
+        m_instanceBufferGathered = false;
+    }
+
+    if (m_visible.empty())
+        return;
+
+    if (!lod)
+    {
+        m_instancedVa->Bind();
+        glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, m_vertexCount, m_visible.size(), base);
+        m_drawCalls++;
+        return;
+    }
+
+    // Visible boxes are grouped by level, so every level is one draw starting at its first instance
+    m_lodInstancedVa->Bind();
+
+    for (uint level = 0; level < m_lodLevels.size(); level++)
+    {
+        const uint count = m_levelOffsets[level + 1] - m_levelOffsets[level];
+        if (count == 0)
+            continue;
+
+        const auto& range = m_lodLevels[level];
+        const void* indices = reinterpret_cast<const void*>(range.firstIndex * sizeof(uint));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+
+        glDrawElementsInstancedBaseVertexBaseInstance(
+            GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT, indices, count, range.baseVertex, base + m_levelOffsets[level]);
+        m_drawCalls++;
+    }
+
+    const uint first = m_levelOffsets[m_lodLevels.size()];
+    if (first < m_visible.size())
+        drawImpostors(base + first, m_visible.size() - first);
+}
+
+auto BoxRenderer::streamInstances(uint first, uint count) -> std::optional<uint>
+{
+    PROFILE_ZONE("BoxRenderer::streamInstances");
+
+    const auto allocation = m_instanceStream->Allocate(count * sizeof(PackedBoxInstance), sizeof(PackedBoxInstance));
+    if (!allocation)
+    {
+        static bool warned = false;
+        if (!warned)
+            std::cerr << "Instance stream has no space for " << count << " boxes, skipping them" << std::endl;
+        warned = true;
+
+        return std::nullopt;
+    }
+
+    // Written straight into mapped memory, the GPU reads it with no upload call
+    auto* instances = static_cast<PackedBoxInstance*>(allocation->data);
+    m_jobs.parallel_for(0, count, BoxesPerJob, [&](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+            instances[i] = m_packedInstances[m_visible[first + i]];
+    });
+
+    return allocation->offset / sizeof(PackedBoxInstance);
+}
+
+auto BoxRenderer::prepareIndirect() -> void
+{
+    const uint boxes = m_instances.size();
+    const uint groups = getIndirectGroupCount();
+
+    if (!m_instanceStorage)
+    {
+        m_instanceStorage = std::make_unique<GPU::StorageBuffer>(nullptr, boxes * sizeof(PackedBoxInstance));
+        m_sphereStorage = std::make_unique<GPU::StorageBuffer>(nullptr, boxes * sizeof(glm::vec4));
+        m_visibleStorage = std::make_unique<GPU::StorageBuffer>(nullptr, groups * IndirectGroupSize * sizeof(uint));
+
+        // Every group draws the whole mesh, instance count is filled in by culling
+        std::vector<DrawArraysIndirectCommand> commands(groups);
+        for (uint group = 0; group < groups; group++)
+            commands[group] = {m_vertexCount, 0, 0, group * IndirectGroupSize};
+
+        const uint size = sizeof(DrawHeader) + groups * sizeof(DrawArraysIndirectCommand);
+        const DrawHeader header{};
+        m_drawReset = std::make_unique<GPU::StorageBuffer>(nullptr, size);
+        m_drawReset->SetSubData(0, &header, sizeof(DrawHeader));
+        m_drawReset->SetSubData(sizeof(DrawHeader), commands.data(), groups * sizeof(DrawArraysIndirectCommand));
+        m_drawStorage = std::make_unique<GPU::StorageBuffer>(nullptr, size);
+
+        for (auto& readback : m_readbacks)
+            if (!readback.buffer)
+                readback.buffer = std::make_unique<GPU::StorageBuffer>(nullptr, sizeof(DrawHeader));
+
+        m_indirectDirty = true;
+    }
+
+    if (!m_indirectDirty)
+        return;
+
+    PROFILE_ZONE("BoxRenderer::prepareIndirect");
+
+    m_sphereData.resize(boxes);
+    m_jobs.parallel_for(0, boxes, BoxesPerJob, [this](uint begin, uint end) {
+        for (uint i = begin; i < end; i++)
+            m_sphereData[i] = {m_spheres.x[i], m_spheres.y[i], m_spheres.z[i], m_spheres.radius[i]};
+    });
+
+    m_instanceStorage->SetData(m_packedInstances.data(), boxes * sizeof(PackedBoxInstance));
+    m_sphereStorage->SetData(m_sphereData.data(), boxes * sizeof(glm::vec4));
+    m_indirectDirty = false;
+}
+
+auto BoxRenderer::cullIndirect(const Camera& camera) -> void
+{
+    PROFILE_ZONE("BoxRenderer::cullIndirect");
+    PROFILE_GPU_ZONE("BoxRenderer::cullIndirect");
+
+    const uint boxes = m_instances.size();
+    const Frustum frustum = Frustum::FromCamera(camera);
+
+    m_drawStorage->CopyFrom(*m_drawReset, m_drawReset->GetSize());
+
+    m_cullShader->Bind();
+    for (uint plane = 0; plane < Frustum::COUNT; plane++)
+    {
+        const glm::vec4& p = frustum.planes[plane];
+        m_cullShader->SetUniform(PlaneUniforms[plane], p.x, p.y, p.z, p.w);
+    }
+    m_cullShader->SetUniform("uBoxCount", boxes);
+    m_cullShader->SetUniform("uCull", m_culling != Culling::None);
+
+    m_sphereStorage->BindBase(GPU::StorageBinding::Spheres);
+    m_visibleStorage->BindBase(GPU::StorageBinding::Visible);
+    m_drawStorage->BindBase(GPU::StorageBinding::Draws);
+
+    glDispatchCompute((boxes + CullGroupSize - 1) / CullGroupSize, 1, 1);
+
+    // Commands are read by the draw, visible indices by the vertex shader, counters by the readback copy
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+auto BoxRenderer::drawIndirect() -> void
+{
+    PROFILE_ZONE("BoxRenderer::drawIndirect");
+
+    m_instanceStorage->BindBase(GPU::StorageBinding::Instances);
+    m_visibleStorage->BindBase(GPU::StorageBinding::Visible);
+
+    m_va.Bind();
+    m_drawStorage->Bind(GL_DRAW_INDIRECT_BUFFER);
+
+    const void* commands = reinterpret_cast<const void*>(sizeof(DrawHeader));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+
+    // With 4.6 the GPU also decides how many commands are read, trailing empty groups are skipped
+    if (GLAD_GL_VERSION_4_6)
+    {
+        m_drawStorage->Bind(GL_PARAMETER_BUFFER);
+        glMultiDrawArraysIndirectCount(
+            GL_TRIANGLES, commands, offsetof(DrawHeader, drawCount), getIndirectGroupCount(), sizeof(DrawArraysIndirectCommand));
+    }
+    else
+        glMultiDrawArraysIndirect(GL_TRIANGLES, commands, getIndirectGroupCount(), sizeof(DrawArraysIndirectCommand));
+
+    m_drawCalls++;
+}
+
+auto BoxRenderer::readbackIndirectCount() -> void
+{
+    // Slot is reused every few frames, by then the GPU is almost always done with it, so the wait is free
+    auto& readback = m_readbacks[m_readbackFrame++ % m_readbacks.size()];
+
+    if (readback.fence != nullptr)
+    {
+        constexpr uint64_t Timeout = 1'000'000'000;    // ns
+        glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, Timeout);
+        glDeleteSync(readback.fence);
+
+        DrawHeader header{};
+        readback.buffer->GetSubData(0, &header, sizeof(DrawHeader));
+        m_indirectVisibleCount = header.visibleCount;
+    }
+
+    readback.buffer->CopyFrom(*m_drawStorage, sizeof(DrawHeader));
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+auto BoxRenderer::getIndirectGroupCount() const -> uint
+{
+    return (m_instances.size() + IndirectGroupSize - 1) / IndirectGroupSize;
+}
+
+auto BoxRenderer::resolveTexturing() const -> Texturing
+{
+    if (m_texturing == Texturing::Bindless && m_bindlessTextures != nullptr && m_bindlessTextures->IsValid())
+        return Texturing::Bindless;
+
+    if (m_texturing != Texturing::Slots && m_textureArray != nullptr && m_textureArray->GetId() != 0)
+        return Texturing::Array;
+
+    return Texturing::Slots;
+}
+
+auto BoxRenderer::submitShaders(Texturing texturing) -> void
+{
+    const bool array = texturing == Texturing::Array;
+    auto& shaders = array ? m_arrayShaders : m_bindlessShaders;
+
+    for (uint mode = 0; mode < shaders.size(); mode++)
+    {
+        if (shaders[mode] || (static_cast<Mode>(mode) == Mode::Indirect && !indirect_supported()))
+            continue;
+
+        shaders[mode] = std::make_unique<GPU::Shader>(
+            Shaders::mode_vert[mode],
+            array ? Shaders::instanced_light_array_frag : Shaders::instanced_light_bindless_frag);
+    }
+}
+
+auto BoxRenderer::getShader(Mode mode) -> GPU::Shader&
+{
+    const uint index = static_cast<uint>(mode);
+
+    if (m_activeTexturing == Texturing::Slots)
+    {
+        switch (mode)
+        {
+            case Mode::PerBox: return m_shader;
+            case Mode::Instanced: return m_instancedShader;
+            case Mode::Indirect: return *m_indirectShader;
+        }
+    }
+
+    const bool array = m_activeTexturing == Texturing::Array;
+    auto& shader = array ? m_arrayShaders[index] : m_bindlessShaders[index];
+
+    if (!shader)
+        submitShaders(m_activeTexturing);
+
+    return *shader;
+}
+
+auto BoxRenderer::bindTextures(GPU::Shader& shader) const -> void
+{
+    switch (m_activeTexturing)
+    {
+        case Texturing::Slots:
+            shader.SetUniform("uTexture_0", 0);
+            shader.SetUniform("uTexture_1", 1);
+            break;
+        case Texturing::Array:
+            GPU::StateCache::Get().BindTexture(TextureArraySlot, GL_TEXTURE_2D_ARRAY, m_textureArray->GetId());
+            shader.SetUniform("uTextureArray", static_cast<int>(TextureArraySlot));
+            break;
+        case Texturing::Bindless:
+            m_bindlessTextures->BindBase(GPU::StorageBinding::Textures);
+            break;
+    }
+}
+
+auto BoxRenderer::bindShader(Mode mode) -> GPU::Shader&
+{
+    GPU::Shader& shader = getShader(mode);
+
+    shader.Bind();
+    bindTextures(shader);
+
+    return shader;
+}
+
+} // namespace Renderer
@@ -1,6 +1,20 @@
 #include "Renderer/Camera.hpp"
 
-namespace { constexpr bool FREECAM_MODE = true; }
+namespace {
+    constexpr bool FREECAM_MODE = true;
+
+    // Aspect of primary monitor, without GLFW (headless) there is no monitor to ask
+    auto monitor_aspect() -> float
+    {
+        GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+        const GLFWvidmode* video_mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+
+        if (!video_mode)
+            return 16.f / 9.f;
+
+        return static_cast<float>(video_mode->width) / static_cast<float>(video_mode->height);
+    }
+}
 
 namespace Renderer
 {
@@ -10,9 +24,8 @@ Camera::Camera(vector position, normal forward, normal up) noexcept :
     m_forward{forward},
     m_up{up},
     m_right{glm::normalize(glm::cross(m_forward, m_up))},
-    video_mode{glfwGetVideoMode(glfwGetPrimaryMonitor())}
+    m_aspect{monitor_aspect()}
 {
-    glEnable(GL_DEPTH_TEST);
     updateView();
     updateProjection();
 }
@@ -134,6 +147,31 @@ auto Camera::resetRotation() noexcept -> void
     updateView();
 }
 
+auto Camera::setPosition(const vector position) noexcept -> void
+{
+    m_position = position;
+
+    updateView();
+}
+
+auto Camera::lookAt(const vector target) noexcept -> void
+{
+    constexpr glm::vec3 worldUp{0.f, 1.f, 0.f};
+
+    m_forward = glm::normalize(target - m_position);
+    m_right = glm::normalize(glm::cross(m_forward, worldUp));
+    m_up = glm::normalize(glm::cross(m_right, m_forward));
+
+    updateView();
+}
+
+auto Camera::setAspect(const float aspect) noexcept -> void
+{
+    m_aspect = aspect;
+
+    updateProjection();
+}
+
     /**   PRIVATE   **/
 
 auto Camera::updateView() noexcept -> void
@@ -145,7 +183,7 @@ auto Camera::updateProjection() noexcept -> void
 {
     m_projection = glm::perspective(
         glm::radians(m_fov),
-        static_cast<float>(video_mode->width) / static_cast<float>(video_mode->height),
+        m_aspect,
         0.5f,
         20000.f
     );
@@ -0,0 +1,258 @@
+/**
+ * @file Culling.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of frustum culling
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Renderer/Culling.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define CULLING_X86
+#endif
+
+namespace
+{
+
+using Renderer::Frustum;
+using Renderer::BoundingSpheres;
+
+auto cull_scalar(const Frustum& frustum, const BoundingSpheres& spheres, uint begin, uint end, uint* out) -> uint
+{
+    uint count = 0;
+
+    for (uint i = begin; i < end; i++)
+    {
+        const glm::vec3 center{spheres.x[i], spheres.y[i], spheres.z[i]};
+
+        if (frustum.intersectsSphere(center, spheres.radius[i]))
+            out[count++] = i;
+    }
+
+    return count;
+}
+
+#ifdef CULLING_X86
+
+// Writes indices of set bits in mask, offset by base
+inline auto write_mask(uint mask, uint base, uint* out) -> uint
+{
+    uint count = 0;
+
+    while (mask != 0)
+    {
+        out[count++] = base + __builtin_ctz(mask);
+        mask &= mask - 1;
+    }
+
+    return count;
+}
+
+auto cull_sse(const Frustum& frustum, const BoundingSpheres& spheres, uint begin, uint end, uint* out) -> uint
+{
+    __m128 nx[Frustum::COUNT], ny[Frustum::COUNT], nz[Frustum::COUNT], nw[Frustum::COUNT];   // NOLINT (cppcoreguidelines-avoid-c-arrays) - std::array drops vector type attributes
+    for (uint p = 0; p < Frustum::COUNT; p++)
+    {
+        nx[p] = _mm_set1_ps(frustum.planes[p].x);
+        ny[p] = _mm_set1_ps(frustum.planes[p].y);
+        nz[p] = _mm_set1_ps(frustum.planes[p].z);
+        nw[p] = _mm_set1_ps(frustum.planes[p].w);
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    uint count = 0;
+    uint i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(&spheres.x[i]);
+        const __m128 y = _mm_loadu_ps(&spheres.y[i]);
+        const __m128 z = _mm_loadu_ps(&spheres.z[i]);
+        const __m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(&spheres.radius[i]));
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (uint p = 0; p < Frustum::COUNT; p++)
+        {
+            const __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(nx[p], x), _mm_mul_ps(ny[p], y)),
+                _mm_add_ps(_mm_mul_ps(nz[p], z), nw[p]));
+
+            inside = _mm_and_ps(inside, _mm_cmpgt_ps(distance, negRadius));
+        }
+
+        count += write_mask(_mm_movemask_ps(inside), i, out + count);
+    }
+
+    return count + cull_scalar(frustum, spheres, i, end, out + count);
+}
+
+__attribute__((target("avx2,fma")))
+auto cull_avx2(const Frustum& frustum, const BoundingSpheres& spheres, uint begin, uint end, uint* out) -> uint
+{
+    __m256 nx[Frustum::COUNT], ny[Frustum::COUNT], nz[Frustum::COUNT], nw[Frustum::COUNT];   // NOLINT (cppcoreguidelines-avoid-c-arrays) - std::array drops vector type attributes
+    for (uint p = 0; p < Frustum::COUNT; p++)
+    {
+        nx[p] = _mm256_set1_ps(frustum.planes[p].x);
+        ny[p] = _mm256_set1_ps(frustum.planes[p].y);
+        nz[p] = _mm256_set1_ps(frustum.planes[p].z);
+        nw[p] = _mm256_set1_ps(frustum.planes[p].w);
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    uint count = 0;
+    uint i = begin;
+
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(&spheres.x[i]);
+        const __m256 y = _mm256_loadu_ps(&spheres.y[i]);
+        const __m256 z = _mm256_loadu_ps(&spheres.z[i]);
+        const __m256 negRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(&spheres.radius[i]));
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (uint p = 0; p < Frustum::COUNT; p++)
+        {
+            __m256 distance = _mm256_fmadd_ps(nx[p], x, nw[p]);
+            distance = _mm256_fmadd_ps(ny[p], y, distance);
+            distance = _mm256_fmadd_ps(nz[p], z, distance);
+
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GT_OQ));
+        }
+
+        count += write_mask(_mm256_movemask_ps(inside), i, out + count);
+    }
+
+    return count + cull_sse(frustum, spheres, i, end, out + count);
+}
+
+#endif // CULLING_X86
+
+} // namespace
+
+namespace Renderer
+{
+
+auto BoundingSpheres::push_back(const glm::vec3& center, float r) -> void
+{
+    x.push_back(center.x);
+    y.push_back(center.y);
+    z.push_back(center.z);
+    radius.push_back(r);
+}
+
+auto BoundingSpheres::clear() -> void
+{
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+}
+
+auto make_bounding_spheres(const std::vector<Scene::Box>& boxes) -> BoundingSpheres
+{
+    BoundingSpheres spheres;
+    spheres.x.reserve(boxes.size());
+    spheres.y.reserve(boxes.size());
+    spheres.z.reserve(boxes.size());
+    spheres.radius.reserve(boxes.size());
+
+    for (const auto& box : boxes)
+        spheres.push_back(box.position, Scene::bounding_radius(box));
+
+    return spheres;
+}
+
+auto detect_simd_level() -> SimdLevel
+{
+#ifdef CULLING_X86
+    static const SimdLevel level =
+        (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ? SimdLevel::AVX2 :
+        __builtin_cpu_supports("sse2") ? SimdLevel::SSE :
+        SimdLevel::Scalar;
+
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+auto cull_spheres(
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    uint begin,
+    uint end,
+    uint* out,
+    SimdLevel level
+) -> uint
+{
+#ifdef CULLING_X86
+    switch (level)
+    {
+        case SimdLevel::AVX2: return cull_avx2(frustum, spheres, begin, end, out);
+        case SimdLevel::SSE: return cull_sse(frustum, spheres, begin, end, out);
+        case SimdLevel::Scalar: break;
+    }
+#endif
+
+    return cull_scalar(frustum, spheres, begin, end, out);
+}
+
+auto cull_spheres(
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    std::vector<uint>& visible,
+    SimdLevel level
+) -> void
+{
+    visible.resize(spheres.size());
+
+    const uint count = cull_spheres(frustum, spheres, 0, spheres.size(), visible.data(), level);
+    visible.resize(count);
+}
+
+auto cull_spheres(
+    JobSystem& jobs,
+    const Frustum& frustum,
+    const BoundingSpheres& spheres,
+    std::vector<uint>& visible,
+    SimdLevel level
+) -> void
+{
+    constexpr uint chunkSize = 16 * 1024;
+
+    const uint count = spheres.size();
+    const uint chunks = (count + chunkSize - 1) / chunkSize;
+
+    visible.resize(count);
+    std::vector<uint> chunkVisible(chunks);
+
+    // Every chunk writes its indices at its own offset, so chunks don't need to synchronize
+    jobs.parallel_for(0, chunks, 1, [&](uint begin, uint end) {
+        for (uint chunk = begin; chunk < end; chunk++)
+        {
+            const uint first = chunk * chunkSize;
+            const uint last = std::min(count, first + chunkSize);
+
+            chunkVisible[chunk] = cull_spheres(frustum, spheres, first, last, visible.data() + first, level);
+        }
+    });
+
+    uint total = 0;
+    for (uint chunk = 0; chunk < chunks; chunk++)
+    {
+        const auto first = visible.begin() + chunk * chunkSize;
+
+        std::copy(first, first + chunkVisible[chunk], visible.begin() + total);
+        total += chunkVisible[chunk];
+    }
+
+    visible.resize(total);
+}
+
+} // namespace Renderer
@@ -0,0 +1,80 @@
+/**
+ * @file FrameUniforms.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of FrameUniforms class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/FrameUniforms.hpp"
+
+#include <cstring>
+
+#include "Profiler.hpp"
+
+namespace
+{
+    using Renderer::GPU::CameraBlock;
+    using Renderer::GPU::FrameBlock;
+    using Renderer::GPU::LightingBlock;
+    namespace UniformBinding = Renderer::GPU::UniformBinding;
+    using Renderer::GPU::UniformBlockBindings;
+
+    // Indexed like UniformBlockBindings
+    constexpr std::array<uint, UniformBlockBindings.size()> BlockSizes{
+        sizeof(CameraBlock), sizeof(FrameBlock), sizeof(LightingBlock)
+    };
+
+    static_assert(UniformBlockBindings[0].binding == UniformBinding::Camera);
+    static_assert(UniformBlockBindings[1].binding == UniformBinding::Frame);
+    static_assert(UniformBlockBindings[2].binding == UniformBinding::Lighting);
+}   // namespace
+
+namespace Renderer
+{
+
+FrameUniforms::FrameUniforms() :
+    m_buffer{nullptr, 0}
+{
+    // Bound ranges have to start at the driver's alignment, blocks are placed one after another with it
+    const uint alignment = GPU::UniformBuffer::GetOffsetAlignment();
+    uint size = 0;
+
+    for (uint block = 0; block < m_offsets.size(); block++)
+    {
+        m_offsets[block] = size;
+        size = (size + BlockSizes[block] + alignment - 1) / alignment * alignment;
+    }
+
+    m_staging.resize(size);
+}
+
+auto FrameUniforms::update(const Camera& camera, const GPU::FrameBlock& frame, const GPU::LightingBlock& lighting) -> void
+{
+    PROFILE_ZONE("FrameUniforms::update");
+
+    const GPU::CameraBlock cameraBlock = to_block(camera.getView(), camera.getProjection());
+
+    std::memcpy(m_staging.data() + m_offsets[0], &cameraBlock, sizeof(cameraBlock));
+    std::memcpy(m_staging.data() + m_offsets[1], &frame, sizeof(frame));
+    std::memcpy(m_staging.data() + m_offsets[2], &lighting, sizeof(lighting));
+
+    m_buffer.SetData(m_staging.data(), m_staging.size());
+    bind();
+}
+
+auto FrameUniforms::bind() const -> void
+{
+    for (uint block = 0; block < m_offsets.size(); block++)
+        m_buffer.BindRange(GPU::UniformBlockBindings[block].binding, m_offsets[block], BlockSizes[block]);
+}
+
+auto FrameUniforms::to_block(const glm::mat4& view, const glm::mat4& projection) -> GPU::CameraBlock
+{
+    // Camera sits at the origin of view space, its world position is the inverse's translation
+    return {view, projection, projection * view, glm::inverse(view)[3]};
+}
+
+} // namespace Renderer
@@ -0,0 +1,55 @@
+/**
+ * @file Frustum.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of Frustum struct
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Renderer/Frustum.hpp"
+
+#include "Renderer/Camera.hpp"
+
+namespace Renderer
+{
+
+auto Frustum::FromMatrix(const glm::mat4& m) -> Frustum
+{
+    // Gribb & Hartmann, glm matrices are column-major so row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+    const auto row = [&m](int i) {
+        return glm::vec4{m[0][i], m[1][i], m[2][i], m[3][i]};
+    };
+
+    Frustum frustum;
+    frustum.planes[LEFT] = row(3) + row(0);
+    frustum.planes[RIGHT] = row(3) - row(0);
+    frustum.planes[BOTTOM] = row(3) + row(1);
+    frustum.planes[TOP] = row(3) - row(1);
+    frustum.planes[NEAR] = row(3) + row(2);
+    frustum.planes[FAR] = row(3) - row(2);
+
+    for (auto& plane : frustum.planes)
+        plane = plane / glm::length(glm::vec3{plane});
+
+    return frustum;
+}
+
+auto Frustum::FromCamera(const Camera& camera) -> Frustum
+{
+    return FromMatrix(camera.getProjection() * camera.getView());
+}
+
+auto Frustum::intersectsSphere(const glm::vec3& center, float radius) const -> bool
+{
+    for (const auto& plane : planes)
+    {
+        if (glm::dot(glm::vec3{plane}, center) + plane.w <= -radius)
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace Renderer
@@ -0,0 +1,76 @@
+/**
+ * @file BindlessTextures.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of BindlessTextures class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/BindlessTextures.hpp"
+
+#include <iostream>
+
+#include "Profiler.hpp"
+#include "Renderer/GPU/Extensions.hpp"
+
+namespace Renderer::GPU
+{
+
+auto BindlessTextures::IsSupported() -> bool
+{
+    return Extensions::Get().HasBindlessTexture() && GLAD_GL_VERSION_4_5;
+}
+
+BindlessTextures::BindlessTextures(const std::vector<std::filesystem::path>& paths, JobSystem* jobs)
+{
+    PROFILE_ZONE("BindlessTextures::BindlessTextures");
+
+    if (!IsSupported())
+    {
+        std::cerr << "Bindless textures need ARB_bindless_texture and OpenGL 4.5" << std::endl;
+        return;
+    }
+
+    const auto& extensions = Extensions::Get();
+
+    for (const auto& path : paths)
+    {
+        auto texture = std::make_unique<Texture>(path, jobs);
+        if (texture->GetId() == 0)
+            return;
+
+        // Handle captures sampling state, the texture can't be changed once it's resident
+        glTextureParameteri(texture->GetId(), GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(texture->GetId(), GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        const uint64_t handle = extensions.glGetTextureHandleARB(texture->GetId());
+        if (handle == 0)
+        {
+            std::cerr << "Failed to get handle of texture " << path << std::endl;
+            return;
+        }
+
+        extensions.glMakeTextureHandleResidentARB(handle);
+
+        m_handles.push_back(handle);
+        m_textures.push_back(std::move(texture));
+    }
+
+    m_handleBuffer = std::make_unique<StorageBuffer>(m_handles.data(), m_handles.size() * sizeof(uint64_t));
+}
+
+BindlessTextures::~BindlessTextures()
+{
+    // Textures can only be deleted once their handles aren't resident
+    for (const uint64_t handle : m_handles)
+        Extensions::Get().glMakeTextureHandleNonResidentARB(handle);
+}
+
+auto BindlessTextures::BindBase(uint index) const -> void
+{
+    m_handleBuffer->BindBase(index);
+}
+
+} // namespace Renderer::GPU
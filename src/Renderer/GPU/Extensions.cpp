@@ -0,0 +1,65 @@
+/**
+ * @file Extensions.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of Extensions class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/Extensions.hpp"
+
+namespace Renderer::GPU
+{
+
+auto Extensions::Get() -> Extensions&
+{
+    static Extensions extensions;
+    return extensions;
+}
+
+auto Extensions::Load(GLADloadfunc loader) -> void
+{
+    m_s3tc = Has("GL_EXT_texture_compression_s3tc");
+
+    glGetTextureHandleARB = nullptr;
+    glMakeTextureHandleResidentARB = nullptr;
+    glMakeTextureHandleNonResidentARB = nullptr;
+
+    if (Has("GL_ARB_bindless_texture"))
+    {
+        glGetTextureHandleARB = reinterpret_cast<GetTextureHandleARB>(loader("glGetTextureHandleARB"));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+        glMakeTextureHandleResidentARB = reinterpret_cast<MakeTextureHandleResidentARB>(loader("glMakeTextureHandleResidentARB"));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+        glMakeTextureHandleNonResidentARB = reinterpret_cast<MakeTextureHandleNonResidentARB>(loader("glMakeTextureHandleNonResidentARB"));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    m_bindlessTexture = glGetTextureHandleARB != nullptr && glMakeTextureHandleResidentARB != nullptr && glMakeTextureHandleNonResidentARB != nullptr;
+
+    glMaxShaderCompilerThreadsKHR = nullptr;
+
+    if (Has("GL_KHR_parallel_shader_compile"))
+        glMaxShaderCompilerThreadsKHR = reinterpret_cast<MaxShaderCompilerThreadsKHR>(loader("glMaxShaderCompilerThreadsKHR"));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    else if (Has("GL_ARB_parallel_shader_compile"))
+        glMaxShaderCompilerThreadsKHR = reinterpret_cast<MaxShaderCompilerThreadsKHR>(loader("glMaxShaderCompilerThreadsARB"));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    m_parallelShaderCompile = glMaxShaderCompilerThreadsKHR != nullptr;
+
+    // As many compiler threads as the driver allows, programs are then compiled while frames are drawn
+    if (m_parallelShaderCompile)
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+}
+
+auto Extensions::Has(std::string_view name) -> bool
+{
+    int count{};
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+    for (int i = 0; i < count; i++)
+        if (name == reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)))   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+            return true;
+
+    return false;
+}
+
+} // namespace Renderer::GPU
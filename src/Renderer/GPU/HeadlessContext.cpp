@@ -0,0 +1,248 @@
+/**
+ * @file HeadlessContext.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of HeadlessContext class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Renderer/GPU/HeadlessContext.hpp"
+
+#include <glad/gl.h>
+
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/Extensions.hpp"
+
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <array>
+#include <cstring>
+#include <iostream>
+
+#if !defined(OpenGL_VERSION_MAJOR) || !defined(OpenGL_VERSION_MINOR)
+    constexpr int OpenGL_VERSION_MAJOR = 3;
+    constexpr int OpenGL_VERSION_MINOR = 3;
+#endif
+
+namespace
+{
+
+auto has_extension(EGLDisplay display, const char* name) -> bool
+{
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+
+    return extensions != nullptr && std::strstr(extensions, name) != nullptr;
+}
+
+// Surfaceless platform doesn't need any window system, default display is the fallback
+auto open_display() -> EGLDisplay
+{
+    const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+    if (getPlatformDisplay != nullptr && has_extension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+    {
+        EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+        if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+            return display;
+    }
+
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+        return display;
+
+    return EGL_NO_DISPLAY;
+}
+
+} // namespace
+
+namespace Renderer::GPU
+{
+
+HeadlessContext::HeadlessContext(uint width, uint height) :
+    m_width{width},
+    m_height{height}
+{
+    if (!createContext())
+        return;
+
+    // Cache may still describe a context that was current on this thread before
+    StateCache::Get().Reset();
+
+    if (!gladLoadGL(reinterpret_cast<GLADloadfunc>(eglGetProcAddress)))
+    {
+        std::cerr << "Failed to initialize GLAD" << std::endl;
+        return;
+    }
+
+    Extensions::Get().Load(reinterpret_cast<GLADloadfunc>(eglGetProcAddress));    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    if (!createFramebuffer())
+        return;
+
+    Bind();
+}
+
+HeadlessContext::~HeadlessContext()
+{
+    if (m_framebuffer != 0)
+    {
+        StateCache::Get().ForgetFramebuffer(m_framebuffer);
+        glDeleteFramebuffers(1, &m_framebuffer);
+        glDeleteRenderbuffers(1, &m_colorBuffer);
+        glDeleteRenderbuffers(1, &m_depthBuffer);
+    }
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    if (m_surface != EGL_NO_SURFACE)
+        eglDestroySurface(m_display, m_surface);
+    if (m_context != EGL_NO_CONTEXT)
+        eglDestroyContext(m_display, m_context);
+
+    eglTerminate(m_display);
+}
+
+auto HeadlessContext::Bind() const -> void
+{
+    StateCache::Get().BindFramebuffer(m_framebuffer);
+    glViewport(0, 0, m_width, m_height);
+}
+
+auto HeadlessContext::GetDescription() const -> std::string
+{
+    const auto* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const auto* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+    return std::string{renderer ? renderer : "unknown"} + ", " + (version ? version : "unknown");
+}
+
+    /**   PRIVATE   **/
+
+auto HeadlessContext::createContext() -> bool
+{
+    m_display = open_display();
+
+    if (m_display == EGL_NO_DISPLAY)
+    {
+        std::cerr << "Failed to open EGL display, error code: " << eglGetError() << std::endl;
+        return false;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        std::cerr << "EGL doesn't support desktop OpenGL" << std::endl;
+        return false;
+    }
+
+    // Pbuffer support is only needed when the context can't be made current without a surface
+    const std::array<EGLint, 13> configAttributes {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+
+    EGLConfig config{};
+    EGLint configCount{};
+
+    if (!eglChooseConfig(m_display, configAttributes.data(), &config, 1, &configCount) || configCount == 0)
+    {
+        std::cerr << "No suitable EGL config, error code: " << eglGetError() << std::endl;
+        return false;
+    }
+
+    // Requested version first, then the newest ones llvmpipe is known to support
+    constexpr std::array<std::array<EGLint, 2>, 3> versions {{
+        {OpenGL_VERSION_MAJOR, OpenGL_VERSION_MINOR},
+        {4, 5},
+        {3, 3}
+    }};
+
+    for (const auto& [major, minor] : versions)
+    {
+        const std::array<EGLint, 7> contextAttributes {
+            EGL_CONTEXT_MAJOR_VERSION, major,
+            EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+
+        m_context = eglCreateContext(m_display, config, EGL_NO_CONTEXT, contextAttributes.data());
+
+        if (m_context != EGL_NO_CONTEXT)
+            break;
+    }
+
+    if (m_context == EGL_NO_CONTEXT)
+    {
+        std::cerr << "Failed to create EGL context, error code: " << eglGetError() << std::endl;
+        return false;
+    }
+
+    if (has_extension(m_display, "EGL_KHR_surfaceless_context") &&
+        eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_context))
+        return true;
+
+    // Everything is drawn to the framebuffer anyway, so the pbuffer can be tiny
+    const std::array<EGLint, 5> surfaceAttributes {
+        EGL_WIDTH, 1,
+        EGL_HEIGHT, 1,
+        EGL_NONE
+    };
+
+    m_surface = eglCreatePbufferSurface(m_display, config, surfaceAttributes.data());
+
+    if (m_surface == EGL_NO_SURFACE || !eglMakeCurrent(m_display, m_surface, m_surface, m_context))
+    {
+        std::cerr << "Failed to make EGL context current, error code: " << eglGetError() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+auto HeadlessContext::createFramebuffer() -> bool
+{
+    glGenRenderbuffers(1, &m_colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_width, m_height);
+
+    glGenRenderbuffers(1, &m_depthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_width, m_height);
+
+    glGenFramebuffers(1, &m_framebuffer);
+    StateCache::Get().BindFramebuffer(m_framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cerr << "Offscreen framebuffer is incomplete" << std::endl;
+
+        StateCache::Get().ForgetFramebuffer(m_framebuffer);
+        glDeleteFramebuffers(1, &m_framebuffer);
+        glDeleteRenderbuffers(1, &m_colorBuffer);
+        glDeleteRenderbuffers(1, &m_depthBuffer);
+        m_framebuffer = 0;
+
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Renderer::GPU
@@ -12,25 +12,28 @@
 
 #include <glad/gl.h>
 
+#include "Renderer/GPU/StateCache.hpp"
+
 namespace Renderer::GPU
 {
 
 IndexBuffer::IndexBuffer(const uint* data, const uint count) {
     glGenBuffers(1, &m_id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+    Bind();
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint), data, GL_STATIC_DRAW);
 }
 
 IndexBuffer::~IndexBuffer() {
+    StateCache::Get().ForgetBuffer(m_id);
     glDeleteBuffers(1, &m_id);
 }
 
 auto IndexBuffer::Bind() const -> void {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+    StateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
 }
 
 auto IndexBuffer::Unbind() const -> void {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    StateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
 } // namespace Renderer::GPU
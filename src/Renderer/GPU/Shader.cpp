@@ -11,14 +11,27 @@
 #include "Renderer/GPU/Shader.hpp"
 
 #include <array>
+#include <chrono>
+#include <format>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 #include <iostream>
+#include <algorithm>
 #include <filesystem>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <glad/gl.h>
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include "Profiler.hpp"
+#include "Renderer/GPU/Extensions.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/UniformBlocks.hpp"
+
 namespace
 {
 
@@ -28,6 +41,52 @@ struct ShaderProgramSource
     std::string FragmentSource;
 };
 
+struct Stage
+{
+    uint type;
+    std::string source;
+};
+
+constexpr std::array<char, 4> Magic{'P', 'R', 'G', 'B'};
+constexpr uint Version = 1;
+
+constexpr uint64_t FnvOffset = 14695981039346656037ull;
+constexpr uint64_t FnvPrime = 1099511628211ull;
+
+Renderer::GPU::Shader::CacheStats cacheStats{};
+
+// Every existing Shader, for reloading programs built from changed files
+std::vector<Renderer::GPU::Shader*> liveShaders{};
+
+auto fnv1a(uint64_t hash, std::string_view data) -> uint64_t
+{
+    for (const char c : data)
+    {
+        hash ^= static_cast<uchar>(c);
+        hash *= FnvPrime;
+    }
+
+    return hash;
+}
+
+template<typename T>
+auto write_value(std::ofstream& file, const T& value) -> void
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+template<typename T>
+auto read_value(std::ifstream& file, T& value) -> void
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Only submits the source, asking for the status would wait for the compiler
 static auto CompileShader(const std::string& source, uint type) -> uint
 {
     uint id = glCreateShader(type);
@@ -36,33 +95,43 @@ static auto CompileShader(const std::string& source, uint type) -> uint
     glShaderSource(id, 1, &src, nullptr);
     glCompileShader(id);
 
-    // Error handling
+    return id;
+}
+
+auto ReportShader(uint id) -> void
+{
     int result{};
     glGetShaderiv(id, GL_COMPILE_STATUS, &result);
-    if (result == GL_FALSE)
-    {
-        int length{};
-        glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length);
-        char* message = static_cast<char*>(alloca(length * sizeof(char)));
+    if (result == GL_TRUE)
+        return;
 
-        glGetShaderInfoLog(id, length, &length, message);
-        std::cout << "Failed to compile " << (type == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader:\n";
-        std::cout << message << std::endl;
-
-        glDeleteShader(id);
-        return 0;
-    }
+    int type{};
+    int length{};
+    glGetShaderiv(id, GL_SHADER_TYPE, &type);
+    glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length);
+    std::string message(length, '\0');
 
-    return id;
+    glGetShaderInfoLog(id, length, &length, message.data());
+    std::cout << "Failed to compile " <<
+        (type == GL_VERTEX_SHADER ? "vertex" : type == GL_FRAGMENT_SHADER ? "fragment" : "compute") << " shader:\n";
+    std::cout << message << std::endl;
 }
 
-auto ParseShader(const std::filesystem::path fpath) -> ShaderProgramSource
+auto ReadFile(const std::filesystem::path& path) -> std::string
 {
-    std::ifstream stream(fpath);
+    std::ifstream stream(path);
 
     if (!stream)
         throw std::runtime_error("Failed to open shader file");
 
+    std::stringstream ss;
+    ss << stream.rdbuf();
+
+    return ss.str();
+}
+
+auto ParseShader(const std::filesystem::path fpath) -> ShaderProgramSource
+{
     enum class ShaderType : int
     {
         NONE = -1,
@@ -70,158 +139,442 @@ auto ParseShader(const std::filesystem::path fpath) -> ShaderProgramSource
         FRAGMENT = 1
     };
 
-    std::string line;
-    std::array<std::stringstream,2> ss;
+    const std::string file = ReadFile(fpath);
+    std::array<std::string, 2> sources;
     ShaderType type = ShaderType::NONE;
 
-    while (std::getline(stream, line))
+    // Lines are views into the whole file read at once, only stage sources are copied
+    for (std::size_t begin = 0; begin < file.size();)
     {
-        if (line.find("#shader") != std::string::npos)
+        const std::size_t end = std::min(file.find('\n', begin), file.size());
+        const std::string_view line{file.data() + begin, end - begin};
+        begin = end + 1;
+
+        if (line.find("#shader") != std::string_view::npos)
         {
-            if (line.find("vertex") != std::string::npos)
+            if (line.find("vertex") != std::string_view::npos)
                 type = ShaderType::VERTEX;
-            else if (line.find("fragment") != std::string::npos)
+            else if (line.find("fragment") != std::string_view::npos)
                 type = ShaderType::FRAGMENT;
         }
         else if (type != ShaderType::NONE)
         {
-            ss.at(static_cast<int>(type)) << line << '\n';
+            sources.at(static_cast<int>(type)).append(line).push_back('\n');
         }
     }
 
-    return { ss[0].str(), ss[1].str() };
+    return { std::move(sources[0]), std::move(sources[1]) };
+}
+
+auto ParseShader(const std::filesystem::path& vertexPath, const std::filesystem::path& fragmentPath) -> ShaderProgramSource
+{
+    return { ReadFile(vertexPath), ReadFile(fragmentPath) };
+}
+
+auto ReadStages(const std::vector<std::filesystem::path>& files) -> std::vector<Stage>
+{
+    if (files.size() == 1 && files[0].extension() == ".comp")
+        return {{GL_COMPUTE_SHADER, ReadFile(files[0])}};
+
+    ShaderProgramSource source = files.size() == 1 ? ParseShader(files[0]) : ParseShader(files[0], files[1]);
+
+    return {{GL_VERTEX_SHADER, std::move(source.VertexSource)}, {GL_FRAGMENT_SHADER, std::move(source.FragmentSource)}};
+}
+
+auto is_linked(uint program) -> bool
+{
+    int result{};
+    glGetProgramiv(program, GL_LINK_STATUS, &result);
+
+    return result == GL_TRUE;
 }
 
-auto ParseShader(const std::string& vertexPath, const std::string& fragmentPath) -> ShaderProgramSource
+auto ReportProgram(uint program) -> void
 {
-    std::ifstream vertexStream(vertexPath);
-    std::ifstream fragmentStream(fragmentPath);
+    int length{};
+    glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+    std::string message(length, '\0');
 
-    if (!vertexStream)
-        throw std::runtime_error("Failed to open vertex shader file");
-    if (!fragmentStream)
-        throw std::runtime_error("Failed to open fragment shader file");
+    glGetProgramInfoLog(program, length, &length, message.data());
+    std::cout << "Failed to link program:\n" << message << std::endl;
+}
 
-    std::stringstream vertexSS, fragmentSS;
-    std::string line;
+// Drivers without any binary format (or with binaries disabled) always compile
+auto binary_formats() -> std::vector<int>
+{
+    int count{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
 
-    while (std::getline(vertexStream, line))
-        vertexSS << line << '\n';
-    while (std::getline(fragmentStream, line))
-        fragmentSS << line << '\n';
+    std::vector<int> formats(std::max(count, 0));
+    if (!formats.empty())
+        glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
 
-    return { vertexSS.str(), fragmentSS.str() };
+    return formats;
 }
 
-auto CreateShader(const std::string& vertexShader, const std::string& fragmentShader) -> uint
+// Binaries are only valid for the same driver, a driver update changes the version string
+auto program_hash(const std::vector<Stage>& stages, const std::vector<int>& formats) -> uint64_t
 {
-    uint program = glCreateProgram();
-    uint vs = CompileShader(vertexShader, GL_VERTEX_SHADER);
-    uint fs = CompileShader(fragmentShader, GL_FRAGMENT_SHADER);
+    uint64_t hash = fnv1a(FnvOffset, {reinterpret_cast<const char*>(&Version), sizeof(Version)});   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
 
-    // Link shaders
-    glAttachShader(program, vs);
-    glAttachShader(program, fs);
-    glLinkProgram(program);
-    glValidateProgram(program);
+    for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION})
+        if (const auto* string = reinterpret_cast<const char*>(glGetString(name)))    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+            hash = fnv1a(hash, string);
 
-    // Delete shaders
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+    hash = fnv1a(hash, {reinterpret_cast<const char*>(formats.data()), formats.size() * sizeof(int)});  // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+    for (const Stage& stage : stages)
+    {
+        hash = fnv1a(hash, {reinterpret_cast<const char*>(&stage.type), sizeof(stage.type)});   // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+        hash = fnv1a(hash, stage.source);
+    }
+
+    return hash;
+}
+
+// Returns 0 when there is no usable binary, the program is then compiled
+auto LoadProgramBinary(const std::filesystem::path& path, uint64_t hash) -> uint
+{
+    PROFILE_ZONE("Shader::LoadProgramBinary");
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return 0;
+
+    std::array<char, 4> magic{};
+    uint version{}, format{}, size{};
+    uint64_t fileHash{};
+
+    file.read(magic.data(), magic.size());
+    read_value(file, version);
+    read_value(file, fileHash);
+    read_value(file, format);
+    read_value(file, size);
+
+    if (!file || magic != Magic || version != Version || fileHash != hash)
+        return 0;
+
+    std::vector<char> binary(size);
+    file.read(binary.data(), size);
+    if (!file)
+        return 0;
+
+    const uint program = glCreateProgram();
+    glProgramBinary(program, format, binary.data(), static_cast<int>(size));
+
+    // Rejected binaries aren't an error, the driver may have changed in a way the hash didn't catch
+    if (!is_linked(program))
+    {
+        cacheStats.rejected++;
+        glDeleteProgram(program);
+        return 0;
+    }
 
     return program;
 }
 
+struct ProgramBinary
+{
+    GLenum format{};
+    std::vector<char> data{};
+};
+
+// Copy of what the driver keeps anyway, writing it to disk is left to WriteProgramBinary
+auto GetProgramBinary(uint program) -> ProgramBinary
+{
+    int length{};
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return {};
+
+    ProgramBinary binary{0, std::vector<char>(length)};
+    glGetProgramBinary(program, length, &length, &binary.format, binary.data.data());
+    binary.data.resize(std::max(length, 0));
+
+    return binary;
+}
+
+// Doesn't touch GL, can run on any thread
+auto WriteProgramBinary(const std::filesystem::path& path, uint64_t hash, const ProgramBinary& binary) -> void
+{
+    if (binary.data.empty())
+        return;
+
+    // A cache that can't be written only costs the next start another compile
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!error && file)
+    {
+        file.write(Magic.data(), Magic.size());
+        write_value(file, Version);
+        write_value(file, hash);
+        write_value(file, static_cast<uint>(binary.format));
+        write_value(file, static_cast<uint>(binary.data.size()));
+        file.write(binary.data.data(), static_cast<std::streamsize>(binary.data.size()));
+    }
+
+    if (error || !file)
+        std::cerr << "Failed to write program cache " << path << std::endl;
+}
+
+// Samplers and images are set as a single int
+auto type_size(uint type) -> uint
+{
+    switch (type)
+    {
+        case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: case GL_BOOL:
+            return 4;
+        case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2: case GL_DOUBLE:
+            return 8;
+        case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:
+            return 12;
+        case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: case GL_DOUBLE_VEC2: case GL_FLOAT_MAT2:
+            return 16;
+        case GL_DOUBLE_VEC3: case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2:
+            return 24;
+        case GL_DOUBLE_VEC4: case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2:
+            return 32;
+        case GL_FLOAT_MAT3:
+            return 36;
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3:
+            return 48;
+        case GL_FLOAT_MAT4:
+            return 64;
+        default:
+            return 4;
+    }
+}
+
+auto is_float(uint type) -> bool
+{
+    switch (type)
+    {
+        case GL_FLOAT: case GL_FLOAT_VEC2: case GL_FLOAT_VEC3: case GL_FLOAT_VEC4:
+        case GL_DOUBLE: case GL_DOUBLE_VEC2: case GL_DOUBLE_VEC3: case GL_DOUBLE_VEC4:
+        case GL_FLOAT_MAT2: case GL_FLOAT_MAT3: case GL_FLOAT_MAT4:
+        case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x2: case GL_FLOAT_MAT4x3:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// NOLINTBEGIN (bugprone-branch-clone)
+auto upload(int location, uint type, const void* data) -> void
+{
+    const auto* f = static_cast<const float*>(data);
+    const auto* d = static_cast<const double*>(data);
+    const auto* i = static_cast<const int*>(data);
+    const auto* u = static_cast<const uint*>(data);
+
+    switch (type)
+    {
+        case GL_FLOAT: glUniform1fv(location, 1, f); break;
+        case GL_FLOAT_VEC2: glUniform2fv(location, 1, f); break;
+        case GL_FLOAT_VEC3: glUniform3fv(location, 1, f); break;
+        case GL_FLOAT_VEC4: glUniform4fv(location, 1, f); break;
+
+        case GL_DOUBLE: glUniform1dv(location, 1, d); break;
+        case GL_DOUBLE_VEC2: glUniform2dv(location, 1, d); break;
+        case GL_DOUBLE_VEC3: glUniform3dv(location, 1, d); break;
+        case GL_DOUBLE_VEC4: glUniform4dv(location, 1, d); break;
+
+        case GL_INT_VEC2: case GL_BOOL_VEC2: glUniform2iv(location, 1, i); break;
+        case GL_INT_VEC3: case GL_BOOL_VEC3: glUniform3iv(location, 1, i); break;
+        case GL_INT_VEC4: case GL_BOOL_VEC4: glUniform4iv(location, 1, i); break;
+
+        case GL_UNSIGNED_INT: glUniform1uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC2: glUniform2uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC3: glUniform3uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC4: glUniform4uiv(location, 1, u); break;
+
+        case GL_FLOAT_MAT2: glUniformMatrix2fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3: glUniformMatrix3fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4: glUniformMatrix4fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x3: glUniformMatrix2x3fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x4: glUniformMatrix2x4fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x2: glUniformMatrix3x2fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x4: glUniformMatrix3x4fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x2: glUniformMatrix4x2fv(location, 1, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x3: glUniformMatrix4x3fv(location, 1, GL_FALSE, f); break;
+
+        // int, bool, samplers and images
+        default: glUniform1iv(location, 1, i); break;
+    }
+}
+// NOLINTEND
+
 } // namespace
 
 namespace Renderer::GPU
 {
     
-Shader::Shader(const std::filesystem::path& fpath): m_FilePath(fpath) 
+Shader::Shader(const std::filesystem::path& fpath) :
+    m_sources{fpath},
+    m_cacheName{fpath.extension() == ".comp" ? fpath.filename().string() : fpath.stem().string()}
 {
-    ShaderProgramSource source = ParseShader(fpath);
-    m_id = CreateShader(source.VertexSource, source.FragmentSource);
+    submit();
+    liveShaders.push_back(this);
 }
-    
-Shader::Shader(const std::filesystem::path& vertex_path, const std::filesystem::path& fragment_path)
+
+Shader::Shader(const std::filesystem::path& vertex_path, const std::filesystem::path& fragment_path) :
+    m_sources{vertex_path, fragment_path},
+    m_cacheName{std::format("{}-{}", vertex_path.stem().string(), fragment_path.stem().string())}
 {
-    ShaderProgramSource source = ParseShader(vertex_path, fragment_path);
-    m_id = CreateShader(source.VertexSource, source.FragmentSource);
+    submit();
+    liveShaders.push_back(this);
 }
-    
+
 Shader::~Shader() {
+    std::erase(liveShaders, this);
+
+    if (m_unsaved)
+        WriteProgramBinary(m_unsaved->path, m_unsaved->hash, GetProgramBinary(m_id));
+
+    discard();
+    StateCache::Get().ForgetProgram(m_id);
     glDeleteProgram(m_id);
 }
-    
-auto Shader::Bind() const -> void {
-    glUseProgram(m_id);
+
+auto Shader::Bind() -> void {
+    // Without a program yet there is nothing to draw with but the pending one
+    poll(m_id == 0);
+    StateCache::Get().UseProgram(m_id);
 }
-    
+
 auto Shader::Unbind() const -> void {
-    glUseProgram(0);
+    StateCache::Get().UseProgram(0);
 }
-    
-auto Shader::GetUniformLocation(const std::string& name) -> uint
+
+auto Shader::Wait() -> void
 {
-    if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
-        return m_UniformLocationCache[name];
-    
-    uint location = glGetUniformLocation(m_id, name.c_str());
-    if (location == -1)
-        std::cout << "Warning: uniform '" << name << "' doesn't exist!" << std::endl;
-    
-    m_UniformLocationCache[name] = location;
-    return location;
+    poll(true);
 }
 
-// NOLINTBEGIN (bugprone-branch-clone)
-template<typename... Args>
-auto Shader::SetUniform(const std::string& name, Args... args) -> void
+auto Shader::Reload() -> void
 {
-    const uint location = GetUniformLocation(name);
-    
-    if constexpr(std::conjunction_v<std::is_same<Args,bool>...>){    // Handling bools
-        if constexpr(sizeof...(args) == 1) glUniform1i(location, args...);
-        else if constexpr(sizeof...(args) == 2) glUniform2i(location, args...);
-        else if constexpr(sizeof...(args) == 3) glUniform3i(location, args...);
-        else if constexpr(sizeof...(args) == 4) glUniform4i(location, args...);
+    try
+    {
+        submit();
     }
-    
-    else if constexpr(std::conjunction_v<std::is_same<Args,int>...>){    // ints
-        if constexpr(sizeof...(args) == 1) glUniform1i(location, args...);
-        else if constexpr(sizeof...(args) == 2) glUniform2i(location, args...);
-        else if constexpr(sizeof...(args) == 3) glUniform3i(location, args...);
-        else if constexpr(sizeof...(args) == 4) glUniform4i(location, args...);
+    catch (const std::runtime_error& error)
+    {
+        std::cerr << "Failed to reload " << m_cacheName << ": " << error.what() << std::endl;
     }
-    
-    else if constexpr(std::conjunction_v<std::is_same<Args,uint>...>){    // uints
-        if constexpr(sizeof...(args) == 1) glUniform1ui(location, args...);
-        else if constexpr(sizeof...(args) == 2) glUniform2ui(location, args...);
-        else if constexpr(sizeof...(args) == 3) glUniform3ui(location, args...);
-        else if constexpr(sizeof...(args) == 4) glUniform4ui(location, args...);
+}
+
+auto Shader::ReloadChanged(const std::vector<std::filesystem::path>& files) -> uint
+{
+    const auto changed = [&files](const std::filesystem::path& source) {
+        return std::ranges::any_of(files, [&source](const std::filesystem::path& file) {
+            std::error_code error;
+            return std::filesystem::equivalent(source, file, error);
+        });
+    };
+
+    uint reloaded = 0;
+    for (Shader* shader : liveShaders)
+    {
+        if (std::ranges::none_of(shader->m_sources, changed))
+            continue;
+
+        shader->Reload();
+        reloaded++;
     }
-    
-    else if constexpr(std::conjunction_v<std::is_same<Args,float>...>){    // floats
-        if constexpr(sizeof...(args) == 1) glUniform1f(location, args...);
-        else if constexpr(sizeof...(args) == 2) glUniform2f(location, args...);
-        else if constexpr(sizeof...(args) == 3) glUniform3f(location, args...);
-        else if constexpr(sizeof...(args) == 4) glUniform4f(location, args...);
+
+    return reloaded;
+}
+
+auto Shader::SaveCache(JobSystem* jobs) -> void
+{
+    PROFILE_ZONE("Shader::SaveCache");
+
+    // Without workers jobs only run while someone waits, files are then written here
+    const bool workers = jobs != nullptr && jobs->getThreadCount() > 1;
+
+    for (Shader* shader : liveShaders)
+    {
+        if (!shader->m_unsaved)
+            continue;
+
+        auto write = [entry = std::move(*shader->m_unsaved), binary = GetProgramBinary(shader->m_id)]() {
+            WriteProgramBinary(entry.path, entry.hash, binary);
+        };
+        shader->m_unsaved.reset();
+
+        if (workers)
+            jobs->schedule(std::move(write));
+        else
+            write();
     }
+}
+
+auto Shader::GetCacheStats() -> const CacheStats&
+{
+    return cacheStats;
+}
+
+auto Shader::ResetCacheStats() -> void
+{
+    cacheStats = {};
+}
     
-    else if constexpr(std::conjunction_v<std::is_same<Args,double>...>){    // doubles
-        if constexpr(sizeof...(args) == 1) glUniform1d(location, args...);
-        else if constexpr(sizeof...(args) == 2) glUniform2d(location, args...);
-        else if constexpr(sizeof...(args) == 3) glUniform3d(location, args...);
-        else if constexpr(sizeof...(args) == 4) glUniform4d(location, args...);
+template<typename T>
+auto Shader::GetUniform(UniformId id) -> Uniform<T>
+{
+    static_assert(UniformType<T> != 0, "Type has no matching GLSL type");
+
+    const uint index = findUniform(id);
+    if (index == NoUniform)
+        return {};
+
+    const uint type = m_uniforms[index].type;
+    const bool matches = type == UniformType<T> || (std::is_same_v<T, int> && m_uniforms[index].size == sizeof(int) && !is_float(type));
+
+    if (!matches)
+    {
+        std::cout << "Warning: uniform '" << id.name << "' has another type!" << std::endl;
+        return {};
     }
+
+    return {index};
+}
+
+template auto Shader::GetUniform(UniformId id) -> Uniform<float>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<int>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<uint>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::vec2>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::vec3>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::vec4>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::uvec2>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::uvec4>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::mat3>;
+template auto Shader::GetUniform(UniformId id) -> Uniform<glm::mat4>;
+
+template<typename... Args>
+auto Shader::SetUniform(UniformId id, Args... args) -> void
+{
+    PROFILE_ZONE("Shader::SetUniform");
+
+    const uint index = findUniform(id);
+    if (index == NoUniform)
+        return;
+
+    // Bools are uploaded as ints, that's also how GLSL bools are stored
+    using Value = std::conditional_t<std::conjunction_v<std::is_same<Args, bool>...>, int, std::common_type_t<Args...>>;
+    const std::array<Value, sizeof...(Args)> values{static_cast<Value>(args)...};
+
+    setValue(index, values.data(), sizeof(values));
 }
-// NOLINTEND
 
 #define INSTANTIATE_SET_UNIFORM(type) \
-    template auto Shader::SetUniform(const std::string& name, type) -> void; \
-    template auto Shader::SetUniform(const std::string& name, type, type) -> void; \
-    template auto Shader::SetUniform(const std::string& name, type, type, type) -> void; \
-    template auto Shader::SetUniform(const std::string& name, type, type, type, type) -> void;
+    template auto Shader::SetUniform(UniformId id, type) -> void; \
+    template auto Shader::SetUniform(UniformId id, type, type) -> void; \
+    template auto Shader::SetUniform(UniformId id, type, type, type) -> void; \
+    template auto Shader::SetUniform(UniformId id, type, type, type, type) -> void;
     
 INSTANTIATE_SET_UNIFORM(bool)
 INSTANTIATE_SET_UNIFORM(int)
@@ -232,32 +585,19 @@ INSTANTIATE_SET_UNIFORM(double)
 #undef INSTANTIATE_SET_UNIFORM
     
 template<typename Matrix>
-auto Shader::SetUniformM(const std::string& name, const Matrix& matrix) -> void
+auto Shader::SetUniformM(UniformId id, const Matrix& matrix) -> void
 {
-    const uint location = GetUniformLocation(name);
-    
-    if constexpr(std::is_same_v<Matrix, glm::mat2>)
-        glUniformMatrix2fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat3>)
-        glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat4>)
-        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat2x3>)
-        glUniformMatrix2x3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat2x4>)
-        glUniformMatrix2x4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat3x2>)
-        glUniformMatrix3x2fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat3x4>)
-        glUniformMatrix3x4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat4x2>)
-        glUniformMatrix4x2fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-    else if constexpr(std::is_same_v<Matrix, glm::mat4x3>)
-        glUniformMatrix4x3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    PROFILE_ZONE("Shader::SetUniformM");
+
+    const uint index = findUniform(id);
+    if (index == NoUniform)
+        return;
+
+    setValue(index, glm::value_ptr(matrix), sizeof(Matrix));
 }
     
 #define INSTANTIATE_SET_UNIFORM_MATRIX(type) \
-    template auto Shader::SetUniformM(const std::string& name, const type&) -> void;
+    template auto Shader::SetUniformM(UniformId id, const type&) -> void;
     
 INSTANTIATE_SET_UNIFORM_MATRIX(glm::mat2)
 INSTANTIATE_SET_UNIFORM_MATRIX(glm::mat3)
@@ -273,5 +613,249 @@ INSTANTIATE_SET_UNIFORM_MATRIX(glm::mat4x2)
 INSTANTIATE_SET_UNIFORM_MATRIX(glm::mat4x3)
     
 #undef INSTANTIATE_SET_UNIFORM_MATRIX
+
+    /**   PRIVATE   **/
+
+auto Shader::submit() -> void
+{
+    PROFILE_ZONE("Shader::submit");
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const std::vector<Stage> stages = ReadStages(m_sources);
+    const std::vector<int> formats = binary_formats();
+    const uint64_t hash = program_hash(stages, formats);
+    const std::filesystem::path cachePath = ProgramCacheDirectory / std::format("{}-{:016x}.bin", m_cacheName, hash);
+
+    // Only the newest sources matter, an older program still compiling is dropped
+    discard();
+
+    if (!formats.empty())
+    {
+        if (const uint program = LoadProgramBinary(cachePath, hash); program != 0)
+        {
+            cacheStats.loaded++;
+            cacheStats.loadMs += elapsed_ms(start);
+
+            replace(program);
+            return;
+        }
+    }
+
+    Pending pending{glCreateProgram(), {}, hash, formats.empty() ? std::filesystem::path{} : cachePath, start};
+
+    for (const Stage& stage : stages)
+    {
+        pending.shaders.push_back(CompileShader(stage.source, stage.type));
+        glAttachShader(pending.program, pending.shaders.back());
+    }
+
+    if (!formats.empty())
+        glProgramParameteri(pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+    glLinkProgram(pending.program);
+
+    m_pending = std::move(pending);
+}
+
+auto Shader::poll(bool wait) -> void
+{
+    if (!m_pending)
+        return;
+
+    // Without the extension there is no way to ask, the status query below waits
+    if (!wait && Extensions::Get().HasParallelShaderCompile())
+    {
+        int completed{};
+        glGetProgramiv(m_pending->program, Extensions::CompletionStatus, &completed);
+        if (completed == GL_FALSE)
+            return;
+    }
+
+    PROFILE_ZONE("Shader::poll");
+
+    const Pending pending = std::move(*m_pending);
+    m_pending.reset();
+
+    const bool linked = is_linked(pending.program);
+
+    for (const uint shader : pending.shaders)
+    {
+        if (!linked)
+            ReportShader(shader);
+
+        glDetachShader(pending.program, shader);
+        glDeleteShader(shader);
+    }
+
+    if (!linked)
+    {
+        ReportProgram(pending.program);
+        glDeleteProgram(pending.program);
+        return;
+    }
+
+    cacheStats.compiled++;
+    cacheStats.compileMs += elapsed_ms(pending.start);
+
+    replace(pending.program);
+
+    // Saved by SaveCache, this may be the Bind of a frame that shouldn't wait for the disk
+    if (!pending.cachePath.empty())
+        m_unsaved = {pending.cachePath, pending.hash};
+}
+
+auto Shader::discard() -> void
+{
+    if (!m_pending)
+        return;
+
+    for (const uint shader : m_pending->shaders)
+        glDeleteShader(shader);
+
+    glDeleteProgram(m_pending->program);
+    m_pending.reset();
+}
+
+auto Shader::replace(uint program) -> void
+{
+    // Blocks are bound by name, every program sees the same Camera, Frame and Lighting buffers
+    bind_blocks(program);
+
+    // Uniforms are uploaded while the new program is bound, whatever was bound before is bound again after.
+    // If that was the replaced program, its replacement takes its place
+    auto& cache = StateCache::Get();
+    const uint previousProgram = cache.GetProgram();
+    const bool wasBound = m_id != 0 && previousProgram == m_id;
+
+    if (m_id != 0)
+    {
+        cache.ForgetProgram(m_id);
+        glDeleteProgram(m_id);
+    }
+
+    m_id = program;
+    m_unsaved.reset();
+
+    // Locations are those of the new program, values are carried over by name and type,
+    // a reloaded program would otherwise lose uniforms set only once
+    const std::vector<UniformInfo> previous = std::exchange(m_uniforms, {});
+    const std::vector<uchar> previousValues = std::exchange(m_values, {});
+    m_missing.clear();
+    reflectUniforms();
+
+    bool bound = false;
+    for (UniformInfo& uniform : m_uniforms)
+    {
+        const auto it = std::ranges::lower_bound(previous, uniform.hash, {}, &UniformInfo::hash);
+        if (it == previous.end() || it->hash != uniform.hash || it->type != uniform.type || !it->written)
+            continue;
+
+        if (!bound)
+            cache.UseProgram(m_id);
+        bound = true;
+
+        uchar* value = m_values.data() + uniform.offset;
+        std::memcpy(value, previousValues.data() + it->offset, uniform.size);
+        uniform.written = true;
+
+        upload(uniform.location, uniform.type, value);
+    }
+
+    if (bound || wasBound)
+        cache.UseProgram(wasBound ? m_id : previousProgram);
+}
+
+auto Shader::reflectUniforms() -> void
+{
+    PROFILE_ZONE("Shader::reflectUniforms");
+
+    int count{};
+    int maxLength{};
+    glGetProgramInterfaceiv(m_id, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+    glGetProgramInterfaceiv(m_id, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxLength);
+
+    constexpr std::array<GLenum, 4> Properties{GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE};
+    std::array<int, Properties.size()> values{};
+    std::string name(std::max(maxLength, 1), '\0');
+
+    const auto add = [this](std::string name, int location, uint type) {
+        const uint size = type_size(type);
+
+        m_uniforms.push_back({hash_uniform_name(name), location, type, size, static_cast<uint>(m_values.size()), false, false, std::move(name)});
+        m_values.resize(m_values.size() + size);
+    };
+
+    for (int i = 0; i < count; i++)
+    {
+        glGetProgramResourceiv(m_id, GL_UNIFORM, i, Properties.size(), Properties.data(), values.size(), nullptr, values.data());
+
+        // Members of uniform blocks have no location, they come from buffers
+        const auto [block, location, type, arraySize] = values;
+        if (block != -1 || location < 0)
+            continue;
+
+        int length{};
+        glGetProgramResourceName(m_id, GL_UNIFORM, i, name.size(), &length, name.data());
+        std::string_view base{name.data(), static_cast<std::size_t>(length)};
+
+        // Arrays are reported once as "name[0]", elements have consecutive locations
+        if (!base.ends_with("[0]"))
+        {
+            add(std::string{base}, location, type);
+            continue;
+        }
+
+        base.remove_suffix(3);
+        for (int element = 0; element < arraySize; element++)
+            add(std::string{base} + '[' + std::to_string(element) + ']', location + element, type);
+    }
+
+    std::ranges::sort(m_uniforms, {}, &UniformInfo::hash);
+}
+
+auto Shader::findUniform(UniformId id) -> uint
+{
+    if (m_id == 0)
+        poll(true);
+
+    const auto it = std::ranges::lower_bound(m_uniforms, id.hash, {}, &UniformInfo::hash);
+    if (it != m_uniforms.end() && it->hash == id.hash)
+        return static_cast<uint>(it - m_uniforms.begin());
+
+    // Warned once per name, uniforms unused by the shader are removed by the compiler
+    if (std::ranges::find(m_missing, id.hash) == m_missing.end())
+    {
+        std::cout << "Warning: uniform '" << id.name << "' doesn't exist!" << std::endl;
+        m_missing.push_back(id.hash);
+    }
+
+    return NoUniform;
+}
+
+auto Shader::setValue(uint index, const void* data, uint size) -> void
+{
+    UniformInfo& uniform = m_uniforms[index];
+
+    if (size != uniform.size)
+    {
+        if (!uniform.warned)
+            std::cout << "Warning: uniform '" << uniform.name << "' is " << uniform.size << " bytes, set with " << size << std::endl;
+        uniform.warned = true;
+        return;
+    }
+
+    uchar* value = m_values.data() + uniform.offset;
+    const bool changed = !uniform.written || std::memcmp(value, data, size) != 0;
+
+    StateCache::Get().CountUniform(changed);
+    if (!changed)
+        return;
+
+    std::memcpy(value, data, size);
+    uniform.written = true;
+
+    upload(uniform.location, uniform.type, data);
+}
     
 } // namespace Renderer::GPU
@@ -0,0 +1,302 @@
+/**
+ * @file StateCache.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of StateCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/StateCache.hpp"
+
+#include <numeric>
+
+namespace Renderer::GPU
+{
+
+auto StateCache::Counters::totalIssued() const -> uint64_t
+{
+    return std::accumulate(issued.begin(), issued.end(), uint64_t{0});
+}
+
+auto StateCache::Counters::totalSkipped() const -> uint64_t
+{
+    return std::accumulate(skipped.begin(), skipped.end(), uint64_t{0});
+}
+
+auto StateCache::Get() -> StateCache&
+{
+    // Context can only be current on one thread, so one cache per thread is one cache per context
+    thread_local StateCache cache;
+    return cache;
+}
+
+auto StateCache::Reset() -> void
+{
+    m_program = Unknown;
+    m_vertexArray = Unknown;
+    m_framebuffer = Unknown;
+    m_buffers.fill(Unknown);
+    for (auto& target : m_bufferBases)
+        target.fill(Unknown);
+
+    m_activeTexture = Unknown;
+    for (auto& unit : m_textures)
+        unit.fill(Unknown);
+
+    m_capabilities.fill(Unknown);
+    m_blendFunc.fill(Unknown);
+    m_depthFunc = Unknown;
+    m_polygonMode = Unknown;
+}
+
+auto StateCache::UseProgram(uint program) -> void
+{
+    if (change(Call::Program, m_program, program))
+        glUseProgram(program);
+}
+
+auto StateCache::GetProgram() -> uint
+{
+    if (m_program == Unknown)
+    {
+        int program{};
+        glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+        m_program = static_cast<uint>(program);
+    }
+
+    return m_program;
+}
+
+auto StateCache::BindVertexArray(uint vertexArray) -> void
+{
+    if (!change(Call::VertexArray, m_vertexArray, vertexArray))
+        return;
+
+    glBindVertexArray(vertexArray);
+
+    // Element buffer binding belongs to the vertex array, it isn't known for the new one
+    m_buffers[find(BufferTargets, GL_ELEMENT_ARRAY_BUFFER)] = Unknown;
+}
+
+auto StateCache::BindBuffer(uint target, uint buffer) -> void
+{
+    const uint index = find(BufferTargets, target);
+
+    if (index == Unknown)
+    {
+        m_counters.issued[static_cast<uint>(Call::Buffer)]++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+
+    if (change(Call::Buffer, m_buffers[index], buffer))
+        glBindBuffer(target, buffer);
+}
+
+auto StateCache::BindBufferBase(uint target, uint index, uint buffer) -> void
+{
+    const uint indexed = find(IndexedBufferTargets, target);
+    const uint generic = find(BufferTargets, target);
+
+    if (indexed == Unknown || index >= MaxBufferBindings)
+    {
+        m_counters.issued[static_cast<uint>(Call::BufferBase)]++;
+        glBindBufferBase(target, index, buffer);
+
+        if (generic != Unknown)
+            m_buffers[generic] = buffer;
+        return;
+    }
+
+    if (!change(Call::BufferBase, m_bufferBases[indexed][index], buffer))
+        return;
+
+    glBindBufferBase(target, index, buffer);
+    m_buffers[generic] = buffer;
+}
+
+auto StateCache::BindBufferRange(uint target, uint index, uint buffer, uint offset, uint size) -> void
+{
+    const uint indexed = find(IndexedBufferTargets, target);
+    const uint generic = find(BufferTargets, target);
+
+    m_counters.issued[static_cast<uint>(Call::BufferBase)]++;
+    glBindBufferRange(target, index, buffer, offset, size);
+
+    if (indexed != Unknown && index < MaxBufferBindings)
+        m_bufferBases[indexed][index] = Unknown;
+    if (generic != Unknown)
+        m_buffers[generic] = buffer;
+}
+
+auto StateCache::BindFramebuffer(uint framebuffer) -> void
+{
+    if (change(Call::Framebuffer, m_framebuffer, framebuffer))
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+auto StateCache::ActiveTexture(uint unit) -> void
+{
+    if (change(Call::ActiveTexture, m_activeTexture, unit))
+        glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+auto StateCache::BindTexture(uint unit, uint target, uint texture) -> void
+{
+    const uint index = find(TextureTargets, target);
+
+    if (unit >= MaxTextureUnits || index == Unknown)
+    {
+        ActiveTexture(unit);
+        m_counters.issued[static_cast<uint>(Call::Texture)]++;
+        glBindTexture(target, texture);
+        return;
+    }
+
+    if (!change(Call::Texture, m_textures[unit][index], texture))
+        return;
+
+    ActiveTexture(unit);
+    glBindTexture(target, texture);
+}
+
+auto StateCache::SetCapability(uint capability, bool enabled) -> void
+{
+    const uint index = find(Capabilities, capability);
+
+    if (index != Unknown && !change(Call::Capability, m_capabilities[index], enabled))
+        return;
+
+    if (index == Unknown)
+        m_counters.issued[static_cast<uint>(Call::Capability)]++;
+
+    if (enabled)
+        glEnable(capability);
+    else
+        glDisable(capability);
+}
+
+auto StateCache::BlendFunc(uint source, uint destination) -> void
+{
+    constexpr uint call = static_cast<uint>(Call::BlendFunc);
+
+    if (m_blendFunc[0] == source && m_blendFunc[1] == destination)
+    {
+        m_counters.skipped[call]++;
+        return;
+    }
+
+    m_counters.issued[call]++;
+    m_blendFunc = {source, destination};
+    glBlendFunc(source, destination);
+}
+
+auto StateCache::DepthFunc(uint function) -> void
+{
+    if (change(Call::DepthFunc, m_depthFunc, function))
+        glDepthFunc(function);
+}
+
+auto StateCache::PolygonMode(uint mode) -> void
+{
+    if (change(Call::PolygonMode, m_polygonMode, mode))
+        glPolygonMode(GL_FRONT_AND_BACK, mode);
+}
+
+// Deleting a bound object resets its binding to 0 in GL, cached value has to follow
+auto StateCache::ForgetProgram(uint program) -> void
+{
+    if (m_program == program)
+        m_program = Unknown;
+}
+
+auto StateCache::ForgetVertexArray(uint vertexArray) -> void
+{
+    if (m_vertexArray != vertexArray)
+        return;
+
+    m_vertexArray = Unknown;
+    m_buffers[find(BufferTargets, GL_ELEMENT_ARRAY_BUFFER)] = Unknown;
+}
+
+auto StateCache::ForgetBuffer(uint buffer) -> void
+{
+    for (auto& bound : m_buffers)
+        if (bound == buffer)
+            bound = Unknown;
+
+    for (auto& target : m_bufferBases)
+        for (auto& bound : target)
+            if (bound == buffer)
+                bound = Unknown;
+}
+
+auto StateCache::ForgetFramebuffer(uint framebuffer) -> void
+{
+    if (m_framebuffer == framebuffer)
+        m_framebuffer = Unknown;
+}
+
+auto StateCache::ForgetTexture(uint texture) -> void
+{
+    for (auto& unit : m_textures)
+        for (auto& bound : unit)
+            if (bound == texture)
+                bound = Unknown;
+}
+
+auto StateCache::to_string(Call call) -> const char*
+{
+    switch (call)
+    {
+        case Call::Program: return "program";
+        case Call::VertexArray: return "vertex array";
+        case Call::Buffer: return "buffer";
+        case Call::BufferBase: return "buffer base";
+        case Call::Framebuffer: return "framebuffer";
+        case Call::ActiveTexture: return "active texture";
+        case Call::Texture: return "texture";
+        case Call::Capability: return "capability";
+        case Call::BlendFunc: return "blend func";
+        case Call::DepthFunc: return "depth func";
+        case Call::PolygonMode: return "polygon mode";
+        case Call::Uniform: return "uniform";
+        case Call::Count: break;
+    }
+
+    return "unknown";
+}
+
+    /**   PRIVATE   **/
+
+StateCache::StateCache()
+{
+    Reset();
+}
+
+auto StateCache::change(Call call, uint& cached, uint value) -> bool
+{
+    if (cached == value)
+    {
+        m_counters.skipped[static_cast<uint>(call)]++;
+        return false;
+    }
+
+    m_counters.issued[static_cast<uint>(call)]++;
+    cached = value;
+    return true;
+}
+
+template<std::size_t N>
+auto StateCache::find(const std::array<uint, N>& list, uint value) -> uint
+{
+    for (uint i = 0; i < N; i++)
+        if (list[i] == value)
+            return i;
+
+    return Unknown;
+}
+
+} // namespace Renderer::GPU
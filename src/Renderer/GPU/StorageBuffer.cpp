@@ -0,0 +1,68 @@
+/**
+ * @file StorageBuffer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of StorageBuffer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/StorageBuffer.hpp"
+
+#include <glad/gl.h>
+
+#include "Renderer/GPU/StateCache.hpp"
+
+namespace Renderer::GPU
+{
+
+StorageBuffer::StorageBuffer(const void* data, uint size) :
+    m_size{size}
+{
+    glGenBuffers(1, &m_id);
+    Bind(GL_SHADER_STORAGE_BUFFER);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+StorageBuffer::~StorageBuffer()
+{
+    StateCache::Get().ForgetBuffer(m_id);
+    glDeleteBuffers(1, &m_id);
+}
+
+auto StorageBuffer::SetData(const void* data, uint size) -> void
+{
+    m_size = size;
+    Bind(GL_SHADER_STORAGE_BUFFER);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+auto StorageBuffer::SetSubData(uint offset, const void* data, uint size) -> void
+{
+    Bind(GL_SHADER_STORAGE_BUFFER);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, data);
+}
+
+// Copy and read back go through DSA (GL 4.5), so no binding has to change
+auto StorageBuffer::CopyFrom(const StorageBuffer& source, uint size) -> void
+{
+    glCopyNamedBufferSubData(source.m_id, m_id, 0, 0, size);
+}
+
+auto StorageBuffer::GetSubData(uint offset, void* data, uint size) const -> void
+{
+    glGetNamedBufferSubData(m_id, offset, size, data);
+}
+
+auto StorageBuffer::BindBase(uint index) const -> void
+{
+    StateCache::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, index, m_id);
+}
+
+auto StorageBuffer::Bind(uint target) const -> void
+{
+    StateCache::Get().BindBuffer(target, m_id);
+}
+
+} // namespace Renderer::GPU
@@ -0,0 +1,153 @@
+/**
+ * @file StreamBuffer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of StreamBuffer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/StreamBuffer.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+
+#include "Profiler.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+
+namespace
+{
+    // Regions start at multiples of this, larger than any uniform buffer offset alignment in practice
+    constexpr uint RegionAlignment = 256;
+
+    // Commands are flushed on the first wait only, later waits poll in steps of this
+    constexpr uint64_t WaitStepNs = 1'000'000;
+
+    constexpr GLbitfield MapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+}   // namespace
+
+namespace Renderer::GPU
+{
+
+StreamBuffer::StreamBuffer(uint regionSize, uint regions) :
+    m_regionSize{(std::max(regionSize, 1u) + RegionAlignment - 1) / RegionAlignment * RegionAlignment},
+    m_fences(std::max(regions, 1u), nullptr),
+    // First BeginFrame moves to region 0
+    m_region{static_cast<uint>(m_fences.size()) - 1}
+{
+    const uint size = m_regionSize * m_fences.size();
+
+    glGenBuffers(1, &m_id);
+    Bind(GL_COPY_WRITE_BUFFER);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, MapFlags);
+    m_data = static_cast<uchar*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, MapFlags));
+
+    if (m_data == nullptr)
+        std::cerr << "Failed to map stream buffer of " << size << " bytes" << std::endl;
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    for (const GLsync fence : m_fences)
+        if (fence != nullptr)
+            glDeleteSync(fence);
+
+    // Deleting a mapped buffer unmaps it
+    StateCache::Get().ForgetBuffer(m_id);
+    glDeleteBuffers(1, &m_id);
+}
+
+auto StreamBuffer::IsSupported() -> bool
+{
+    return GLAD_GL_VERSION_4_4 != 0;
+}
+
+auto StreamBuffer::BeginFrame() -> void
+{
+    // Region of a frame that wasn't ended still has to be fenced before it's reused
+    if (m_inFrame)
+        EndFrame();
+
+    m_region = (m_region + 1) % m_fences.size();
+    m_used = 0;
+    m_inFrame = true;
+    m_stats.lastWaitMs = 0.0;
+
+    GLsync& fence = m_fences[m_region];
+    if (fence == nullptr)
+        return;
+
+    // Usual case, the GPU is done with the frame from regions ago
+    GLenum status = glClientWaitSync(fence, 0, 0);
+
+    if (status == GL_TIMEOUT_EXPIRED)
+    {
+        PROFILE_ZONE("StreamBuffer::wait");
+
+        const auto start = std::chrono::steady_clock::now();
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+        do {
+            status = glClientWaitSync(fence, flags, WaitStepNs);
+            flags = 0;
+        } while (status == GL_TIMEOUT_EXPIRED);
+
+        const double waited = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        m_stats.waits++;
+        m_stats.lastWaitMs = waited;
+        m_stats.totalWaitMs += waited;
+        m_stats.maxWaitMs = std::max(m_stats.maxWaitMs, waited);
+    }
+
+    if (status == GL_WAIT_FAILED)
+        std::cerr << "Waiting for stream buffer region " << m_region << " failed" << std::endl;
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+auto StreamBuffer::EndFrame() -> void
+{
+    if (!m_inFrame)
+        return;
+
+    m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_inFrame = false;
+}
+
+auto StreamBuffer::Allocate(uint size, uint alignment) -> std::optional<Allocation>
+{
+    if (m_data == nullptr || !m_inFrame)
+        return std::nullopt;
+
+    alignment = std::max(alignment, 1u);
+
+    const uint start = regionStart();
+    const uint offset = (start + m_used + alignment - 1) / alignment * alignment;
+
+    if (offset + size > start + m_regionSize)
+    {
+        m_stats.overflows++;
+        return std::nullopt;
+    }
+
+    m_used = offset + size - start;
+    m_stats.peakBytes = std::max(m_stats.peakBytes, m_used);
+
+    return Allocation{m_data + offset, offset, size};
+}
+
+auto StreamBuffer::Bind(uint target) const -> void
+{
+    StateCache::Get().BindBuffer(target, m_id);
+}
+
+auto StreamBuffer::BindRange(uint target, uint index, const Allocation& allocation) const -> void
+{
+    StateCache::Get().BindBufferRange(target, index, m_id, allocation.offset, allocation.size);
+}
+
+} // namespace Renderer::GPU
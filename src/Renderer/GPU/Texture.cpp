@@ -10,30 +10,51 @@
  */
 #include "Renderer/GPU/Texture.hpp"
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#include "Profiler.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/Extensions.hpp"
 
 #include "jac/require.hpp"
 #include "jac/debug.hpp"
 
+namespace
+{
+
+// GLAD is generated for the core profile only, S3TC formats come from an extension
+constexpr uint CompressedRgbS3tcDxt1 = 0x83F0;
+constexpr uint CompressedRgbaS3tcDxt5 = 0x83F3;
+
+} // namespace
+
 namespace Renderer::GPU
 {
-    
-Texture::Texture(const std::filesystem::path& path)
+
+auto internal_format(Image::Format format) -> std::optional<uint>
 {
-    stbi_set_flip_vertically_on_load(true);
-    uchar* data = stbi_load(path.c_str(), &m_width, &m_height, &m_nrChannels, 0); // NOLINT (clang-analyzer-unix.Malloc)
-    
-    if (data == nullptr)
+    const bool s3tc = Extensions::Get().HasS3tc();
+
+    switch (format)
     {
-        std::cerr << "Failed to load texture" << std::endl;
-        return;
+        case Image::Format::RGBA8: return GL_RGBA8;
+        case Image::Format::BC1: return s3tc ? std::optional<uint>(CompressedRgbS3tcDxt1) : std::nullopt;
+        case Image::Format::BC3: return s3tc ? std::optional<uint>(CompressedRgbaS3tcDxt5) : std::nullopt;
+        case Image::Format::BC7: return GLAD_GL_VERSION_4_2 ? std::optional<uint>(GL_COMPRESSED_RGBA_BPTC_UNORM) : std::nullopt;
     }
 
-    if (m_nrChannels != 3 && m_nrChannels != 4)
+    return std::nullopt;
+}
+    
+Texture::Texture(const std::filesystem::path& path, JobSystem* jobs)
+{
+    PROFILE_ZONE("Texture::Texture");
+
+    const std::optional<Image::CookedTexture> cooked = path.extension() == Image::CookedExtension
+        ? Image::read_cooked(path)
+        : Image::cook_cached(path, std::nullopt, jobs);
+
+    if (!cooked || cooked->levels.empty())
     {
-        std::cerr << "Number of color channels should be either 3 or 4" << std::endl;
-        stbi_image_free(data);
+        std::cerr << "Failed to load texture" << std::endl;
         return;
     }
     
@@ -42,31 +63,23 @@ Texture::Texture(const std::filesystem::path& path)
     if (m_id == 0)
     {
         std::cerr << "Failed to generate texture" << std::endl;
-        stbi_image_free(data);
         return;
     }
     
-    glBindTexture(GL_TEXTURE_2D, m_id);
-    
-    int format = m_nrChannels == 4? GL_RGBA: GL_RGB;
-    
-    glTexImage2D(
-        GL_TEXTURE_2D, 0, format, m_width, m_height, 0, format, GL_UNSIGNED_BYTE, data
-    );
-    glGenerateMipmap(GL_TEXTURE_2D);
-    
-    stbi_image_free(data);
+    StateCache::Get().BindTexture(m_slot, GL_TEXTURE_2D, m_id);
+
+    loadCooked(*cooked);
 }
     
 Texture::~Texture()
 {
+    StateCache::Get().ForgetTexture(m_id);
     glDeleteTextures(1, &m_id);
 }
 
 auto Texture::Bind() const -> void
 {
-    glActiveTexture(GL_TEXTURE0 + m_slot);
-    glBindTexture(GL_TEXTURE_2D, m_id);
+    StateCache::Get().BindTexture(m_slot, GL_TEXTURE_2D, m_id);
 }
     
 auto Texture::Bind(uint slot) -> void
@@ -80,7 +93,43 @@ auto Texture::Bind(uint slot) -> void
     
 auto Texture::Unbind() const -> void
 {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateCache::Get().BindTexture(m_slot, GL_TEXTURE_2D, 0);
+}
+
+/**   PRIVATE   **/
+
+auto Texture::loadCooked(const Image::CookedTexture& texture) -> void
+{
+    m_width = static_cast<int>(texture.width);
+    m_height = static_cast<int>(texture.height);
+    m_nrChannels = texture.format == Image::Format::BC1 ? 3 : 4;
+
+    const std::optional<uint> internal = internal_format(texture.format);
+    if (!internal)
+        std::cerr << "Texture format " << Image::to_string(texture.format) << " isn't supported, decompressing on the CPU" << std::endl;
+
+    // Level data comes from client memory
+    StateCache::Get().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    for (uint i = 0; i < texture.levels.size(); i++)
+    {
+        const Image::CookedLevel& level = texture.levels[i];
+        const uchar* data = texture.data.data() + level.offset;
+        const int width = static_cast<int>(level.width);
+        const int height = static_cast<int>(level.height);
+
+        if (texture.format == Image::Format::RGBA8)
+            glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+        else if (internal)
+            glCompressedTexImage2D(GL_TEXTURE_2D, i, *internal, width, height, 0, static_cast<int>(level.size), data);
+        else
+        {
+            const Image::Bitmap decoded = Image::decompress(data, texture.format, level.width, level.height);
+            glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, decoded.pixels.data());
+        }
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<int>(texture.levels.size()) - 1);
 }
     
 } // namespace Renderer::GPU
@@ -0,0 +1,119 @@
+/**
+ * @file TextureArray.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of TextureArray class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/TextureArray.hpp"
+
+#include <iostream>
+
+#include "Profiler.hpp"
+#include "Image/Cook.hpp"
+#include "Renderer/GPU/Texture.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+
+#include "jac/require.hpp"
+#include "jac/debug.hpp"
+
+namespace Renderer::GPU
+{
+
+TextureArray::TextureArray(const std::vector<std::filesystem::path>& paths, JobSystem* jobs)
+{
+    PROFILE_ZONE("TextureArray::TextureArray");
+
+    if (paths.empty())
+    {
+        std::cerr << "Texture array needs at least one image" << std::endl;
+        return;
+    }
+
+    // Layers share one format, BC3 keeps alpha of the images that have it
+    const Image::Format format = internal_format(Image::Format::BC3) ? Image::Format::BC3 : Image::Format::RGBA8;
+
+    std::vector<Image::CookedTexture> layers;
+    layers.reserve(paths.size());
+
+    for (const auto& path : paths)
+    {
+        std::optional<Image::CookedTexture> layer = layers.empty() ?
+            Image::cook_cached(path, format, jobs) :
+            Image::cook_cached(path, format, jobs, layers.front().width, layers.front().height);
+
+        if (!layer || layer->levels.empty())
+        {
+            std::cerr << "Failed to load texture " << path << std::endl;
+            return;
+        }
+
+        layers.push_back(std::move(*layer));
+    }
+
+    glGenTextures(1, &m_id);
+
+    if (m_id == 0)
+    {
+        std::cerr << "Failed to generate texture" << std::endl;
+        return;
+    }
+
+    m_width = layers.front().width;
+    m_height = layers.front().height;
+    m_layers = layers.size();
+
+    auto& cache = StateCache::Get();
+    cache.BindTexture(m_slot, GL_TEXTURE_2D_ARRAY, m_id);
+    cache.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    const uint internal = *internal_format(format);
+    const uint levels = layers.front().levels.size();
+
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, internal, m_width, m_height, m_layers);
+
+    for (uint layer = 0; layer < m_layers; layer++)
+        for (uint i = 0; i < levels; i++)
+        {
+            const Image::CookedLevel& level = layers[layer].levels[i];
+            const uchar* data = layers[layer].data.data() + level.offset;
+
+            if (format == Image::Format::RGBA8)
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, layer, level.width, level.height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            else
+                glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, layer, level.width, level.height, 1, internal, level.size, data);
+        }
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+TextureArray::~TextureArray()
+{
+    StateCache::Get().ForgetTexture(m_id);
+    glDeleteTextures(1, &m_id);
+}
+
+auto TextureArray::Bind() const -> void
+{
+    StateCache::Get().BindTexture(m_slot, GL_TEXTURE_2D_ARRAY, m_id);
+}
+
+auto TextureArray::Bind(uint slot) -> void
+{
+    if constexpr(Debug)
+        JAC_REQUIRE(slot < 32);
+
+    m_slot = slot;
+    Bind();
+}
+
+auto TextureArray::Unbind() const -> void
+{
+    StateCache::Get().BindTexture(m_slot, GL_TEXTURE_2D_ARRAY, 0);
+}
+
+} // namespace Renderer::GPU
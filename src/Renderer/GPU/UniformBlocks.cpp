@@ -0,0 +1,41 @@
+/**
+ * @file UniformBlocks.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of block binding registry
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/UniformBlocks.hpp"
+
+#include <string>
+
+#include <glad/gl.h>
+
+namespace Renderer::GPU
+{
+
+auto bind_blocks(uint program) -> void
+{
+    for (const auto& block : UniformBlockBindings)
+    {
+        const uint index = glGetUniformBlockIndex(program, std::string{block.name}.c_str());
+        if (index != GL_INVALID_INDEX)
+            glUniformBlockBinding(program, index, block.binding);
+    }
+
+    // Storage blocks need program interface query (4.3), which is also when they were introduced
+    if (GLAD_GL_VERSION_4_3 == 0)
+        return;
+
+    for (const auto& block : StorageBlockBindings)
+    {
+        const uint index = glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, std::string{block.name}.c_str());
+        if (index != GL_INVALID_INDEX)
+            glShaderStorageBlockBinding(program, index, block.binding);
+    }
+}
+
+} // namespace Renderer::GPU
@@ -0,0 +1,59 @@
+/**
+ * @file UniformBuffer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of UniformBuffer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/GPU/UniformBuffer.hpp"
+
+#include <glad/gl.h>
+
+#include "Renderer/GPU/StateCache.hpp"
+
+namespace Renderer::GPU
+{
+
+UniformBuffer::UniformBuffer(const void* data, uint size) :
+    m_size{size}
+{
+    glGenBuffers(1, &m_id);
+    StateCache::Get().BindBuffer(GL_UNIFORM_BUFFER, m_id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+UniformBuffer::~UniformBuffer()
+{
+    StateCache::Get().ForgetBuffer(m_id);
+    glDeleteBuffers(1, &m_id);
+}
+
+auto UniformBuffer::GetOffsetAlignment() -> uint
+{
+    int alignment{};
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+    return alignment > 0 ? alignment : 256;
+}
+
+auto UniformBuffer::SetData(const void* data, uint size) -> void
+{
+    m_size = size;
+    StateCache::Get().BindBuffer(GL_UNIFORM_BUFFER, m_id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+auto UniformBuffer::BindBase(uint index) const -> void
+{
+    StateCache::Get().BindBufferBase(GL_UNIFORM_BUFFER, index, m_id);
+}
+
+auto UniformBuffer::BindRange(uint index, uint offset, uint size) const -> void
+{
+    StateCache::Get().BindBufferRange(GL_UNIFORM_BUFFER, index, m_id, offset, size);
+}
+
+} // namespace Renderer::GPU
@@ -10,6 +10,8 @@
  */
 #include "Renderer/GPU/VertexArray.hpp"
 
+#include "Renderer/GPU/StateCache.hpp"
+
 namespace Renderer::GPU
 {
     
@@ -20,6 +22,7 @@ VertexArray::VertexArray()
     
 VertexArray::~VertexArray() 
 {
+    StateCache::Get().ForgetVertexArray(m_id);
     glDeleteVertexArrays(1, &m_id);
 }
     
@@ -28,30 +31,62 @@ auto VertexArray::AddBuffer(const VertexBuffer& vb, const VertexBufferLayout& la
     Bind();
     vb.Bind();
     
-    const auto& elements = layout.GetElements();
-    uint offset = 0;
-    
-    for (uint i = 0; i < elements.size(); i++)
-    {
-        const auto& element = elements[i];
-        glEnableVertexAttribArray(i);
-        glVertexAttribPointer(
-            i, element.count, element.type, element.normalized, layout.GetStride(), reinterpret_cast<const void*>(offset)); // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
-        offset += element.count * VertexBufferElement::GetSizeOfType(element.type);
-    }
+    addAttributes(layout);
     
     vb.Unbind();
     Unbind();
 }
+
+auto VertexArray::AddBuffer(const StreamBuffer& sb, const VertexBufferLayout& layout) -> void
+{
+    Bind();
+    sb.Bind(GL_ARRAY_BUFFER);
+
+    addAttributes(layout);
+
+    StateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
+    Unbind();
+}
     
 auto VertexArray::Bind() const -> void
 {
-    glBindVertexArray(m_id);
+    StateCache::Get().BindVertexArray(m_id);
 }
     
 auto VertexArray::Unbind() const -> void
 {
-    glBindVertexArray(0);
+    StateCache::Get().BindVertexArray(0);
 }
     
+    /**   PRIVATE   **/
+
+auto VertexArray::addAttributes(const VertexBufferLayout& layout) -> void
+{
+    const auto& elements = layout.GetElements();
+    uint offset = 0;
+    
+    for (uint i = 0; i < elements.size(); i++)
+    {
+        const auto& element = elements[i];
+        const uint index = m_AttribCount + i;
+
+        glEnableVertexAttribArray(index);
+
+        // Unnormalized integers stay integers, glVertexAttribPointer would convert them to floats
+        if (VertexBufferElement::IsInteger(element.type) && element.normalized == GL_FALSE)
+            glVertexAttribIPointer(
+                index, element.count, element.type, layout.GetStride(), reinterpret_cast<const void*>(offset)); // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+        else
+            glVertexAttribPointer(
+                index, element.count, element.type, element.normalized, layout.GetStride(), reinterpret_cast<const void*>(offset)); // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+
+        if (layout.GetDivisor() != 0)
+            glVertexAttribDivisor(index, layout.GetDivisor());
+
+        offset += element.GetSize();
+    }
+
+    m_AttribCount += elements.size();
+}
+
 } // namespace Renderer::GPU
@@ -12,25 +12,33 @@
 
 #include <glad/gl.h>
 
+#include "Renderer/GPU/StateCache.hpp"
+
 namespace Renderer::GPU
 {
     
 VertexBuffer::VertexBuffer(const void* data, uint size) {
     glGenBuffers(1, &m_id);
-    glBindBuffer(GL_ARRAY_BUFFER, m_id);
-    glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), data, GL_STATIC_DRAW);
+    Bind();
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
 }
     
 VertexBuffer::~VertexBuffer() {
+    StateCache::Get().ForgetBuffer(m_id);
     glDeleteBuffers(1, &m_id);
 }
     
+auto VertexBuffer::SetData(const void* data, uint size) -> void {
+    Bind();
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_STREAM_DRAW);
+}
+    
 auto VertexBuffer::Bind() const -> void {
-    glBindBuffer(GL_ARRAY_BUFFER, m_id);
+    StateCache::Get().BindBuffer(GL_ARRAY_BUFFER, m_id);
 }
     
 auto VertexBuffer::Unbind() const -> void {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    StateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
 }
     
 } // namespace Renderer::GPU
@@ -20,10 +20,11 @@ auto VertexBufferLayout::Push<float>(uint count) -> void
     m_Stride += count * VertexBufferElement::GetSizeOfType(GL_FLOAT);
 }
     
+// Integer attribute (uint/uvec in shaders), e.g. indices
 template<>
 auto VertexBufferLayout::Push<uint>(uint count) -> void
 {
-    m_Elements.push_back({count, GL_UNSIGNED_INT, GL_TRUE});
+    m_Elements.push_back({count, GL_UNSIGNED_INT, GL_FALSE});
     m_Stride += count * VertexBufferElement::GetSizeOfType(GL_UNSIGNED_INT);
 }
     
@@ -34,4 +35,36 @@ auto VertexBufferLayout::Push<u_char>(uint count) -> void
     m_Stride += count * VertexBufferElement::GetSizeOfType(GL_UNSIGNED_BYTE);
 }
     
+// Signed normalized 16 bit, e.g. quaternions
+template<>
+auto VertexBufferLayout::Push<short>(uint count) -> void
+{
+    m_Elements.push_back({count, GL_SHORT, GL_TRUE});
+    m_Stride += count * VertexBufferElement::GetSizeOfType(GL_SHORT);
+}
+    
+// Integer attribute like Push<uint>, e.g. indices that fit 16 bits
+template<>
+auto VertexBufferLayout::Push<u_short>(uint count) -> void
+{
+    m_Elements.push_back({count, GL_UNSIGNED_SHORT, GL_FALSE});
+    m_Stride += count * VertexBufferElement::GetSizeOfType(GL_UNSIGNED_SHORT);
+}
+    
+template<>
+auto VertexBufferLayout::Push<Half>(uint count) -> void
+{
+    m_Elements.push_back({count, GL_HALF_FLOAT, GL_FALSE});
+    m_Stride += count * VertexBufferElement::GetSizeOfType(GL_HALF_FLOAT);
+}
+    
+// Whole x, y, z, w attribute in one 32 bit word, count has to be 4
+template<>
+auto VertexBufferLayout::Push<Snorm10x3>(uint count) -> void
+{
+    assert(count == 4);
+    m_Elements.push_back({count, GL_INT_2_10_10_10_REV, GL_TRUE});
+    m_Stride += VertexBufferElement::GetSizeOfType(GL_INT_2_10_10_10_REV);
+}
+    
 } // namespace Renderer::GPU
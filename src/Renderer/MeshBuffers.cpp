@@ -0,0 +1,53 @@
+/**
+ * @file MeshBuffers.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of mesh uploads
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/MeshBuffers.hpp"
+
+namespace Renderer
+{
+
+auto upload_mesh(std::span<const uchar> vertices, std::span<const uint> indices, const GPU::VertexBufferLayout& layout) -> MeshBuffers
+{
+    MeshBuffers buffers{layout};
+
+    buffers.vertices = std::make_unique<GPU::VertexBuffer>(vertices.data(), vertices.size());
+    buffers.vertexCount = layout.GetStride() != 0 ? vertices.size() / layout.GetStride() : 0;
+
+    if (!indices.empty())
+        buffers.indices = std::make_unique<GPU::IndexBuffer>(indices.data(), indices.size());
+
+    return buffers;
+}
+
+auto upload_mesh(const Mesh::MeshData& mesh) -> MeshBuffers
+{
+    return upload_mesh(mesh.vertices, mesh.indices, mesh.layout);
+}
+
+auto upload_mesh(const Mesh::MappedMesh& mesh) -> MeshBuffers
+{
+    return upload_mesh(mesh.getVertexData(), mesh.getIndices(), mesh.getLayout());
+}
+
+auto upload_mesh(const Mesh::ObjMesh& mesh) -> MeshBuffers
+{
+    GPU::VertexBufferLayout layout;
+    layout.Push<float>(3);  // position
+    layout.Push<float>(2);  // texture coordinates
+    layout.Push<float>(3);  // normal
+
+    const std::span<const uchar> vertices{
+        reinterpret_cast<const uchar*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(Mesh::ObjVertex)    // NOLINT (cppcoreguidelines-pro-type-reinterpret-cast)
+    };
+
+    return upload_mesh(vertices, mesh.indices, layout);
+}
+
+} // namespace Renderer
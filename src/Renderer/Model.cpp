@@ -0,0 +1,52 @@
+/**
+ * @file Model.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of model file reading
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Renderer/Model.hpp"
+
+#include <string>
+#include <fstream>
+#include <iostream>
+
+#include "jac/type_defs.hpp"
+
+namespace Renderer
+{
+
+auto read_model(const std::filesystem::path& path) -> Model
+{
+    Model data;
+
+    std::ifstream file(path);
+
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file: " << path << std::endl;
+        return data;
+    }
+
+    std::string s;
+    while (file) {
+        std::getline(file, s);
+
+        if (s.find("float") != std::string::npos){
+            const uint count = std::stoi(
+                s.substr(s.find(' '), s.size() - s.find(' '))
+            );
+            data.layout.Push<float>(count);
+        }
+        else
+            data.vertices.push_back(std::stof(s));
+
+    }
+
+    return data;
+}
+
+} // namespace Renderer
@@ -0,0 +1,185 @@
+/**
+ * @file RenderQueue.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of RenderQueue class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/RenderQueue.hpp"
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+
+#include "Profiler.hpp"
+
+namespace
+{
+
+constexpr auto mask(uint bits) -> uint64_t
+{
+    return (uint64_t{1} << bits) - 1;
+}
+
+} // namespace
+
+namespace Renderer
+{
+
+RenderQueue::RenderQueue(JobSystem& jobs) :
+    m_jobs{jobs}
+{}
+
+auto RenderQueue::allocate(uint count) -> std::span<Packet>
+{
+    const uint first = m_packets.size();
+    m_packets.resize(first + count);
+
+    return {m_packets.data() + first, count};
+}
+
+auto RenderQueue::sort() -> void
+{
+    PROFILE_ZONE("RenderQueue::sort");
+
+    const uint count = m_packets.size();
+    if (count < 2)
+        return;
+
+    const uint chunkCount = (count + PacketsPerJob - 1) / PacketsPerJob;
+    auto chunk_begin = [](uint chunk) { return chunk * PacketsPerJob; };
+    auto chunk_end = [count](uint chunk) { return std::min(count, (chunk + 1) * PacketsPerJob); };
+
+    m_scratch.resize(count);
+    m_histograms.resize(chunkCount * Buckets);
+
+    // Bits where any key differs from the first one, digits without them needn't be sorted
+    std::vector<uint64_t> differences(chunkCount);
+    const uint64_t firstKey = m_packets.front().key;
+
+    m_jobs.parallel_for(0, chunkCount, 1, [&](uint first, uint last) {
+        for (uint chunk = first; chunk < last; chunk++)
+        {
+            uint64_t difference = 0;
+            for (uint i = chunk_begin(chunk); i < chunk_end(chunk); i++)
+                difference |= m_packets[i].key ^ firstKey;
+
+            differences[chunk] = difference;
+        }
+    });
+
+    uint64_t differing = 0;
+    for (const uint64_t difference : differences)
+        differing |= difference;
+
+    Packet* source = m_packets.data();
+    Packet* destination = m_scratch.data();
+
+    for (uint shift = 0; shift < 64; shift += RadixBits)
+    {
+        if (((differing >> shift) & mask(RadixBits)) == 0)
+            continue;
+
+        m_jobs.parallel_for(0, chunkCount, 1, [&](uint first, uint last) {
+            for (uint chunk = first; chunk < last; chunk++)
+            {
+                uint* histogram = &m_histograms[chunk * Buckets];
+                std::fill_n(histogram, Buckets, 0u);
+
+                for (uint i = chunk_begin(chunk); i < chunk_end(chunk); i++)
+                    histogram[(source[i].key >> shift) & mask(RadixBits)]++;
+            }
+        });
+
+        // Exclusive prefix sum, bucket major and chunk minor, so the scatter stays stable
+        uint offset = 0;
+        for (uint bucket = 0; bucket < Buckets; bucket++)
+            for (uint chunk = 0; chunk < chunkCount; chunk++)
+            {
+                uint& counter = m_histograms[chunk * Buckets + bucket];
+                const uint bucketCount = counter;
+
+                counter = offset;
+                offset += bucketCount;
+            }
+
+        m_jobs.parallel_for(0, chunkCount, 1, [&](uint first, uint last) {
+            for (uint chunk = first; chunk < last; chunk++)
+            {
+                uint* offsets = &m_histograms[chunk * Buckets];
+
+                for (uint i = chunk_begin(chunk); i < chunk_end(chunk); i++)
+                    destination[offsets[(source[i].key >> shift) & mask(RadixBits)]++] = source[i];
+            }
+        });
+
+        std::swap(source, destination);
+    }
+
+    if (source != m_packets.data())
+        m_packets.swap(m_scratch);
+}
+
+auto RenderQueue::make_key(Pass pass, uint program, uint textures, uint vertexArray, float depth) -> uint64_t
+{
+    const uint64_t state =
+        (uint64_t{program} & mask(KeyBits::Program)) << (KeyBits::Textures + KeyBits::VertexArray) |
+        (uint64_t{textures} & mask(KeyBits::Textures)) << KeyBits::VertexArray |
+        (uint64_t{vertexArray} & mask(KeyBits::VertexArray));
+
+    constexpr uint stateBits = KeyBits::Program + KeyBits::Textures + KeyBits::VertexArray;
+    constexpr uint passShift = 64 - KeyBits::Pass;
+
+    const uint64_t passBits = static_cast<uint64_t>(pass) << passShift;
+    const uint64_t quantized = quantize_depth(depth);
+
+    if (pass == Pass::Transparent)
+        return passBits | (mask(KeyBits::Depth) - quantized) << stateBits | state;
+
+    return passBits | state << KeyBits::Depth | quantized;
+}
+
+auto RenderQueue::get_pass(uint64_t key) -> Pass
+{
+    return static_cast<Pass>(key >> (64 - KeyBits::Pass));
+}
+
+auto RenderQueue::get_program(uint64_t key) -> uint
+{
+    const uint shift = get_pass(key) == Pass::Transparent ?
+        KeyBits::Textures + KeyBits::VertexArray :
+        KeyBits::Textures + KeyBits::VertexArray + KeyBits::Depth;
+
+    return (key >> shift) & mask(KeyBits::Program);
+}
+
+auto RenderQueue::get_textures(uint64_t key) -> uint
+{
+    const uint shift = get_pass(key) == Pass::Transparent ?
+        KeyBits::VertexArray :
+        KeyBits::VertexArray + KeyBits::Depth;
+
+    return (key >> shift) & mask(KeyBits::Textures);
+}
+
+auto RenderQueue::get_vertex_array(uint64_t key) -> uint
+{
+    const uint shift = get_pass(key) == Pass::Transparent ? 0 : KeyBits::Depth;
+
+    return (key >> shift) & mask(KeyBits::VertexArray);
+}
+
+auto RenderQueue::quantize_depth(float depth) -> uint
+{
+    // Bit patterns of non-negative floats are ordered like their values, sign bit is always 0
+    if (!(depth > 0.f))
+        return 0;
+
+    static_assert(KeyBits::Depth == 30);
+    return std::bit_cast<uint32_t>(depth) >> 1;
+}
+
+} // namespace Renderer
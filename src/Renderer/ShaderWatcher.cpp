@@ -0,0 +1,78 @@
+/**
+ * @file ShaderWatcher.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of ShaderWatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/ShaderWatcher.hpp"
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include <unistd.h>
+#include <sys/inotify.h>
+
+namespace Renderer
+{
+
+ShaderWatcher::ShaderWatcher(const std::filesystem::path& directory) :
+    m_directory{directory}
+{
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0)
+    {
+        std::cerr << "Failed to create inotify instance, shaders won't be reloaded" << std::endl;
+        return;
+    }
+
+    m_watch = inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (m_watch < 0)
+        std::cerr << "Failed to watch " << directory << ", shaders won't be reloaded" << std::endl;
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+auto ShaderWatcher::poll() -> std::vector<std::filesystem::path>
+{
+    std::vector<std::filesystem::path> changed;
+    if (!isValid())
+        return changed;
+
+    alignas(inotify_event) std::array<char, 4096> buffer{};
+
+    // Non-blocking descriptor, read fails with EAGAIN once every event was taken
+    ssize_t length{};
+    while ((length = read(m_fd, buffer.data(), buffer.size())) > 0)
+    {
+        for (ssize_t offset = 0; offset < length;)
+        {
+            inotify_event event{};
+            std::memcpy(&event, buffer.data() + offset, sizeof(inotify_event));
+
+            if (event.len > 0)
+            {
+                std::filesystem::path file = m_directory / (buffer.data() + offset + sizeof(inotify_event));
+
+                // An editor saving a file usually writes it more than once
+                if (std::ranges::find(changed, file) == changed.end())
+                    changed.push_back(std::move(file));
+            }
+
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+        }
+    }
+
+    return changed;
+}
+
+} // namespace Renderer
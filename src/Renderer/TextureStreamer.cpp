@@ -0,0 +1,374 @@
+/**
+ * @file TextureStreamer.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of TextureStreamer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Renderer/TextureStreamer.hpp"
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include "Profiler.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+
+namespace
+{
+    using Image::BytesPerPixel;
+
+    // Widest row any level can have, every PBO fits at least one
+    constexpr uint MaxRowBytes = 32768 * BytesPerPixel;
+
+    constexpr std::array<uchar, BytesPerPixel> PlaceholderColor{128, 128, 128, 255};
+}   // namespace
+
+namespace Renderer
+{
+
+TextureStreamer::TextureStreamer(JobSystem& jobs) :
+    TextureStreamer(jobs, Settings{})
+{}
+
+TextureStreamer::TextureStreamer(JobSystem& jobs, const Settings& settings) :
+    m_jobs{jobs},
+    m_settings{settings}
+{
+    m_settings.pixelBufferSize = std::max(m_settings.pixelBufferSize, MaxRowBytes);
+    m_settings.pixelBuffers = std::max(m_settings.pixelBuffers, 1u);
+
+    // Allocated once, writes are unsynchronized as fences tell when the GPU is done reading
+    m_pixelBuffers.resize(m_settings.pixelBuffers);
+    for (auto& pixelBuffer : m_pixelBuffers)
+    {
+        glCreateBuffers(1, &pixelBuffer.buffer);
+        glNamedBufferData(pixelBuffer.buffer, m_settings.pixelBufferSize, nullptr, GL_STREAM_DRAW);
+    }
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_placeholder);
+    glTextureStorage2D(m_placeholder, 1, GL_RGBA8, 1, 1);
+    GPU::StateCache::Get().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glTextureSubImage2D(m_placeholder, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, PlaceholderColor.data());
+
+    m_stats.budgetBytes = m_settings.budgetBytes;
+}
+
+TextureStreamer::~TextureStreamer()
+{
+    for (auto& entry : m_entries)
+    {
+        m_jobs.wait(entry->decoded);
+        destroy(entry->texture);
+        destroy(entry->staging);
+    }
+
+    destroy(m_placeholder);
+
+    for (auto& pixelBuffer : m_pixelBuffers)
+    {
+        if (pixelBuffer.fence != nullptr)
+            glDeleteSync(pixelBuffer.fence);
+
+        GPU::StateCache::Get().ForgetBuffer(pixelBuffer.buffer);
+        glDeleteBuffers(1, &pixelBuffer.buffer);
+    }
+}
+
+auto TextureStreamer::request(const std::filesystem::path& path) -> Handle
+{
+    auto& entry = m_entries.emplace_back(std::make_unique<Entry>());
+    entry->path = path;
+    entry->lastUsed = m_frame;
+
+    Entry* decoded = entry.get();
+    m_jobs.schedule([decoded]() { decode(*decoded); }, &entry->decoded);
+
+    return m_entries.size() - 1;
+}
+
+auto TextureStreamer::bind(Handle handle, uint slot) -> void
+{
+    uint texture = m_placeholder;
+
+    if (handle < m_entries.size())
+    {
+        auto& entry = *m_entries[handle];
+        entry.lastUsed = m_frame;
+
+        if (entry.texture != 0)
+            texture = entry.texture;
+    }
+
+    GPU::StateCache::Get().BindTexture(slot, GL_TEXTURE_2D, texture);
+}
+
+auto TextureStreamer::update() -> void
+{
+    PROFILE_ZONE("TextureStreamer::update");
+
+    m_frame++;
+    m_stats.uploadedBytes = 0;
+    m_stats.evictedBytes = 0;
+
+    // Without workers jobs only run while someone waits, decoding then happens here
+    const bool workers = m_jobs.getThreadCount() > 1;
+
+    for (auto& entry : m_entries)
+    {
+        if (entry->ready)
+            continue;
+
+        if (!workers)
+            m_jobs.wait(entry->decoded);
+
+        if (entry->decoded.isDone())
+            initialize(*entry);
+    }
+
+    // Budget may have been exceeded by mip tails, which are uploaded regardless of it
+    makeRoom(0, nullptr);
+
+    // Recently used textures get their levels first, among them the blurriest ones
+    std::vector<Entry*> candidates;
+    for (auto& entry : m_entries)
+        if (entry->ready && entry->top > 0 && m_frame - entry->lastUsed <= m_settings.evictAfterFrames)
+            candidates.push_back(entry.get());
+
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        return a->lastUsed != b->lastUsed ? a->lastUsed > b->lastUsed : a->top > b->top;
+    });
+
+    uint64_t bandwidth = m_settings.uploadBytesPerFrame;
+    for (Entry* entry : candidates)
+    {
+        if (bandwidth == 0)
+            break;
+
+        stream(*entry, bandwidth);
+    }
+
+    m_stats.textures = m_entries.size();
+    m_stats.streaming = std::count_if(m_entries.begin(), m_entries.end(), [](const auto& entry) {
+        return !entry->ready || (entry->texture != 0 && entry->top > 0);
+    });
+}
+
+auto TextureStreamer::getResidentLevels(Handle handle) const -> uint
+{
+    if (handle >= m_entries.size())
+        return 0;
+
+    const auto& entry = *m_entries[handle];
+    return entry.texture != 0 ? entry.levels.size() - entry.top : 0;
+}
+
+    /**   PRIVATE   **/
+
+auto TextureStreamer::initialize(Entry& entry) -> void
+{
+    entry.ready = true;
+
+    if (entry.levels.empty())
+    {
+        std::cerr << "Failed to stream texture " << entry.path << ", placeholder is used instead" << std::endl;
+        return;
+    }
+
+    const auto tail = std::find_if(entry.levels.begin(), entry.levels.end(), [this](const Level& level) {
+        return std::max(level.width, level.height) <= m_settings.tailSize;
+    });
+    entry.tail = std::min<uint>(tail - entry.levels.begin(), entry.levels.size() - 1);
+    entry.top = entry.tail;
+    entry.texture = allocate(entry, entry.tail);
+
+    // Tail is a few kilobytes, it goes straight from client memory
+    GPU::StateCache::Get().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    for (uint level = entry.tail; level < entry.levels.size(); level++)
+    {
+        const auto& data = entry.levels[level];
+        glTextureSubImage2D(
+            entry.texture, level - entry.tail, 0, 0, data.width, data.height, GL_RGBA, GL_UNSIGNED_BYTE, data.pixels.data());
+
+        m_stats.uploadedBytes += data.size();
+        m_stats.residentBytes += data.size();
+    }
+}
+
+auto TextureStreamer::stream(Entry& entry, uint64_t& bandwidth) -> void
+{
+    const uint level = entry.top - 1;
+    const Level& data = entry.levels[level];
+
+    if (entry.staging == 0)
+    {
+        if (!makeRoom(data.size(), &entry))
+            return;
+
+        entry.staging = allocate(entry, level);
+        entry.stagingRow = 0;
+        copyLevels(entry, entry.texture, entry.top, entry.staging, level);
+
+        // Reserved up front, so other textures can't take the space while rows arrive
+        m_stats.residentBytes += data.size();
+    }
+
+    auto& cache = GPU::StateCache::Get();
+    const uint rowBytes = data.width * BytesPerPixel;
+    const uint rowsPerBuffer = m_settings.pixelBufferSize / rowBytes;
+
+    while (entry.stagingRow < data.height && bandwidth > 0)
+    {
+        PixelBuffer* pixelBuffer = acquirePixelBuffer();
+        if (pixelBuffer == nullptr)
+            break;
+
+        // At least a row per update, so levels wider than the per-frame limit still arrive
+        const uint affordable = std::max<uint64_t>(bandwidth / rowBytes, 1);
+        const uint rows = std::min({rowsPerBuffer, affordable, data.height - entry.stagingRow});
+        const uint bytes = rows * rowBytes;
+
+        void* mapped = glMapNamedBufferRange(
+            pixelBuffer->buffer, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        std::memcpy(mapped, data.pixels.data() + static_cast<std::size_t>(entry.stagingRow) * rowBytes, bytes);
+        glUnmapNamedBuffer(pixelBuffer->buffer);
+
+        // With an unpack buffer bound, the pointer is an offset into it
+        cache.BindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer->buffer);
+        glTextureSubImage2D(entry.staging, 0, 0, entry.stagingRow, data.width, rows, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        pixelBuffer->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        entry.stagingRow += rows;
+        bandwidth -= std::min<uint64_t>(bandwidth, bytes);
+        m_stats.uploadedBytes += bytes;
+    }
+
+    // Uploads from client memory elsewhere would read from the bound PBO instead
+    cache.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (entry.stagingRow < data.height)
+        return;
+
+    destroy(entry.texture);
+    entry.texture = entry.staging;
+    entry.staging = 0;
+    entry.top = level;
+}
+
+auto TextureStreamer::evict(Entry& entry) -> bool
+{
+    if (entry.texture == 0 || entry.staging != 0 || entry.top >= entry.tail)
+        return false;
+
+    const uint texture = allocate(entry, entry.top + 1);
+    copyLevels(entry, entry.texture, entry.top, texture, entry.top + 1);
+    destroy(entry.texture);
+
+    const uint64_t bytes = entry.levels[entry.top].size();
+    m_stats.residentBytes -= bytes;
+    m_stats.evictedBytes += bytes;
+
+    entry.texture = texture;
+    entry.top++;
+    return true;
+}
+
+auto TextureStreamer::makeRoom(uint64_t bytes, const Entry* keep) -> bool
+{
+    while (m_stats.residentBytes + bytes > m_settings.budgetBytes)
+    {
+        Entry* oldest = nullptr;
+
+        for (auto& entry : m_entries)
+        {
+            if (entry.get() == keep || m_frame - entry->lastUsed <= m_settings.evictAfterFrames)
+                continue;
+
+            if (entry->texture == 0 || entry->staging != 0 || entry->top >= entry->tail)
+                continue;
+
+            if (oldest == nullptr || entry->lastUsed < oldest->lastUsed)
+                oldest = entry.get();
+        }
+
+        if (oldest == nullptr || !evict(*oldest))
+            return false;
+    }
+
+    return true;
+}
+
+auto TextureStreamer::allocate(const Entry& entry, uint top) -> uint
+{
+    const Level& level = entry.levels[top];
+
+    uint texture{};
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, entry.levels.size() - top, GL_RGBA8, level.width, level.height);
+    glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    return texture;
+}
+
+auto TextureStreamer::copyLevels(const Entry& entry, uint source, uint sourceTop, uint destination, uint destinationTop) -> void
+{
+    for (uint level = std::max(sourceTop, destinationTop); level < entry.levels.size(); level++)
+    {
+        const Level& data = entry.levels[level];
+        glCopyImageSubData(
+            source, GL_TEXTURE_2D, level - sourceTop, 0, 0, 0,
+            destination, GL_TEXTURE_2D, level - destinationTop, 0, 0, 0,
+            data.width, data.height, 1);
+    }
+}
+
+auto TextureStreamer::acquirePixelBuffer() -> PixelBuffer*
+{
+    for (auto& pixelBuffer : m_pixelBuffers)
+    {
+        if (pixelBuffer.fence == nullptr)
+            return &pixelBuffer;
+
+        // Never waits, a busy pool just ends this frame's uploads
+        const GLenum status = glClientWaitSync(pixelBuffer.fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            continue;
+
+        glDeleteSync(pixelBuffer.fence);
+        pixelBuffer.fence = nullptr;
+        return &pixelBuffer;
+    }
+
+    return nullptr;
+}
+
+auto TextureStreamer::decode(Entry& entry) -> void
+{
+    PROFILE_ZONE("TextureStreamer::decode");
+
+    auto image = Image::load_image(entry.path);
+    if (!image)
+        return;
+
+    // Already on a worker, the filter itself stays serial
+    entry.levels = Image::build_mips(std::move(*image));
+}
+
+auto TextureStreamer::destroy(uint texture) -> void
+{
+    if (texture == 0)
+        return;
+
+    GPU::StateCache::Get().ForgetTexture(texture);
+    glDeleteTextures(1, &texture);
+}
+
+} // namespace Renderer
@@ -0,0 +1,441 @@
+/**
+ * @file BVH.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of BVH class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Scene/BVH.hpp"
+
+#include <array>
+#include <numeric>
+#include <algorithm>
+
+namespace
+{
+    constexpr uint BinCount = 16;
+    constexpr uint MaxLeafSize = 8;     // leaves are never bigger than this
+    constexpr uint MinLeafSize = 2;     // nodes this small are never split
+    constexpr float TraversalCost = 1.f;    // relative to cost of testing one object
+
+    // Deeper nodes are left as leaves, keeps traversal stacks fixed size (depth + 2 entries)
+    constexpr uint MaxDepth = 126;
+    constexpr uint StackSize = MaxDepth + 2;
+
+    enum class Overlap { Outside, Partial, Inside };
+
+    auto test_frustum(const Renderer::Frustum& frustum, const glm::vec3& min, const glm::vec3& max) -> Overlap
+    {
+        Overlap result = Overlap::Inside;
+
+        for (const auto& plane : frustum.planes)
+        {
+            const glm::vec3 normal{plane};
+
+            // Corners of the box furthest along and against the plane normal
+            const glm::vec3 positive{
+                normal.x >= 0.f ? max.x : min.x,
+                normal.y >= 0.f ? max.y : min.y,
+                normal.z >= 0.f ? max.z : min.z
+            };
+            const glm::vec3 negative{
+                normal.x >= 0.f ? min.x : max.x,
+                normal.y >= 0.f ? min.y : max.y,
+                normal.z >= 0.f ? min.z : max.z
+            };
+
+            if (glm::dot(normal, positive) + plane.w < 0.f)
+                return Overlap::Outside;
+
+            if (glm::dot(normal, negative) + plane.w < 0.f)
+                result = Overlap::Partial;
+        }
+
+        return result;
+    }
+
+    auto test_sphere(const glm::vec3& center, float radius, const Scene::AABB& box) -> Overlap
+    {
+        const float radiusSquared = radius * radius;
+
+        if (box.distanceSquared(center) > radiusSquared)
+            return Overlap::Outside;
+
+        const glm::vec3 farthest = glm::max(glm::abs(center - box.min), glm::abs(center - box.max));
+
+        return glm::dot(farthest, farthest) <= radiusSquared ? Overlap::Inside : Overlap::Partial;
+    }
+
+    auto test_aabb(const Scene::AABB& query, const Scene::AABB& box) -> Overlap
+    {
+        if (!query.overlaps(box))
+            return Overlap::Outside;
+
+        const bool contained =
+            box.min.x >= query.min.x && box.min.y >= query.min.y && box.min.z >= query.min.z &&
+            box.max.x <= query.max.x && box.max.y <= query.max.y && box.max.z <= query.max.z;
+
+        return contained ? Overlap::Inside : Overlap::Partial;
+    }
+}   // namespace
+
+namespace Scene
+{
+
+auto BVH::build(const std::vector<AABB>& bounds) -> void
+{
+    m_nodes.clear();
+    m_objects.resize(bounds.size());
+    m_bounds = bounds;
+    m_cost = m_buildCost = 0.f;
+
+    if (bounds.empty())
+        return;
+
+    std::iota(m_objects.begin(), m_objects.end(), 0u);
+
+    std::vector<glm::vec3> centroids(bounds.size());
+    for (uint i = 0; i < bounds.size(); i++)
+        centroids[i] = bounds[i].center();
+
+    m_nodes.reserve(2 * bounds.size());
+
+    AABB rootBounds;
+    for (const auto& box : bounds)
+        rootBounds.grow(box);
+
+    m_nodes.push_back({rootBounds.min, 0, rootBounds.max, static_cast<uint>(bounds.size())});
+
+    std::vector<std::pair<uint, uint>> stack{{0, 0}};   // node, depth
+    while (!stack.empty())
+    {
+        const auto [node, depth] = stack.back();
+        stack.pop_back();
+
+        if (depth < MaxDepth && subdivide(node, centroids))
+        {
+            stack.emplace_back(m_nodes[node].first, depth + 1);
+            stack.emplace_back(m_nodes[node].first + 1, depth + 1);
+        }
+    }
+
+    m_nodes.shrink_to_fit();
+
+    m_cost = m_buildCost = areaCost();
+}
+
+auto BVH::refit(const std::vector<AABB>& bounds) -> void
+{
+    for (uint i = 0; i < m_objects.size(); i++)
+        m_bounds[i] = bounds[m_objects[i]];
+
+    // Children are always stored after their parent, so walking backwards goes bottom-up
+    for (uint i = m_nodes.size(); i-- > 0;)
+    {
+        auto& node = m_nodes[i];
+        AABB box;
+
+        if (node.count > 0)
+        {
+            for (uint object = node.first; object < node.first + node.count; object++)
+                box.grow(m_bounds[object]);
+        }
+        else
+        {
+            box.grow(boundsOf(m_nodes[node.first]));
+            box.grow(boundsOf(m_nodes[node.first + 1]));
+        }
+
+        node.min = box.min;
+        node.max = box.max;
+    }
+
+    m_cost = areaCost();
+}
+
+auto BVH::queryFrustum(const Renderer::Frustum& frustum, std::vector<uint>& out) const -> void
+{
+    query(
+        [&frustum](const Node& node) { return test_frustum(frustum, node.min, node.max); },
+        [&frustum](const AABB& box) { return test_frustum(frustum, box.min, box.max) != Overlap::Outside; },
+        out
+    );
+}
+
+auto BVH::queryAABB(const AABB& box, std::vector<uint>& out) const -> void
+{
+    query(
+        [&box](const Node& node) { return test_aabb(box, boundsOf(node)); },
+        [&box](const AABB& object) { return box.overlaps(object); },
+        out
+    );
+}
+
+auto BVH::querySphere(const glm::vec3& center, float radius, std::vector<uint>& out) const -> void
+{
+    query(
+        [&](const Node& node) { return test_sphere(center, radius, boundsOf(node)); },
+        [&](const AABB& object) { return object.distanceSquared(center) <= radius * radius; },
+        out
+    );
+}
+
+auto BVH::raycast(const Ray& ray, float maxDistance, const RayTest& test) const -> std::optional<Hit>
+{
+    if (m_nodes.empty())
+        return std::nullopt;
+
+    const glm::vec3 invDirection = 1.f / ray.direction;
+
+    std::optional<Hit> hit;
+    float closest = maxDistance;
+
+    std::array<uint, StackSize> stack{};
+    uint stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const Node& node = m_nodes[stack[--stackSize]];
+
+        float tNode = 0.f;
+        if (!intersect(ray, invDirection, boundsOf(node), tNode, closest))
+            continue;
+
+        if (node.count > 0)
+        {
+            for (uint i = node.first; i < node.first + node.count; i++)
+            {
+                float tObject = 0.f;
+                if (!intersect(ray, invDirection, m_bounds[i], tObject, closest))
+                    continue;
+
+                if (test)
+                {
+                    const auto distance = test(m_objects[i], ray);
+                    if (!distance || *distance >= closest)
+                        continue;
+
+                    tObject = *distance;
+                }
+
+                closest = tObject;
+                hit = Hit{m_objects[i], tObject};
+            }
+
+            continue;
+        }
+
+        // Nearer child goes on top of the stack, so it's visited first and shrinks the search range
+        float tLeft = 0.f, tRight = 0.f;
+        const bool left = intersect(ray, invDirection, boundsOf(m_nodes[node.first]), tLeft, closest);
+        const bool right = intersect(ray, invDirection, boundsOf(m_nodes[node.first + 1]), tRight, closest);
+
+        if (left && right)
+        {
+            const bool leftFirst = tLeft <= tRight;
+            stack[stackSize++] = leftFirst ? node.first + 1 : node.first;
+            stack[stackSize++] = leftFirst ? node.first : node.first + 1;
+        }
+        else if (left)
+            stack[stackSize++] = node.first;
+        else if (right)
+            stack[stackSize++] = node.first + 1;
+    }
+
+    return hit;
+}
+
+    /**   PRIVATE   **/
+
+auto BVH::areaCost() const -> float
+{
+    if (m_nodes.empty())
+        return 0.f;
+
+    const float rootArea = boundsOf(m_nodes[0]).surfaceArea();
+    if (rootArea <= 0.f)
+        return 0.f;
+
+    float area = 0.f;
+    for (const auto& node : m_nodes)
+        area += boundsOf(node).surfaceArea();
+
+    return area / rootArea;
+}
+
+auto BVH::subdivide(uint index, std::vector<glm::vec3>& centroids) -> bool
+{
+    const Node node = m_nodes[index];
+
+    if (node.count <= MinLeafSize)
+        return false;
+
+    AABB centroidBounds;
+    for (uint i = node.first; i < node.first + node.count; i++)
+        centroidBounds.grow(centroids[i]);
+
+    // Binned SAH, cost of a split is left count * left area + right count * right area
+    struct Bin {
+        AABB bounds;
+        uint count{};
+    };
+
+    float bestCost = std::numeric_limits<float>::max();
+    int bestAxis = -1;
+    uint bestSplit = 0;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        const float minimum = centroidBounds.min[axis];
+        const float extent = centroidBounds.max[axis] - minimum;
+
+        if (extent <= 0.f)
+            continue;
+
+        const float scale = BinCount / extent;
+        std::array<Bin, BinCount> bins{};
+
+        for (uint i = node.first; i < node.first + node.count; i++)
+        {
+            const uint bin = std::min(BinCount - 1, static_cast<uint>((centroids[i][axis] - minimum) * scale));
+            bins[bin].count++;
+            bins[bin].bounds.grow(m_bounds[i]);
+        }
+
+        std::array<float, BinCount - 1> leftArea{}, rightArea{};
+        std::array<uint, BinCount - 1> leftCount{}, rightCount{};
+
+        AABB leftBox, rightBox;
+        uint leftSum = 0, rightSum = 0;
+
+        for (uint i = 0; i < BinCount - 1; i++)
+        {
+            leftSum += bins[i].count;
+            leftBox.grow(bins[i].bounds);
+            leftCount[i] = leftSum;
+            leftArea[i] = leftBox.surfaceArea();
+
+            rightSum += bins[BinCount - 1 - i].count;
+            rightBox.grow(bins[BinCount - 1 - i].bounds);
+            rightCount[BinCount - 2 - i] = rightSum;
+            rightArea[BinCount - 2 - i] = rightBox.surfaceArea();
+        }
+
+        for (uint i = 0; i < BinCount - 1; i++)
+        {
+            const float cost = leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i];
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = i + 1;
+            }
+        }
+    }
+
+    const float leafCost = node.count * boundsOf(node).surfaceArea();
+    const float splitCost = TraversalCost * boundsOf(node).surfaceArea() + bestCost;
+
+    if (bestAxis == -1 || (splitCost >= leafCost && node.count <= MaxLeafSize))
+    {
+        if (node.count <= MaxLeafSize)
+            return false;
+
+        // All centroids in one point or SAH refuses to split an oversized leaf, split in half
+        bestAxis = -1;
+    }
+
+    uint middle = node.first;
+
+    if (bestAxis != -1)
+    {
+        const float minimum = centroidBounds.min[bestAxis];
+        const float scale = BinCount / (centroidBounds.max[bestAxis] - minimum);
+
+        uint last = node.first + node.count;
+        while (middle < last)
+        {
+            const uint bin = std::min(BinCount - 1, static_cast<uint>((centroids[middle][bestAxis] - minimum) * scale));
+
+            if (bin < bestSplit)
+                middle++;
+            else
+            {
+                last--;
+                std::swap(m_objects[middle], m_objects[last]);
+                std::swap(m_bounds[middle], m_bounds[last]);
+                std::swap(centroids[middle], centroids[last]);
+            }
+        }
+    }
+
+    if (middle == node.first || middle == node.first + node.count)
+        middle = node.first + node.count / 2;
+
+    const uint left = m_nodes.size();
+
+    for (const auto& [first, count] : {
+        std::pair{node.first, middle - node.first},
+        std::pair{middle, node.first + node.count - middle}
+    })
+    {
+        AABB box;
+        for (uint i = first; i < first + count; i++)
+            box.grow(m_bounds[i]);
+
+        m_nodes.push_back({box.min, first, box.max, count});
+    }
+
+    m_nodes[index].first = left;
+    m_nodes[index].count = 0;
+
+    return true;
+}
+
+template<typename NodeTest, typename ObjectTest>
+auto BVH::query(NodeTest&& nodeTest, ObjectTest&& objectTest, std::vector<uint>& out) const -> void
+{
+    if (m_nodes.empty())
+        return;
+
+    std::array<std::pair<uint, bool>, StackSize> stack{};  // node, whether it's known to be fully inside
+    uint stackSize = 0;
+    stack[stackSize++] = {0, false};
+
+    while (stackSize > 0)
+    {
+        const auto [index, inside] = stack[--stackSize];
+        const Node& node = m_nodes[index];
+
+        Overlap overlap = Overlap::Inside;
+        if (!inside)
+        {
+            overlap = nodeTest(node);
+
+            if (overlap == Overlap::Outside)
+                continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint i = node.first; i < node.first + node.count; i++)
+            {
+                if (overlap == Overlap::Inside || objectTest(m_bounds[i]))
+                    out.push_back(m_objects[i]);
+            }
+
+            continue;
+        }
+
+        // Whole subtree of a node that is inside is inside too, no more tests needed
+        stack[stackSize++] = {node.first, overlap == Overlap::Inside};
+        stack[stackSize++] = {node.first + 1, overlap == Overlap::Inside};
+    }
+}
+
+} // namespace Scene
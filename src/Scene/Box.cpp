@@ -0,0 +1,89 @@
+/**
+ * @file Box.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of Box helpers
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Scene/Box.hpp"
+
+#include <random>
+
+namespace Scene
+{
+
+auto create_boxes(const uint count, const std::optional<uint> seed) -> std::vector<Box>
+{
+    std::vector<Box> boxes(count);
+
+    std::mt19937 random{seed.value_or(std::random_device{}())};
+    std::uniform_real_distribution<float> distribution{0.f, 1.f};
+
+    auto randFloat = [&]() -> float {
+        return distribution(random);
+    };
+
+    for (auto& box : boxes)
+    {
+        box.position = glm::vec3(randFloat() * 100.f - 50.f, randFloat() * 100.f - 50.f, randFloat() * 100.f - 50.f);
+        box.scale = randFloat() * 2.f;
+        box.rotation = glm::vec3(randFloat() * 360.f, randFloat() * 360.f, randFloat() * 360.f);
+        box.color = glm::vec3(randFloat(), randFloat(), randFloat());
+    }
+
+    auto& bigBox = boxes.back();
+    bigBox.position = glm::vec3(1000.f, 1000.f, 1000.f);
+    bigBox.scale = 1000.f;
+
+    auto& skyBox = boxes.front();
+    skyBox.position = glm::vec3(0.f, 0.f, 0.f);
+    skyBox.scale = 5000.f;
+
+    return boxes;
+}
+
+auto assign_textures(std::vector<Box>& boxes, uint textureCount, const std::optional<uint> seed) -> void
+{
+    if (textureCount == 0)
+        return;
+
+    std::mt19937 random{seed.value_or(std::random_device{}())};
+    std::uniform_int_distribution<uint> distribution{0, textureCount - 1};
+
+    for (auto& box : boxes)
+        box.textures = {distribution(random), distribution(random)};
+}
+
+auto to_transform(const Box& box) -> Transform
+{
+    return {
+        .position = box.position,
+        .rotation = box.rotation,
+        .scale = glm::vec3(box.scale)
+    };
+}
+
+auto model_matrix(const Box& box) -> glm::mat4
+{
+    return local_matrix(to_transform(box));
+}
+
+auto add_boxes(TransformHierarchy& hierarchy, const std::vector<Box>& boxes, uint groupCount) -> BoxNodes
+{
+    BoxNodes nodes;
+    nodes.groups.reserve(groupCount);
+    nodes.boxes.reserve(boxes.size());
+
+    for (uint i = 0; i < groupCount; i++)
+        nodes.groups.push_back(hierarchy.create(Transform{}));
+
+    for (uint i = 0; i < boxes.size(); i++)
+        nodes.boxes.push_back(hierarchy.create(to_transform(boxes[i]), nodes.groups[i % groupCount]));
+
+    return nodes;
+}
+
+} // namespace Scene
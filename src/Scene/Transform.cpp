@@ -0,0 +1,154 @@
+/**
+ * @file Transform.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Implementation of TransformHierarchy class
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#include "Scene/Transform.hpp"
+
+#include <algorithm>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Profiler.hpp"
+
+namespace Scene
+{
+
+auto local_matrix(const Transform& transform) -> glm::mat4
+{
+    auto matrix = glm::mat4(1.0f);
+    matrix = glm::translate(matrix, transform.position);
+    matrix = glm::rotate(matrix, transform.rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
+    matrix = glm::rotate(matrix, transform.rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
+    matrix = glm::rotate(matrix, transform.rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+    matrix = glm::scale(matrix, transform.scale);
+
+    return matrix;
+}
+
+TransformHierarchy::TransformHierarchy()
+{
+    clear();
+}
+
+auto TransformHierarchy::create(const Transform& local, Node parent) -> Node
+{
+    const Node node = m_parent.size();
+
+    m_parent.push_back(parent);
+    m_firstChild.push_back(None);
+    m_lastChild.push_back(None);
+    m_nextSibling.push_back(None);
+    m_depth.push_back(parent == None ? 0 : m_depth[parent] + 1);
+
+    m_local.push_back(local);
+    m_localMatrix.emplace_back(1.f);
+    m_world.emplace_back(1.f);
+
+    m_dirty.push_back(true);
+    m_dirtyNodes.push_back(node);
+
+    if (parent != None)
+    {
+        if (m_lastChild[parent] == None)
+            m_firstChild[parent] = node;
+        else
+            m_nextSibling[m_lastChild[parent]] = node;
+
+        m_lastChild[parent] = node;
+    }
+
+    return node;
+}
+
+auto TransformHierarchy::clear() -> void
+{
+    m_parent.clear();
+    m_firstChild.clear();
+    m_lastChild.clear();
+    m_nextSibling.clear();
+    m_depth.clear();
+    m_local.clear();
+    m_localMatrix.clear();
+    m_world.clear();
+    m_dirty.clear();
+    m_dirtyNodes.clear();
+    m_updated.clear();
+
+    create(Transform{}, None);
+}
+
+auto TransformHierarchy::setLocal(Node node, const Transform& local) -> void
+{
+    m_local[node] = local;
+
+    if (!m_dirty[node])
+    {
+        m_dirty[node] = true;
+        m_dirtyNodes.push_back(node);
+    }
+}
+
+auto TransformHierarchy::update() -> uint
+{
+    PROFILE_ZONE("TransformHierarchy::update");
+
+    // Kept when nothing changed, the serial stays the same so the list still belongs to it
+    if (m_dirtyNodes.empty())
+        return 0;
+
+    m_updated.clear();
+
+    // Parents first, so a dirty descendant is handled by its ancestor's subtree update
+    std::sort(m_dirtyNodes.begin(), m_dirtyNodes.end(), [this](Node a, Node b) {
+        return m_depth[a] < m_depth[b];
+    });
+
+    for (const Node node : m_dirtyNodes)
+    {
+        if (m_dirty[node])
+            updateSubtree(node);
+    }
+
+    m_dirtyNodes.clear();
+    m_serial++;
+
+    return m_updated.size();
+}
+
+    /**   PRIVATE   **/
+
+auto TransformHierarchy::updateSubtree(Node node) -> void
+{
+    m_stack.clear();
+    m_stack.push_back(node);
+
+    while (!m_stack.empty())
+    {
+        const Node current = m_stack.back();
+        m_stack.pop_back();
+
+        if (m_dirty[current])
+        {
+            m_localMatrix[current] = local_matrix(m_local[current]);
+            m_dirty[current] = false;
+        }
+
+        const Node parent = m_parent[current];
+        m_world[current] = (parent == None) ?
+            m_localMatrix[current] :
+            m_world[parent] * m_localMatrix[current];
+
+        m_updated.push_back(current);
+
+        for (Node child = m_firstChild[current]; child != None; child = m_nextSibling[child])
+            m_stack.push_back(child);
+    }
+}
+
+} // namespace Scene
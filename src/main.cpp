@@ -15,19 +15,42 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <map>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <optional>
+#include <filesystem>
+#include <string_view>
 #include <format>
 #include <memory>
 #include <fstream>
 #include <iostream>
 
 #include "Input.hpp"
+#include "Profiler.hpp"
+#include "Benchmark.hpp"
+#include "JobSystem.hpp"
+#include "FramePacer.hpp"
+#include "FrameStats.hpp"
 #include "Renderer/Camera.hpp"
+#include "Mesh/Lod.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Renderer/BoxRenderer.hpp"
+#include "Renderer/ShaderWatcher.hpp"
+#include "Renderer/TextureStreamer.hpp"
 #include "Renderer/GPU/Shader.hpp"
+#include "Renderer/GPU/StateCache.hpp"
+#include "Renderer/GPU/Extensions.hpp"
 #include "Renderer/GPU/VertexArray.hpp"
 #include "Renderer/GPU/VertexBuffer.hpp"
 #include "Renderer/GPU/IndexBuffer.hpp"
 #include "Renderer/GPU/VertexBufferLayout.hpp"
 #include "Renderer/GPU/Texture.hpp"
+#include "Renderer/GPU/TextureArray.hpp"
+#include "Renderer/GPU/BindlessTextures.hpp"
+#include "Scene/Box.hpp"
+#include "Scene/Transform.hpp"
 
 #include "jac/main.hpp"
 #include "jac/type_defs.hpp"
@@ -37,72 +60,41 @@
     constexpr int OpenGL_VERSION_MINOR = 3;
 #endif
 
-using Renderer::GPU::Shader;
+using Renderer::BoxRenderer;
+using Renderer::TextureStreamer;
 using Renderer::GPU::Texture;
+using Renderer::GPU::StateCache;
 using Renderer::GPU::VertexArray;
 using Renderer::GPU::VertexBuffer;
 using Renderer::GPU::VertexBufferLayout;
 
 namespace Resources {
-    namespace Shaders {
-        const std::filesystem::path basic_vert = "res/shaders/basic.vert";
-        const std::filesystem::path basic_frag = "res/shaders/basic.frag";
-        const std::filesystem::path basic_light_frag = "res/shaders/basic_light.frag";
-    }
-
     namespace Textures {
         const std::filesystem::path container = "res/textures/container.png";
         const std::filesystem::path face = "res/textures/grandfather-face.png";
     }
-}   // namespace Resources
-
-auto initialize_glfw() -> void;
-auto create_window(const uint width, const uint height, const std::string& title) -> unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)>;
-
-struct Model {
-    std::vector<float> vertices;
-    VertexBufferLayout layout;
-};
-
-auto read_file(const std::filesystem::path& path) -> Model
-{
-    Model data;
-
-    std::ifstream file(path);
-
-    if (!file.is_open())
-    {
-        std::cerr << "Failed to open file: " << path << std::endl;
-        return data;
+    namespace Models {
+        const std::filesystem::path box = "res/models/box.mesh";     // converted from box.dat with MeshConvert
+        const std::filesystem::path boxModel = "res/models/box.dat";
+        const std::filesystem::path boxLod = "res/models/box.lod";  // generated with MeshLod
     }
+    const std::filesystem::path shaders = "res/shaders";
+}   // namespace Resources
 
-    std::string s;
-    while (file) {
-        std::getline(file, s);
-
-        if (s.find("float") != std::string::npos){
-            const uint count = std::stoi(
-                s.substr(s.find(' '), s.size() - s.find(' '))
-            );
-            data.layout.Push<float>(count);
-        }
-        else
-            data.vertices.push_back(std::stof(s));
-
-    }
-
-    return data;
-}
-
-struct Box {
-    glm::vec3 position;
-    float scale;
-    glm::vec3 rotation;
-    glm::vec3 color;
+/**
+ * @brief Options given as program arguments
+ */
+struct Options {
+    std::optional<std::filesystem::path> statsPath{};   // --stats-out <path>
+    FrameStats::Format statsFormat = FrameStats::Format::JsonLines; // --stats-format <jsonl|csv>
+    double statsInterval = 0.0;    // --stats-interval <seconds>, 0 - only on exit
+    std::optional<std::filesystem::path> tracePath{};   // --trace-out <path>, needs -DProfiler=ON
+    bool streamTextures = false;    // --stream-textures, decodes and uploads textures without blocking frames
 };
 
-auto create_boxes(const uint count) -> std::vector<Box>;
-auto draw_Box(const Box& box, Shader& shader) -> void;
+auto parse_options(const std::vector<std::string_view>& args) -> Options;
+auto initialize_glfw() -> void;
+auto create_window(const uint width, const uint height, const std::string& title) -> unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)>;
 
 /**
  * @brief Starting point, function called by jac::main in main.hpp, contains the program loop
@@ -111,8 +103,22 @@ auto draw_Box(const Box& box, Shader& shader) -> void;
  * @param env environment variables passed to the program, processed by jac::main
  * @retval int return status of the program
  */
-auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
+auto run(jac::Arguments& arg, jac::Arguments& /*env*/) -> int
 {
+    const std::vector<std::string_view> args(arg.begin(), arg.end());
+
+    // Offscreen run with scripted camera, see Benchmark.hpp for its options
+    if (std::ranges::find(args, "--headless") != args.end())
+    {
+        const auto config = parse_benchmark_config(args);
+        return config ? run_benchmark(*config) : -1;
+    }
+
+    const Options options = parse_options(args);
+
+    if (options.tracePath)
+        Profiler::instance().setCapturing(true);
+
     initialize_glfw();
     unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)> window = create_window(1600, 1200, "OpenGL");
 
@@ -122,29 +128,79 @@ auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
         return -1;
     }
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    Renderer::GPU::Extensions::Get().Load(glfwGetProcAddress);
 
-    Shader shader(
-        Resources::Shaders::basic_vert,
-        Resources::Shaders::basic_light_frag
-    );
+    StateCache::Get().Enable(GL_DEPTH_TEST);
+    StateCache::Get().Enable(GL_BLEND);
+    StateCache::Get().BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    const std::vector<Box> boxes = create_boxes(8000);
+    JobSystem jobs;
+
+    const Mesh::MappedMesh mesh(Resources::Models::box);
+    if (!mesh.isValid())
+        return -1;
 
-    Model model = read_file("res/models/box.dat");
+    VertexBuffer vb(mesh.getVertexData().data(), mesh.getVertexData().size());
 
-    VertexBuffer vb(model.vertices.data(), model.vertices.size() * sizeof(float));
+    BoxRenderer boxRenderer(vb, mesh.getLayout(), mesh.getVertexCount(), jobs);
+    boxRenderer.setLods(Mesh::load_lod_chain(Resources::Models::boxLod, Resources::Models::boxModel));
 
-    VertexArray va;
-    va.AddBuffer(vb, model.layout);
+    // Saved shaders are compiled by the driver while frames are drawn with the old program
+    Renderer::ShaderWatcher shaderWatcher(Resources::shaders);
+
+    Scene::TransformHierarchy transforms;
+    Scene::BoxNodes boxNodes;
+
+    auto setupBoxes = [&](const uint count) {
+        constexpr uint groupCount = 8;
+
+        std::vector<Scene::Box> boxes = Scene::create_boxes(count);
+        Scene::assign_textures(boxes, 2);
+
+        transforms.clear();
+        boxNodes = Scene::add_boxes(transforms, boxes, groupCount);
+        transforms.update();
+
+        boxRenderer.setBoxes(boxes, transforms, boxNodes.boxes);
+    };
+
+    uint boxCount = 8000;
+    setupBoxes(boxCount);
 
     //### Loading texture
-    Texture texture(Resources::Textures::container);
-    Texture texture2(Resources::Textures::face);
-    
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    std::optional<TextureStreamer> streamer;
+    std::array<TextureStreamer::Handle, 2> streamed{};
+    std::optional<Texture> texture, texture2;
+
+    if (options.streamTextures && GLAD_GL_VERSION_4_5)
+    {
+        streamer.emplace(jobs);
+        streamed = {streamer->request(Resources::Textures::container), streamer->request(Resources::Textures::face)};
+    }
+    else
+    {
+        if (options.streamTextures)
+            std::cerr << "Texture streaming needs OpenGL 4.5, loading textures at once" << std::endl;
+
+        texture.emplace(Resources::Textures::container, &jobs);
+        texture2.emplace(Resources::Textures::face, &jobs);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    // Array and bindless texturing give every box its own pair out of these
+    const std::vector<std::filesystem::path> boxTextures{Resources::Textures::container, Resources::Textures::face};
+
+    const Renderer::GPU::TextureArray textureArray(boxTextures, &jobs);
+    boxRenderer.setTextureArray(&textureArray);
+
+    std::optional<Renderer::GPU::BindlessTextures> bindlessTextures;
+    if (Renderer::GPU::BindlessTextures::IsSupported())
+    {
+        bindlessTextures.emplace(boxTextures, &jobs);
+        boxRenderer.setBindlessTextures(&*bindlessTextures);
+    }
     //###
 
     struct State 
@@ -152,6 +208,17 @@ auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
         float mix = 0.2f;
         float cameraSpeed = 2.0f;
 
+        BoxRenderer::Mode mode = BoxRenderer::Mode::PerBox;
+        uint boxCount = 8000;
+        BoxRenderer::Culling culling = BoxRenderer::Culling::Simd;
+        BoxRenderer::Texturing texturing = BoxRenderer::Texturing::Slots;
+        bool sorting = true;
+        bool lod = true;
+        bool animate = false;
+        bool pick = false;
+
+        FramePacer::Mode pacing = FramePacer::Mode::Target;
+
         Renderer::Camera camera{};
     };
 
@@ -186,7 +253,61 @@ auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
 
     auto toggleWireframeMode = [](const bool wireframe){
         return [wireframe](State&, const float) {
-            glPolygonMode(GL_FRONT_AND_BACK, wireframe ? GL_LINE : GL_FILL);
+            StateCache::Get().PolygonMode(wireframe ? GL_LINE : GL_FILL);
+        };
+    };
+
+    auto cycleMode = [](State& state, const float) {
+        using Mode = BoxRenderer::Mode;
+
+        state.mode =
+            (state.mode == Mode::PerBox) ? Mode::Instanced :
+            (state.mode == Mode::Instanced) ? Mode::Indirect :
+            Mode::PerBox;
+    };
+
+    auto cycleCulling = [](State& state, const float) {
+        using Culling = BoxRenderer::Culling;
+
+        state.culling =
+            (state.culling == Culling::None) ? Culling::Simd :
+            (state.culling == Culling::Simd) ? Culling::BVH :
+            Culling::None;
+    };
+
+    auto cycleTexturing = [](State& state, const float) {
+        using Texturing = BoxRenderer::Texturing;
+
+        state.texturing =
+            (state.texturing == Texturing::Slots) ? Texturing::Array :
+            (state.texturing == Texturing::Array && Renderer::GPU::BindlessTextures::IsSupported()) ? Texturing::Bindless :
+            Texturing::Slots;
+    };
+
+    auto toggleSorting = [](State& state, const float) {
+        state.sorting = !state.sorting;
+    };
+
+    auto toggleLod = [](State& state, const float) {
+        state.lod = !state.lod;
+    };
+
+    auto toggleAnimation = [](State& state, const float) {
+        state.animate = !state.animate;
+    };
+
+    auto cyclePacing = [](State& state, const float) {
+        using Mode = FramePacer::Mode;
+
+        state.pacing =
+            (state.pacing == Mode::Target) ? Mode::VSync :
+            (state.pacing == Mode::VSync) ? Mode::Uncapped :
+            Mode::Target;
+    };
+
+    auto changeBoxCount = [](const uint count){
+        return [count](State& state, const float) {
+            state.boxCount = count;
         };
     };
 
@@ -215,6 +336,17 @@ auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
             .pressed = toggleWireframeMode(true),
             .released = toggleWireframeMode(false)}},
 
+        {GLFW_KEY_I, { .pressed = cycleMode }},
+        {GLFW_KEY_C, { .pressed = cycleCulling }},
+        {GLFW_KEY_T, { .pressed = cycleTexturing }},
+        {GLFW_KEY_O, { .pressed = toggleSorting }},
+        {GLFW_KEY_L, { .pressed = toggleLod }},
+        {GLFW_KEY_R, { .pressed = toggleAnimation }},
+        {GLFW_KEY_V, { .pressed = cyclePacing }},
+        {GLFW_KEY_1, { .pressed = changeBoxCount(8'000)}},
+        {GLFW_KEY_2, { .pressed = changeBoxCount(100'000)}},
+        {GLFW_KEY_3, { .pressed = changeBoxCount(1'000'000)}},
+
         {GLFW_KEY_ESCAPE, { .pressed = close }}
     };
 
@@ -232,54 +364,206 @@ auto run(jac::Arguments& /*arg*/, jac::Arguments& /*env*/) -> int
         state.camera.pitch(rotation.y * (m_invese.y ? -1.f : 1.f));
     });
 
+    input.setMouseButtonHandler([](State& state, const int button, const bool pressed) {
+        if (button == GLFW_MOUSE_BUTTON_LEFT && pressed)
+            state.pick = true;
+    });
+
     input.setMouseScrollHandler([](State& state, const float delta) {
         state.camera.changeFov(-delta);
     });
 
-    double time{};
+    constexpr double targetFPS = 60.0;
+    FramePacer pacer{state.pacing, targetFPS};
+
+    FrameStats stats;
+    if (options.statsPath)
+        stats.exportTo(*options.statsPath, options.statsFormat, options.statsInterval);
+
+    constexpr double statusInterval = 0.25;
+    double lastStatus{};
+
     while(!glfwWindowShouldClose(window.get()))
     {
-        time = glfwGetTime();
+        PROFILE_ZONE("Frame");
+        stats.beginFrame();
+        StateCache::Get().ResetCounters();
 
         input.update();
+        stats.mark(FrameStats::Input);
+
+        if (state.pacing != pacer.getMode())
+            pacer.setMode(state.pacing);
+
+        if (state.boxCount != boxCount)
+        {
+            boxCount = state.boxCount;
+            setupBoxes(boxCount);
+        }
+
+        // Spinning the first group only touches its subtree, static groups cost nothing
+        if (state.animate)
+            transforms.setLocal(boxNodes.groups.front(), {
+                .rotation = glm::vec3{0.f, static_cast<float>(glfwGetTime()) * 0.5f, 0.f}
+            });
+
+        const uint updatedTransforms = transforms.update();
+
+        if (const auto changed = shaderWatcher.poll(); !changed.empty())
+            std::cout << std::format("\nReloading {} programs", Renderer::GPU::Shader::ReloadChanged(changed)) << std::endl;
+
+        // Cursor is captured, so picking goes through the center of the screen
+        if (state.pick)
+        {
+            state.pick = false;
+            boxRenderer.highlight(boxRenderer.pick({
+                state.camera.getPosition(),
+                state.camera.getForward()
+            }));
+        }
+
+        stats.mark(FrameStats::Update);
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        shader.Bind();
-        shader.SetUniform("uMix", state.mix);
-        texture.Bind(0);
-        shader.SetUniform("uTexture_0", 0);
-        texture2.Bind(1);
-        shader.SetUniform("uTexture_1", 1);
+        if (streamer)
+        {
+            streamer->update();
+            streamer->bind(streamed[0], 0);
+            streamer->bind(streamed[1], 1);
+        }
+        else
+        {
+            texture->Bind(0);
+            texture2->Bind(1);
+        }
+
+        boxRenderer.setCulling(state.culling);
+        boxRenderer.setSorting(state.sorting);
+        boxRenderer.setTexturing(state.texturing);
+        boxRenderer.setLod(state.lod);
 
-        va.Bind();
+        int framebufferWidth{}, framebufferHeight{};
+        glfwGetFramebufferSize(window.get(), &framebufferWidth, &framebufferHeight);
+        boxRenderer.setLodSelection({.viewportHeight = static_cast<uint>(std::max(framebufferHeight, 1))});
 
-        shader.SetUniformM("uView", state.camera.getView());
-        shader.SetUniformM("uProjection", state.camera.getProjection());
+        boxRenderer.draw(state.mode, state.camera, state.mix);
+        stats.mark(FrameStats::Submit);
 
-        for (const auto& box : boxes)
+        // Programs are compiled while the rest loads, the first draw waits for those it needs
+        static bool shadersReported = false;
+        if (!shadersReported)
         {
-            draw_Box(box, shader);
+            const auto& shaderCache = Renderer::GPU::Shader::GetCacheStats();
+            std::cout << std::format("Shaders: {} loaded from cache ({:.1f} ms), {} compiled ({:.1f} ms, {} cached rejected)",
+                shaderCache.loaded, shaderCache.loadMs, shaderCache.compiled, shaderCache.compileMs, shaderCache.rejected) << std::endl;
         }
+        shadersReported = true;
 
         glfwSwapBuffers(window.get());
+        stats.mark(FrameStats::Swap);
 
-        constexpr double targetFPS = 60.0;
-        while(glfwGetTime() - time < 1.0 / targetFPS);
+        // Binaries of programs linked this frame, files are written by workers
+        Renderer::GPU::Shader::SaveCache(&jobs);
 
-        const uint fps = std::round(1.0 / (glfwGetTime() - time));
+        stats.endFrame();
+        PROFILE_FRAME();
+        pacer.wait();
+
+        if (glfwGetTime() - lastStatus < statusInterval)
+            continue;
+        lastStatus = glfwGetTime();
+
+        // FPS comes from real frame intervals (pacing included), CPU times exclude waiting for the next frame
+        const auto jitter = pacer.getJitter();
+        const uint fps = jitter.meanInterval > 0.0 ? std::round(1000.0 / jitter.meanInterval) : 0;
+        const auto& cpu = stats.summary().phases[FrameStats::Total];
+        const auto& glCalls = StateCache::Get().GetCounters();
         const auto pos = state.camera.getPosition();
+
+        constexpr double MiB = 1024.0 * 1024.0;
+        const std::string streaming = streamer ? std::format(", textures: {:.1f}/{:.0f} MB (upload {:.1f} KB/frame, {} streaming)",
+            static_cast<double>(streamer->getStats().residentBytes) / MiB,
+            static_cast<double>(streamer->getStats().budgetBytes) / MiB,
+            static_cast<double>(streamer->getStats().uploadedBytes) / 1024.0,
+            streamer->getStats().streaming) : std::string{};
+        // Error from the period only exists with a target, other modes show how much intervals vary
+        const std::string jitterText = pacer.getMode() == FramePacer::Mode::Target ?
+            std::format("jitter avg/max: {:.3f}/{:.3f} ms", jitter.meanAbsError, jitter.maxAbsError) :
+            std::format("interval stddev: {:.3f} ms", jitter.stddev);
         std::cout << 
-            '\r' << std::string(80, ' ') <<
-            '\r' << std::format("FPS: {}, XYZ: {} {} {}", fps, pos.x, pos.y, pos.z) <<
+            '\r' << std::string(240, ' ') <<
+            '\r' << std::format("FPS: {} ({}, {}), CPU p50/p99/max: {:.2f}/{:.2f}/{:.2f} ms, XYZ: {} {} {}, visible: {}/{}, draw calls: {}, triangles: {} (LOD error avg/max: {:.2f}/{:.2f} px), state calls issued/skipped: {}/{}, instance fence waits: {} (max {:.2f} ms), transforms: {}, picked: {} ({}, {} textures){}{}",
+                fps, FramePacer::to_string(pacer.getMode()), jitterText,
+                cpu.p50, cpu.p99, cpu.max,
+                pos.x, pos.y, pos.z,
+                boxRenderer.getVisibleCount(), boxRenderer.getBoxCount(), boxRenderer.getDrawCalls(),
+                boxRenderer.getLodStats().triangles, boxRenderer.getLodStats().meanErrorPixels, boxRenderer.getLodStats().maxErrorPixels,
+                glCalls.totalIssued(), glCalls.totalSkipped(),
+                boxRenderer.getStreamStats().waits, boxRenderer.getStreamStats().maxWaitMs,
+                updatedTransforms,
+                boxRenderer.getHighlighted() ? std::to_string(*boxRenderer.getHighlighted()) : "none",
+                BoxRenderer::to_string(state.mode),
+                BoxRenderer::to_string(boxRenderer.getActiveTexturing()),
+                state.sorting ? " (sorted)" : "",
+                streaming) <<
             std::flush;
     }
 
+    stats.flush();
+
+    if (options.tracePath)
+        Profiler::instance().writeTrace(*options.tracePath);
+
     glfwTerminate();
     return 0;
 }
 
+auto parse_options(const std::vector<std::string_view>& args) -> Options
+{
+    Options options;
+
+    for (uint i = 0; i < args.size(); i++)
+    {
+        const std::string_view option = args[i];
+        if (!option.starts_with("--"))
+            continue;
+
+        const bool hasValue = i + 1 < args.size();
+        const std::string value = hasValue ? std::string{args[i + 1]} : std::string{};
+
+        if (option == "--stream-textures")
+        {
+            options.streamTextures = true;
+            continue;
+        }
+
+        if (option == "--stats-out" && hasValue)
+            options.statsPath = value;
+        else if (option == "--stats-format" && hasValue)
+            options.statsFormat = (value == "csv") ? FrameStats::Format::CSV : FrameStats::Format::JsonLines;
+        else if (option == "--stats-interval" && hasValue)
+            options.statsInterval = std::stod(value);
+        else if (option == "--trace-out" && hasValue)
+        {
+            if constexpr (!Profiler::Enabled)
+                std::cerr << "Profiler is compiled out (-DProfiler=ON), trace will be empty" << std::endl;
+
+            options.tracePath = value;
+        }
+        else
+        {
+            std::cerr << "Unknown option or missing value: " << option << std::endl;
+            continue;
+        }
+
+        i++;
+    }
+
+    return options;
+}
+
 auto initialize_glfw() -> void
 {
     if(!glfwInit())
@@ -332,47 +616,3 @@ auto create_window(const uint width, const uint height, const std::string& title
 
     return window;
 }
-
-auto create_boxes(const uint count) -> std::vector<Box>
-{
-    std::vector<Box> boxes(count);
-
-    srand(time(nullptr));
-    auto randFloat = []() -> float {
-        return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-    };
-
-    for (auto& box : boxes)
-    {
-        box.position = glm::vec3(randFloat() * 100.f - 50.f, randFloat() * 100.f - 50.f, randFloat() * 100.f - 50.f);
-        box.scale = randFloat() * 2.f;
-        box.rotation = glm::vec3(randFloat() * 360.f, randFloat() * 360.f, randFloat() * 360.f);
-        box.color = glm::vec3(randFloat(), randFloat(), randFloat());
-    }
-
-    auto& bigBox = boxes.back();
-    bigBox.position = glm::vec3(1000.f, 1000.f, 1000.f);
-    bigBox.scale = 1000.f;
-
-    auto& skyBox = boxes.front();
-    skyBox.position = glm::vec3(0.f, 0.f, 0.f);
-    skyBox.scale = 5000.f;
-
-    return boxes;
-}
-
-auto draw_Box(const Box& box, Shader& shader) -> void
-{
-    auto model = glm::mat4(1.0f);
-    model = glm::translate(model, box.position);
-    model = glm::rotate(model, box.rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
-    model = glm::rotate(model, box.rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
-    model = glm::rotate(model, box.rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, glm::vec3(box.scale));
-
-    shader.SetUniformM("uModel", model);
-    shader.SetUniform("uColor", box.color.r, box.color.g, box.color.b, 1.0f);
-    shader.SetUniform("uLightColor", 0.1f, 0.1f, 0.1f);
-
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-}
@@ -0,0 +1,250 @@
+/**
+ * @file Culling.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Checks SSE/AVX2 sphere culling against the scalar path, no OpenGL context needed.
+ *      SIMD levels the CPU doesn't support are skipped. Usage: Culling_test
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <cmath>
+#include <random>
+#include <format>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "JobSystem.hpp"
+#include "Renderer/Culling.hpp"
+
+namespace
+{
+
+using Renderer::Frustum;
+using Renderer::SimdLevel;
+using Renderer::BoundingSpheres;
+
+int failures = 0;
+
+auto check(bool condition, const std::string& what) -> void
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+auto name(SimdLevel level) -> const char*
+{
+    switch (level)
+    {
+        case SimdLevel::SSE: return "SSE";
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::Scalar: break;
+    }
+
+    return "scalar";
+}
+
+// Levels above scalar that can run on this CPU
+auto simd_levels() -> std::vector<SimdLevel>
+{
+    std::vector<SimdLevel> levels;
+
+    if (Renderer::detect_simd_level() >= SimdLevel::SSE)
+        levels.push_back(SimdLevel::SSE);
+    if (Renderer::detect_simd_level() >= SimdLevel::AVX2)
+        levels.push_back(SimdLevel::AVX2);
+
+    return levels;
+}
+
+auto perspective_frustum() -> Frustum
+{
+    const glm::mat4 projection = glm::perspective(glm::radians(75.f), 4.f / 3.f, 0.5f, 200.f);
+    const glm::mat4 view = glm::lookAt(glm::vec3{0.f}, glm::vec3{0.f, 0.f, -1.f}, glm::vec3{0.f, 1.f, 0.f});
+
+    return Frustum::FromMatrix(projection * view);
+}
+
+// Axis aligned box [-10, 10]^3, distances to its planes are exact in float
+auto box_frustum() -> Frustum
+{
+    Frustum frustum;
+    frustum.planes[Frustum::LEFT] = {1.f, 0.f, 0.f, 10.f};
+    frustum.planes[Frustum::RIGHT] = {-1.f, 0.f, 0.f, 10.f};
+    frustum.planes[Frustum::BOTTOM] = {0.f, 1.f, 0.f, 10.f};
+    frustum.planes[Frustum::TOP] = {0.f, -1.f, 0.f, 10.f};
+    frustum.planes[Frustum::NEAR] = {0.f, 0.f, 1.f, 10.f};
+    frustum.planes[Frustum::FAR] = {0.f, 0.f, -1.f, 10.f};
+
+    return frustum;
+}
+
+auto random_spheres(uint count, std::mt19937& random) -> BoundingSpheres
+{
+    std::uniform_real_distribution<float> position(-150.f, 150.f);
+    std::uniform_real_distribution<float> radius(0.f, 20.f);
+
+    BoundingSpheres spheres;
+    for (uint i = 0; i < count; i++)
+        spheres.push_back({position(random), position(random), position(random)}, radius(random));
+
+    return spheres;
+}
+
+// FMA and the scalar dot product round differently, so they may only disagree on spheres touching a plane
+auto is_borderline(const Frustum& frustum, const BoundingSpheres& spheres, uint i) -> bool
+{
+    constexpr float tolerance = 1e-3f;
+
+    for (const auto& plane : frustum.planes)
+    {
+        const float distance = glm::dot(glm::vec3{plane}, glm::vec3{spheres.x[i], spheres.y[i], spheres.z[i]}) + plane.w;
+        if (std::abs(distance + spheres.radius[i]) < tolerance)
+            return true;
+    }
+
+    return false;
+}
+
+auto compare(const Frustum& frustum, const BoundingSpheres& spheres, SimdLevel level, bool exact, const std::string& what) -> void
+{
+    std::vector<uint> expected, visible;
+    Renderer::cull_spheres(frustum, spheres, expected, SimdLevel::Scalar);
+    Renderer::cull_spheres(frustum, spheres, visible, level);
+
+    check(std::ranges::is_sorted(visible), std::format("{} {}: indices not in order", name(level), what));
+
+    std::vector<uint> difference;
+    std::ranges::set_symmetric_difference(expected, visible, std::back_inserter(difference));
+
+    const auto mismatch = std::ranges::find_if(difference, [&](uint i) {
+        return exact || !is_borderline(frustum, spheres, i);
+    });
+
+    check(mismatch == difference.end(), std::format("{} {}: sphere {} differs from scalar ({} visible, scalar {})",
+        name(level), what, mismatch == difference.end() ? 0 : *mismatch, visible.size(), expected.size()));
+}
+
+auto test_random(const std::vector<SimdLevel>& levels) -> void
+{
+    std::mt19937 random(1234);
+    const Frustum frustum = perspective_frustum();
+
+    for (uint count = 0; count <= 67; count++)
+    {
+        const BoundingSpheres spheres = random_spheres(count, random);
+        for (SimdLevel level : levels)
+            compare(frustum, spheres, level, false, std::format("{} random spheres", count));
+    }
+
+    const BoundingSpheres spheres = random_spheres(10'003, random);
+    for (SimdLevel level : levels)
+        compare(frustum, spheres, level, false, "10003 random spheres");
+}
+
+// Subranges starting and ending off the SIMD width, the remainder goes through the narrower paths
+auto test_ranges(const std::vector<SimdLevel>& levels) -> void
+{
+    std::mt19937 random(5678);
+    const Frustum frustum = box_frustum();
+    const BoundingSpheres spheres = random_spheres(64, random);
+
+    std::vector<uint> expected(spheres.size()), visible(spheres.size());
+
+    for (uint begin = 0; begin < 9; begin++)
+        for (uint end = begin; end <= spheres.size(); end += 3)
+        {
+            const uint expectedCount = Renderer::cull_spheres(frustum, spheres, begin, end, expected.data(), SimdLevel::Scalar);
+
+            for (SimdLevel level : levels)
+            {
+                const uint count = Renderer::cull_spheres(frustum, spheres, begin, end, visible.data(), level);
+
+                check(count == expectedCount && std::equal(visible.begin(), visible.begin() + count, expected.begin()),
+                    std::format("{} range [{}, {}): {} visible, scalar {}", name(level), begin, end, count, expectedCount));
+            }
+        }
+}
+
+// Spheres exactly on a plane (distance == -radius) are culled, ones a step closer are kept
+auto test_on_plane(const std::vector<SimdLevel>& levels) -> void
+{
+    const Frustum frustum = box_frustum();
+    BoundingSpheres spheres;
+
+    for (float radius : {0.f, 0.5f, 1.f, 2.f, 4.f})
+    {
+        const float outside = 10.f + radius;
+        const float inside = std::nextafter(outside, 0.f);
+
+        for (float position : {outside, -outside})
+        {
+            spheres.push_back({position, 0.f, 0.f}, radius);
+            spheres.push_back({0.f, position, 0.f}, radius);
+            spheres.push_back({0.f, 0.f, position}, radius);
+        }
+
+        for (float position : {inside, -inside})
+        {
+            spheres.push_back({position, 0.f, 0.f}, radius);
+            spheres.push_back({0.f, position, 0.f}, radius);
+            spheres.push_back({0.f, 0.f, position}, radius);
+        }
+    }
+
+    std::vector<uint> expected;
+    Renderer::cull_spheres(frustum, spheres, expected, SimdLevel::Scalar);
+
+    // Every group of 12 has 6 spheres touching a plane from outside, then 6 just inside
+    const bool scalarCorrect = expected.size() == spheres.size() / 2 && std::ranges::all_of(expected, [](uint i) { return i % 12 >= 6; });
+    check(scalarCorrect, std::format("scalar on plane: {} of {} visible", expected.size(), spheres.size()));
+
+    for (SimdLevel level : levels)
+        compare(frustum, spheres, level, true, "spheres on plane");
+}
+
+// Chunked culling on the job system gives the same indices as one call
+auto test_jobs(const std::vector<SimdLevel>& levels) -> void
+{
+    std::mt19937 random(91011);
+    const Frustum frustum = perspective_frustum();
+    const BoundingSpheres spheres = random_spheres(50'001, random);
+
+    JobSystem jobs;
+
+    for (SimdLevel level : levels)
+    {
+        std::vector<uint> expected, visible;
+        Renderer::cull_spheres(frustum, spheres, expected, level);
+        Renderer::cull_spheres(jobs, frustum, spheres, visible, level);
+
+        check(visible == expected, std::format("{} on job system: {} visible, single call {}", name(level), visible.size(), expected.size()));
+    }
+}
+
+} // namespace
+
+auto main() -> int
+{
+    const std::vector<SimdLevel> levels = simd_levels();
+    if (levels.empty())
+        std::cout << "No SIMD support, only the scalar path is checked\n";
+
+    test_random(levels);
+    test_ranges(levels);
+    test_on_plane(levels);
+
+    std::vector<SimdLevel> allLevels{SimdLevel::Scalar};
+    allLevels.insert(allLevels.end(), levels.begin(), levels.end());
+    test_jobs(allLevels);
+
+    std::cout << std::format("{} failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file MeshOptimize.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Checks that vertex cache, overdraw and vertex fetch ordering keep the triangles of
+ *      generated meshes, don't make their ACMR worse and leave every index in range.
+ *      Usage: MeshOptimize_test
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <map>
+#include <span>
+#include <array>
+#include <cmath>
+#include <random>
+#include <format>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+#include "Mesh/Mesh.hpp"
+#include "Mesh/Optimize.hpp"
+
+namespace
+{
+
+using Triangle = std::array<uint, 3>;
+
+int failures = 0;
+
+auto check(bool condition, const std::string& what) -> void
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// Flat grid of size x size quads, triangles in row order
+auto make_grid(uint size) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    const uint side = size + 1;
+
+    for (uint y = 0; y < side; y++)
+        for (uint x = 0; x < side; x++)
+            mesh.vertices.push_back({{x / float(size), 0.f, y / float(size)}, {x / float(size), y / float(size)}});
+
+    for (uint y = 0; y < size; y++)
+    {
+        for (uint x = 0; x < size; x++)
+        {
+            const uint a = y * side + x, b = a + 1, c = a + side + 1, d = a + side;
+            mesh.indices.insert(mesh.indices.end(), {a, d, c, a, c, b});
+        }
+    }
+
+    return mesh;
+}
+
+// Torus around the y axis, parts of it occlude others so overdraw ordering has something to do
+auto make_torus(uint rings, uint segments) -> Mesh::IndexedMesh
+{
+    Mesh::IndexedMesh mesh;
+    constexpr float Pi = 3.14159265f;
+    constexpr float Major = 1.f, Minor = 0.35f;
+
+    for (uint ring = 0; ring <= rings; ring++)
+    {
+        for (uint segment = 0; segment <= segments; segment++)
+        {
+            const float theta = 2.f * Pi * ring / rings, phi = 2.f * Pi * segment / segments;
+            const float distance = Major + Minor * std::cos(phi);
+            mesh.vertices.push_back({
+                {distance * std::cos(theta), Minor * std::sin(phi), distance * std::sin(theta)},
+                {ring / float(rings), segment / float(segments)}
+            });
+        }
+    }
+
+    for (uint ring = 0; ring < rings; ring++)
+    {
+        for (uint segment = 0; segment < segments; segment++)
+        {
+            const uint a = ring * (segments + 1) + segment, b = a + 1, c = a + segments + 2, d = a + segments + 1;
+            mesh.indices.insert(mesh.indices.end(), {a, b, c, a, c, d});
+        }
+    }
+
+    return mesh;
+}
+
+// Same triangles in random order, and vertices shuffled too so fetch order is random as well
+auto shuffled(Mesh::IndexedMesh mesh, std::mt19937& random) -> Mesh::IndexedMesh
+{
+    std::vector<uint> triangles(mesh.triangleCount());
+    std::ranges::generate(triangles, [n = 0u]() mutable { return n++; });
+    std::ranges::shuffle(triangles, random);
+
+    std::vector<uint> vertexOrder(mesh.vertices.size());
+    std::ranges::generate(vertexOrder, [n = 0u]() mutable { return n++; });
+    std::ranges::shuffle(vertexOrder, random);
+
+    Mesh::IndexedMesh result;
+    result.vertices.resize(mesh.vertices.size());
+    for (uint i = 0; i < vertexOrder.size(); i++)
+        result.vertices[vertexOrder[i]] = mesh.vertices[i];
+
+    for (const uint triangle : triangles)
+        for (uint corner = 0; corner < 3; corner++)
+            result.indices.push_back(vertexOrder[mesh.indices[triangle * 3 + corner]]);
+
+    return result;
+}
+
+auto positions(const Mesh::IndexedMesh& mesh) -> std::vector<glm::vec3>
+{
+    std::vector<glm::vec3> result;
+    for (const auto& vertex : mesh.vertices)
+        result.push_back(vertex.position);
+
+    return result;
+}
+
+// Sorted triangles, each rotated to start at its smallest index so the winding is kept
+auto triangles(std::span<const uint> indices) -> std::vector<Triangle>
+{
+    std::vector<Triangle> result;
+
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        Triangle triangle{indices[i], indices[i + 1], indices[i + 2]};
+        std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+        result.push_back(triangle);
+    }
+
+    std::ranges::sort(result);
+    return result;
+}
+
+auto is_permutation(std::span<const uint> indices, std::span<const uint> reordered) -> bool
+{
+    return indices.size() == reordered.size() && triangles(indices) == triangles(reordered);
+}
+
+auto test_vertex_cache(const std::string& name, const Mesh::IndexedMesh& mesh) -> void
+{
+    const uint vertexCount = mesh.vertices.size();
+    const std::vector<uint> reordered = Mesh::optimize_vertex_cache(mesh.indices, vertexCount);
+
+    check(is_permutation(mesh.indices, reordered), std::format("{}: vertex cache order changed triangles", name));
+
+    const float before = Mesh::analyze_vertex_cache(mesh.indices, vertexCount).acmr;
+    const float after = Mesh::analyze_vertex_cache(reordered, vertexCount).acmr;
+    check(after <= before, std::format("{}: vertex cache order ACMR {:.3f} -> {:.3f}", name, before, after));
+}
+
+auto test_overdraw(const std::string& name, const Mesh::IndexedMesh& mesh) -> void
+{
+    const uint vertexCount = mesh.vertices.size();
+    const Mesh::OptimizeSettings settings{};
+
+    const std::vector<uint> cacheOrder = Mesh::optimize_vertex_cache(mesh.indices, vertexCount);
+    const std::vector<uint> reordered = Mesh::optimize_overdraw(cacheOrder, positions(mesh), settings.cacheSize, settings.overdrawThreshold);
+
+    check(is_permutation(mesh.indices, reordered), std::format("{}: overdraw order changed triangles", name));
+
+    // Threshold holds per cluster, sorting them adds misses at their boundaries, the input order still has to be beaten
+    const float before = Mesh::analyze_vertex_cache(mesh.indices, vertexCount).acmr;
+    const float after = Mesh::analyze_vertex_cache(reordered, vertexCount).acmr;
+    check(after <= before, std::format("{}: overdraw order ACMR {:.3f} -> {:.3f}", name, before, after));
+}
+
+auto test_fetch_remap(const std::string& name, const Mesh::IndexedMesh& mesh) -> void
+{
+    // Vertices nothing points at, they must get ~0u
+    const uint unused = 5;
+    const uint vertexCount = mesh.vertices.size() + unused;
+
+    const std::vector<uint> remap = Mesh::vertex_fetch_remap(mesh.indices, vertexCount);
+    check(remap.size() == vertexCount, std::format("{}: remap has {} entries for {} vertices", name, remap.size(), vertexCount));
+    if (remap.size() != vertexCount)
+        return;
+
+    std::vector<bool> used(vertexCount, false);
+    for (const uint index : mesh.indices)
+        used[index] = true;
+    const uint usedCount = std::ranges::count(used, true);
+
+    std::vector<bool> taken(usedCount, false);
+    bool valid = true;
+
+    for (uint vertex = 0; vertex < vertexCount; vertex++)
+    {
+        if (!used[vertex])
+        {
+            valid &= remap[vertex] == ~0u;
+            continue;
+        }
+
+        valid &= remap[vertex] < usedCount && !taken[remap[vertex]];
+        if (remap[vertex] < usedCount)
+            taken[remap[vertex]] = true;
+    }
+
+    check(valid, std::format("{}: remap isn't a bijection onto [0, {})", name, usedCount));
+
+    // First use order, the first triangle gets the first vertices
+    check(remap[mesh.indices[0]] == 0, std::format("{}: first vertex remapped to {}", name, remap[mesh.indices[0]]));
+}
+
+// Whole pipeline, compares triangles by vertex values since vertices are reordered and unused ones dropped
+auto test_optimize_mesh(const std::string& name, Mesh::IndexedMesh mesh) -> void
+{
+    // Seams of the torus share positions, texture coordinates tell them apart
+    const auto key = [](const Mesh::Vertex& vertex) {
+        return std::array<float, 5>{vertex.position.x, vertex.position.y, vertex.position.z, vertex.texCoord.x, vertex.texCoord.y};
+    };
+
+    std::map<std::array<float, 5>, uint> original;
+    for (uint i = 0; i < mesh.vertices.size(); i++)
+        original[key(mesh.vertices[i])] = i;
+
+    const std::vector<uint> indices = mesh.indices;
+    mesh.vertices.push_back({glm::vec3{10.f}, glm::vec2{0.f}});
+
+    const Mesh::OptimizeReport report = Mesh::optimize_mesh(mesh);
+
+    check(mesh.vertices.size() == original.size(), std::format("{}: {} vertices left of {} used", name, mesh.vertices.size(), original.size()));
+
+    const bool inRange = std::ranges::all_of(mesh.indices, [&](uint index) { return index < mesh.vertices.size(); });
+    check(inRange, std::format("{}: index out of range after optimize_mesh", name));
+    if (!inRange)
+        return;
+
+    std::vector<uint> restored;
+    for (const uint index : mesh.indices)
+    {
+        const auto it = original.find(key(mesh.vertices[index]));
+        restored.push_back(it == original.end() ? ~0u : it->second);
+    }
+
+    check(is_permutation(indices, restored), std::format("{}: optimize_mesh changed triangles", name));
+    check(report.after.cache.acmr <= report.before.cache.acmr,
+        std::format("{}: optimize_mesh ACMR {:.3f} -> {:.3f}", name, report.before.cache.acmr, report.after.cache.acmr));
+}
+
+} // namespace
+
+auto main() -> int
+{
+    std::mt19937 random(42);
+
+    const Mesh::IndexedMesh grid = make_grid(64);
+    const Mesh::IndexedMesh shuffledGrid = shuffled(grid, random);
+    const Mesh::IndexedMesh torus = make_torus(48, 24);
+
+    for (const auto& [name, mesh] : {std::pair{"grid", &grid}, std::pair{"shuffled grid", &shuffledGrid}, std::pair{"torus", &torus}})
+    {
+        test_vertex_cache(name, *mesh);
+        test_overdraw(name, *mesh);
+        test_fetch_remap(name, *mesh);
+        test_optimize_mesh(name, *mesh);
+    }
+
+    std::cout << std::format("{} failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
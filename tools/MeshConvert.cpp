@@ -0,0 +1,105 @@
+/**
+ * @file MeshConvert.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Converts text models (.dat) and Wavefront OBJ files into binary mesh files
+ *      mapped by Mesh::MappedMesh. Models keep their layout and stay non-indexed,
+ *      OBJ files become indexed position, texture coordinate and normal meshes, reordered
+ *      for vertex cache, overdraw and vertex fetch unless --no-optimize is given. With --quantize
+ *      float attributes are stored as half floats, 16 bit unorm and 10-10-10-2 (Mesh::quantize_mesh).
+ *      Usage: MeshConvert <model.dat|model.obj> <output.mesh> [--no-optimize] [--quantize]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <format>
+#include <string_view>
+#include <iostream>
+
+#include "JobSystem.hpp"
+#include "Mesh/Obj.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Mesh/Optimize.hpp"
+#include "Mesh/Quantize.hpp"
+#include "Renderer/Model.hpp"
+
+auto main(int argc, char** argv) -> int
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: MeshConvert <model.dat|model.obj> <output.mesh> [--no-optimize] [--quantize]" << std::endl;
+        return -1;
+    }
+
+    const std::filesystem::path input = argv[1];
+    bool optimize = true;
+    bool quantize = false;
+
+    for (int i = 3; i < argc; i++)
+    {
+        const std::string_view flag = argv[i];
+
+        if (flag == "--no-optimize")
+            optimize = false;
+        else if (flag == "--quantize")
+            quantize = true;
+        else
+        {
+            std::cerr << "Unknown option: " << flag << std::endl;
+            return -1;
+        }
+    }
+
+    Mesh::MeshData mesh;
+
+    if (input.extension() == ".obj")
+    {
+        JobSystem jobs;
+
+        const std::optional<Mesh::ObjMesh> obj = Mesh::read_obj(input, &jobs);
+        if (!obj)
+            return -1;
+
+        mesh = Mesh::to_mesh_data(*obj);
+    }
+    else
+        mesh = Mesh::to_mesh_data(Renderer::read_model(input));
+
+    if (mesh.vertexCount == 0)
+    {
+        std::cerr << "No vertices in " << input << std::endl;
+        return -1;
+    }
+
+    if (optimize && !mesh.indices.empty())
+    {
+        const Mesh::OptimizeReport report = Mesh::optimize_mesh(mesh);
+
+        const auto print = [](std::string_view name, const Mesh::OptimizeReport::Stats& stats) {
+            std::cout << std::format("{:<7} ACMR {:.3f}, ATVR {:.3f}, overfetch {:.3f}, overdraw {:.3f}\n",
+                name, stats.cache.acmr, stats.cache.atvr, stats.overfetch, stats.overdraw);
+        };
+
+        print("before", report.before);
+        print("after", report.after);
+    }
+
+    // After optimizing, overdraw ordering reads float positions
+    if (quantize)
+    {
+        const Mesh::QuantizeReport report = Mesh::quantize_mesh(mesh);
+
+        std::cout << std::format("quantized {} to {} bytes per vertex, max error per attribute:", report.strideBefore, report.strideAfter);
+        for (const float error : report.maxError)
+            std::cout << std::format(" {:.6f}", error);
+        std::cout << '\n';
+    }
+
+    std::cout << std::format("{} vertices ({} bytes each), {} indices, bounds ({:.3f} {:.3f} {:.3f}) - ({:.3f} {:.3f} {:.3f})\n",
+        mesh.vertexCount, mesh.layout.GetStride(), mesh.indices.size(),
+        mesh.bounds.min.x, mesh.bounds.min.y, mesh.bounds.min.z,
+        mesh.bounds.max.x, mesh.bounds.max.y, mesh.bounds.max.z);
+
+    return Mesh::write_mesh(argv[2], mesh) ? 0 : -1;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file MeshLod.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Offline LOD chain generator, simplifies a model with quadric error collapses
+ *      and writes all levels into one file read by Mesh::read_lod_chain. Levels are reordered
+ *      for the vertex cache, ACMR printed per level is simulated with Mesh::DefaultCacheSize.
+ *      Usage: MeshLod <model.dat> <output.lod> [max levels] [ratio] [max relative error]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <format>
+#include <string>
+#include <iostream>
+
+#include "Mesh/Lod.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Mesh/Optimize.hpp"
+#include "Renderer/Model.hpp"
+
+auto main(int argc, char** argv) -> int
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: MeshLod <model.dat> <output.lod> [max levels] [ratio] [max relative error]" << std::endl;
+        return -1;
+    }
+
+    Mesh::LodSettings settings;
+    if (argc > 3)
+        settings.maxLevels = std::stoul(argv[3]);
+    if (argc > 4)
+        settings.ratio = std::stof(argv[4]);
+    if (argc > 5)
+        settings.maxRelativeError = std::stof(argv[5]);
+
+    const Mesh::IndexedMesh mesh = Mesh::from_model(Renderer::read_model(argv[1]));
+    if (mesh.indices.empty())
+        return -1;
+
+    const Mesh::LodChain chain = Mesh::build_lod_chain(mesh, settings);
+
+    std::cout << std::format("radius {:.4f}\n", chain.radius);
+    std::cout << std::format("{:>6} {:>10} {:>10} {:>12} {:>6}\n", "level", "triangles", "vertices", "error", "ACMR");
+
+    for (uint level = 0; level < chain.levels.size(); level++)
+    {
+        const Mesh::LodChain::Level& current = chain.levels[level];
+        const uint next = level + 1 < chain.levels.size() ? chain.levels[level + 1].baseVertex : chain.vertices.size();
+        const std::span<const uint> indices{chain.indices.data() + current.firstIndex, current.indexCount};
+
+        std::cout << std::format("{:>6} {:>10} {:>10} {:>12.6f} {:>6.3f}\n",
+            level, chain.triangleCount(level), next - current.baseVertex, current.error,
+            Mesh::analyze_vertex_cache(indices, next - current.baseVertex).acmr);
+    }
+
+    return Mesh::write_lod_chain(argv[2], chain) ? 0 : -1;
+}
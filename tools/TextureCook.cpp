@@ -0,0 +1,68 @@
+/**
+ * @file TextureCook.cpp
+ * @author Moztanku (mostankpl@gmail.com)
+ * @brief Offline texture cooker, builds the mip chain of an image, block compresses it
+ *      and writes a cooked texture read by Renderer::GPU::Texture without decoding.
+ *      Usage: TextureCook <image> <output.tex> [auto|rgba8|bc1|bc3|bc7]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <chrono>
+#include <format>
+#include <iostream>
+
+#include "JobSystem.hpp"
+#include "Image/Cook.hpp"
+
+auto main(int argc, char** argv) -> int
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: TextureCook <image> <output.tex> [auto|rgba8|bc1|bc3|bc7]" << std::endl;
+        return -1;
+    }
+
+    std::optional<Image::Format> format;
+    if (argc > 3 && std::string_view(argv[3]) != "auto")
+    {
+        format = Image::parse_format(argv[3]);
+        if (!format)
+        {
+            std::cerr << "Unknown format " << argv[3] << std::endl;
+            return -1;
+        }
+    }
+
+    const std::optional<Image::Bitmap> image = Image::load_image(argv[1]);
+    const std::optional<uint64_t> hash = Image::hash_file(argv[1], format);
+    if (!image || !hash)
+    {
+        std::cerr << "Failed to load " << argv[1] << std::endl;
+        return -1;
+    }
+
+    JobSystem jobs;
+
+    const auto start = std::chrono::steady_clock::now();
+    Image::CookedTexture texture = Image::cook(*image, format.value_or(Image::choose_format(*image)), &jobs);
+    const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    texture.sourceHash = *hash;
+
+    const Image::Bitmap decoded = Image::decompress(texture.data.data(), texture.format, texture.width, texture.height);
+
+    std::cout << std::format("{}x{} {}, cooked in {:.2f} ms, PSNR {:.2f} dB\n",
+        texture.width, texture.height, Image::to_string(texture.format), time, Image::psnr(*image, decoded));
+    std::cout << std::format("{:>6} {:>12} {:>10}\n", "level", "size", "bytes");
+
+    for (uint level = 0; level < texture.levels.size(); level++)
+        std::cout << std::format("{:>6} {:>12} {:>10}\n",
+            level, std::format("{}x{}", texture.levels[level].width, texture.levels[level].height), texture.levels[level].size);
+
+    std::cout << std::format("total {} bytes, uncompressed base level {} bytes\n", texture.data.size(), image->size());
+
+    return Image::write_cooked(argv[2], texture) ? 0 : -1;
+}